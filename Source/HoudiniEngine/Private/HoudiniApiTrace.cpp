@@ -0,0 +1,710 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApiTrace.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngineOutputStats.h"
+#include "HoudiniAssetComponent.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+static void HoudiniApiTraceOnCVarChanged(IConsoleVariable* InVariable);
+
+static FAutoConsoleVariable CVarHoudiniEngineTraceHapiCalls(
+	TEXT("HoudiniEngine.TraceHapiCalls"),
+	0,
+	TEXT("Records the count, latency and data size of the HAPI calls per Houdini Asset Component, and emits them as trace events.\n")
+	TEXT("0: Disabled (default)\n")
+	TEXT("1: Enabled, use HoudiniEngine.DumpHapiTrace to write the CSV summary\n"),
+	FConsoleVariableDelegate::CreateStatic(&HoudiniApiTraceOnCVarChanged));
+
+static void HoudiniApiTraceDump(const TArray<FString>& InArgs);
+
+static FAutoConsoleCommand CCmdHoudiniEngineDumpHapiTrace(
+	TEXT("HoudiniEngine.DumpHapiTrace"),
+	TEXT("Writes the HAPI calls recorded by HoudiniEngine.TraceHapiCalls to a CSV file. Optional argument: the CSV file path."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HoudiniApiTraceDump));
+
+static FAutoConsoleCommand CCmdHoudiniEngineResetHapiTrace(
+	TEXT("HoudiniEngine.ResetHapiTrace"),
+	TEXT("Clears the HAPI calls recorded by HoudiniEngine.TraceHapiCalls."),
+	FConsoleCommandDelegate::CreateStatic(&FHoudiniApiTrace::Reset));
+
+TRACE_DECLARE_INT_COUNTER(HoudiniEngineHapiBytes, TEXT("HoudiniEngine/HAPI Bytes"));
+
+// All the FHoudiniApi functions returning a HAPI_Result are traced
+#define HOUDINI_API_TRACED_FUNCTIONS(X) \
+	X(AddAttribute) \
+	X(AddGroup) \
+	X(BindCustomImplementation) \
+	X(CancelPDGCook) \
+	X(CheckForSpecificErrors) \
+	X(Cleanup) \
+	X(ClearConnectionError) \
+	X(CloseSession) \
+	X(CommitGeo) \
+	X(CommitWorkitems) \
+	X(ComposeChildNodeList) \
+	X(ComposeNodeCookResult) \
+	X(ComposeObjectList) \
+	X(ConnectNodeInput) \
+	X(ConvertMatrixToEuler) \
+	X(ConvertMatrixToQuat) \
+	X(ConvertTransform) \
+	X(ConvertTransformEulerToMatrix) \
+	X(ConvertTransformQuatToMatrix) \
+	X(CookNode) \
+	X(CookPDG) \
+	X(CookPDGAllOutputs) \
+	X(CreateCustomSession) \
+	X(CreateHeightFieldInput) \
+	X(CreateHeightfieldInputVolumeNode) \
+	X(CreateInProcessSession) \
+	X(CreateInputCurveNode) \
+	X(CreateInputNode) \
+	X(CreateNode) \
+	X(CreateThriftNamedPipeSession) \
+	X(CreateThriftSocketSession) \
+	X(CreateWorkitem) \
+	X(DeleteAttribute) \
+	X(DeleteGroup) \
+	X(DeleteNode) \
+	X(DirtyPDGNode) \
+	X(DisconnectNodeInput) \
+	X(DisconnectNodeOutputsAt) \
+	X(ExtractImageToFile) \
+	X(ExtractImageToMemory) \
+	X(GetActiveCacheCount) \
+	X(GetActiveCacheNames) \
+	X(GetAssetDefinitionParmCounts) \
+	X(GetAssetDefinitionParmInfos) \
+	X(GetAssetDefinitionParmValues) \
+	X(GetAssetInfo) \
+	X(GetAttributeFloat64ArrayData) \
+	X(GetAttributeFloat64Data) \
+	X(GetAttributeFloatArrayData) \
+	X(GetAttributeFloatData) \
+	X(GetAttributeInfo) \
+	X(GetAttributeInt16ArrayData) \
+	X(GetAttributeInt16Data) \
+	X(GetAttributeInt64ArrayData) \
+	X(GetAttributeInt64Data) \
+	X(GetAttributeInt8ArrayData) \
+	X(GetAttributeInt8Data) \
+	X(GetAttributeIntArrayData) \
+	X(GetAttributeIntData) \
+	X(GetAttributeNames) \
+	X(GetAttributeStringArrayData) \
+	X(GetAttributeStringData) \
+	X(GetAttributeUInt8ArrayData) \
+	X(GetAttributeUInt8Data) \
+	X(GetAvailableAssetCount) \
+	X(GetAvailableAssets) \
+	X(GetBoxInfo) \
+	X(GetCacheProperty) \
+	X(GetComposedChildNodeList) \
+	X(GetComposedNodeCookResult) \
+	X(GetComposedObjectList) \
+	X(GetComposedObjectTransforms) \
+	X(GetCompositorOptions) \
+	X(GetConnectionError) \
+	X(GetConnectionErrorLength) \
+	X(GetCookingCurrentCount) \
+	X(GetCookingTotalCount) \
+	X(GetCurveCounts) \
+	X(GetCurveInfo) \
+	X(GetCurveKnots) \
+	X(GetCurveOrders) \
+	X(GetDisplayGeoInfo) \
+	X(GetEdgeCountOfEdgeGroup) \
+	X(GetEnvInt) \
+	X(GetFaceCounts) \
+	X(GetFirstVolumeTile) \
+	X(GetGeoInfo) \
+	X(GetGeoSize) \
+	X(GetGroupCountOnPackedInstancePart) \
+	X(GetGroupMembership) \
+	X(GetGroupMembershipOnPackedInstancePart) \
+	X(GetGroupNames) \
+	X(GetGroupNamesOnPackedInstancePart) \
+	X(GetHIPFileNodeCount) \
+	X(GetHIPFileNodeIds) \
+	X(GetHandleBindingInfo) \
+	X(GetHandleInfo) \
+	X(GetHeightFieldData) \
+	X(GetImageFilePath) \
+	X(GetImageInfo) \
+	X(GetImageMemoryBuffer) \
+	X(GetImagePlaneCount) \
+	X(GetImagePlanes) \
+	X(GetInputCurveInfo) \
+	X(GetInstanceTransformsOnPart) \
+	X(GetInstancedObjectIds) \
+	X(GetInstancedPartIds) \
+	X(GetInstancerPartTransforms) \
+	X(GetManagerNodeId) \
+	X(GetMaterialInfo) \
+	X(GetMaterialNodeIdsOnFaces) \
+	X(GetNextVolumeTile) \
+	X(GetNodeFromPath) \
+	X(GetNodeInfo) \
+	X(GetNodeInputName) \
+	X(GetNodeOutputName) \
+	X(GetNodePath) \
+	X(GetNumWorkitems) \
+	X(GetObjectInfo) \
+	X(GetObjectTransform) \
+	X(GetOutputGeoCount) \
+	X(GetOutputGeoInfos) \
+	X(GetOutputNodeId) \
+	X(GetPDGEvents) \
+	X(GetPDGGraphContextId) \
+	X(GetPDGGraphContexts) \
+	X(GetPDGState) \
+	X(GetParameters) \
+	X(GetParmChoiceLists) \
+	X(GetParmExpression) \
+	X(GetParmFile) \
+	X(GetParmFloatValue) \
+	X(GetParmFloatValues) \
+	X(GetParmIdFromName) \
+	X(GetParmInfo) \
+	X(GetParmInfoFromName) \
+	X(GetParmIntValue) \
+	X(GetParmIntValues) \
+	X(GetParmNodeValue) \
+	X(GetParmStringValue) \
+	X(GetParmStringValues) \
+	X(GetParmTagName) \
+	X(GetParmTagValue) \
+	X(GetParmWithTag) \
+	X(GetPartInfo) \
+	X(GetPreset) \
+	X(GetPresetBufLength) \
+	X(GetServerEnvInt) \
+	X(GetServerEnvString) \
+	X(GetServerEnvVarCount) \
+	X(GetServerEnvVarList) \
+	X(GetSessionEnvInt) \
+	X(GetSessionSyncInfo) \
+	X(GetSphereInfo) \
+	X(GetStatus) \
+	X(GetStatusString) \
+	X(GetStatusStringBufLength) \
+	X(GetString) \
+	X(GetStringBatch) \
+	X(GetStringBatchSize) \
+	X(GetStringBufLength) \
+	X(GetSupportedImageFileFormatCount) \
+	X(GetSupportedImageFileFormats) \
+	X(GetTime) \
+	X(GetTimelineOptions) \
+	X(GetTotalCookCount) \
+	X(GetUseHoudiniTime) \
+	X(GetVertexList) \
+	X(GetViewport) \
+	X(GetVolumeBounds) \
+	X(GetVolumeInfo) \
+	X(GetVolumeTileFloatData) \
+	X(GetVolumeTileIntData) \
+	X(GetVolumeVisualInfo) \
+	X(GetVolumeVoxelFloatData) \
+	X(GetVolumeVoxelIntData) \
+	X(GetWorkitemDataLength) \
+	X(GetWorkitemFloatData) \
+	X(GetWorkitemInfo) \
+	X(GetWorkitemIntData) \
+	X(GetWorkitemResultInfo) \
+	X(GetWorkitemStringData) \
+	X(GetWorkitems) \
+	X(Initialize) \
+	X(InsertMultiparmInstance) \
+	X(Interrupt) \
+	X(IsInitialized) \
+	X(IsNodeValid) \
+	X(IsSessionValid) \
+	X(LoadAssetLibraryFromFile) \
+	X(LoadAssetLibraryFromMemory) \
+	X(LoadGeoFromFile) \
+	X(LoadGeoFromMemory) \
+	X(LoadHIPFile) \
+	X(LoadNodeFromFile) \
+	X(MergeHIPFile) \
+	X(ParmHasExpression) \
+	X(ParmHasTag) \
+	X(PausePDGCook) \
+	X(PythonThreadInterpreterLock) \
+	X(QueryNodeInput) \
+	X(QueryNodeOutputConnectedCount) \
+	X(QueryNodeOutputConnectedNodes) \
+	X(RemoveCustomString) \
+	X(RemoveMultiparmInstance) \
+	X(RemoveParmExpression) \
+	X(RenameNode) \
+	X(RenderCOPToImage) \
+	X(RenderTextureToImage) \
+	X(ResetSimulation) \
+	X(RevertGeo) \
+	X(RevertParmToDefault) \
+	X(RevertParmToDefaults) \
+	X(SaveGeoToFile) \
+	X(SaveGeoToMemory) \
+	X(SaveHIPFile) \
+	X(SaveNodeToFile) \
+	X(SetAnimCurve) \
+	X(SetAttributeFloat64ArrayData) \
+	X(SetAttributeFloat64Data) \
+	X(SetAttributeFloatArrayData) \
+	X(SetAttributeFloatData) \
+	X(SetAttributeInt16ArrayData) \
+	X(SetAttributeInt16Data) \
+	X(SetAttributeInt64ArrayData) \
+	X(SetAttributeInt64Data) \
+	X(SetAttributeInt8ArrayData) \
+	X(SetAttributeInt8Data) \
+	X(SetAttributeIntArrayData) \
+	X(SetAttributeIntData) \
+	X(SetAttributeStringArrayData) \
+	X(SetAttributeStringData) \
+	X(SetAttributeUInt8ArrayData) \
+	X(SetAttributeUInt8Data) \
+	X(SetCacheProperty) \
+	X(SetCompositorOptions) \
+	X(SetCurveCounts) \
+	X(SetCurveInfo) \
+	X(SetCurveKnots) \
+	X(SetCurveOrders) \
+	X(SetCustomString) \
+	X(SetFaceCounts) \
+	X(SetGroupMembership) \
+	X(SetHeightFieldData) \
+	X(SetImageInfo) \
+	X(SetInputCurveInfo) \
+	X(SetInputCurvePositions) \
+	X(SetInputCurvePositionsRotationsScales) \
+	X(SetNodeDisplay) \
+	X(SetObjectTransform) \
+	X(SetParmExpression) \
+	X(SetParmFloatValue) \
+	X(SetParmFloatValues) \
+	X(SetParmIntValue) \
+	X(SetParmIntValues) \
+	X(SetParmNodeValue) \
+	X(SetParmStringValue) \
+	X(SetPartInfo) \
+	X(SetPreset) \
+	X(SetServerEnvInt) \
+	X(SetServerEnvString) \
+	X(SetSessionSync) \
+	X(SetSessionSyncInfo) \
+	X(SetTime) \
+	X(SetTimelineOptions) \
+	X(SetTransformAnimCurve) \
+	X(SetUseHoudiniTime) \
+	X(SetVertexList) \
+	X(SetViewport) \
+	X(SetVolumeInfo) \
+	X(SetVolumeTileFloatData) \
+	X(SetVolumeTileIntData) \
+	X(SetVolumeVoxelFloatData) \
+	X(SetVolumeVoxelIntData) \
+	X(SetWorkitemFloatData) \
+	X(SetWorkitemIntData) \
+	X(SetWorkitemStringData) \
+	X(StartThriftNamedPipeServer) \
+	X(StartThriftSocketServer)
+
+enum EHoudiniApiTraceFunction : int32
+{
+#define HOUDINI_API_TRACE_ENUM(Name) HoudiniApiTrace_##Name,
+	HOUDINI_API_TRACED_FUNCTIONS(HOUDINI_API_TRACE_ENUM)
+#undef HOUDINI_API_TRACE_ENUM
+	HoudiniApiTrace_Count
+};
+
+static const TCHAR* HoudiniApiTraceFunctionNames[] =
+{
+#define HOUDINI_API_TRACE_NAME(Name) TEXT("HAPI_") TEXT(#Name),
+	HOUDINI_API_TRACED_FUNCTIONS(HOUDINI_API_TRACE_NAME)
+#undef HOUDINI_API_TRACE_NAME
+};
+
+const FString FHoudiniApiTrace::UnattributedOwnerName = TEXT("Unattributed");
+
+// The calls made by one owner, indexed by EHoudiniApiTraceFunction
+struct FHoudiniApiTraceOwnerStats
+{
+	// Display name of the owner, for the CSV and log output
+	FString OwnerName;
+	// Calls since the last reset, written to the CSV summary
+	FHoudiniApiCallStats Calls[HoudiniApiTrace_Count];
+	// Calls since the owner's current cook started
+	FHoudiniApiCallStats CookCalls[HoudiniApiTrace_Count];
+};
+
+static bool bHoudiniApiTraceEnabled = false;
+static FCriticalSection HoudiniApiTraceLock;
+// Keyed by the owners' path name
+static TMap<FString, TUniquePtr<FHoudiniApiTraceOwnerStats>> HoudiniApiTraceStats;
+static thread_local const FString* HoudiniApiTraceCurrentOwnerPath = nullptr;
+static thread_local const FString* HoudiniApiTraceCurrentOwnerName = nullptr;
+
+// Estimates the size of the data moved by a call.
+// Array functions end with (T* data, int start, int length), other functions count as 0 bytes.
+static int64 HoudiniApiTraceBytes() { return 0; }
+template<typename A> static int64 HoudiniApiTraceBytes(A) { return 0; }
+template<typename A, typename B> static int64 HoudiniApiTraceBytes(A, B) { return 0; }
+template<typename A, typename B, typename C> static int64 HoudiniApiTraceBytes(A, B, C) { return 0; }
+
+template<typename T>
+static int64 HoudiniApiTraceBytes(T* InData, int InStart, int InLength)
+{
+	return InLength > 0 ? (int64)InLength * sizeof(T) : 0;
+}
+
+template<typename A, typename B, typename C, typename D, typename... TRest>
+static int64 HoudiniApiTraceBytes(A, B InB, C InC, D InD, TRest... InRest)
+{
+	return HoudiniApiTraceBytes(InB, InC, InD, InRest...);
+}
+
+static void
+HoudiniApiTraceRecord(const int32& InFunction, const HAPI_Result& InResult, const double& InSeconds, const int64& InBytes)
+{
+	const FString& OwnerPath = HoudiniApiTraceCurrentOwnerPath ? *HoudiniApiTraceCurrentOwnerPath : FHoudiniApiTrace::UnattributedOwnerName;
+
+	FScopeLock ScopeLock(&HoudiniApiTraceLock);
+	TUniquePtr<FHoudiniApiTraceOwnerStats>& OwnerStats = HoudiniApiTraceStats.FindOrAdd(OwnerPath);
+	if (!OwnerStats.IsValid())
+	{
+		OwnerStats = MakeUnique<FHoudiniApiTraceOwnerStats>();
+		OwnerStats->OwnerName = HoudiniApiTraceCurrentOwnerName ? *HoudiniApiTraceCurrentOwnerName : FHoudiniApiTrace::UnattributedOwnerName;
+	}
+
+	for (FHoudiniApiCallStats* CallStats : { &OwnerStats->Calls[InFunction], &OwnerStats->CookCalls[InFunction] })
+	{
+		CallStats->NumCalls++;
+		if (InResult != HAPI_RESULT_SUCCESS)
+			CallStats->NumFailures++;
+		CallStats->NumBytes += InBytes;
+		CallStats->TotalSeconds += InSeconds;
+		CallStats->MaxSeconds = FMath::Max(CallStats->MaxSeconds, InSeconds);
+	}
+}
+
+// Wraps one FHoudiniApi function, the original pointer is kept per function
+template<int32 FunctionIndex, typename TFuncPtr>
+struct THoudiniApiTraceWrapper;
+
+template<int32 FunctionIndex, typename... TArgs>
+struct THoudiniApiTraceWrapper<FunctionIndex, HAPI_Result(*)(TArgs...)>
+{
+	static HAPI_Result(*Original)(TArgs...);
+
+	static HAPI_Result Call(TArgs... Args)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR(HoudiniApiTraceFunctionNames[FunctionIndex]);
+
+		const double StartTime = FPlatformTime::Seconds();
+		const HAPI_Result Result = Original(Args...);
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		const int64 Bytes = HoudiniApiTraceBytes(Args...);
+		TRACE_COUNTER_ADD(HoudiniEngineHapiBytes, Bytes);
+		HoudiniApiTraceRecord(FunctionIndex, Result, Seconds, Bytes);
+
+		return Result;
+	}
+};
+
+template<int32 FunctionIndex, typename... TArgs>
+HAPI_Result(*THoudiniApiTraceWrapper<FunctionIndex, HAPI_Result(*)(TArgs...)>::Original)(TArgs...) = nullptr;
+
+#define HOUDINI_API_TRACE_WRAPPER(Name) THoudiniApiTraceWrapper<HoudiniApiTrace_##Name, FHoudiniApi::Name##FuncPtr>
+
+// Groups the functions to separate cooking from data transfers in the summaries
+static const TCHAR*
+HoudiniApiTraceGetCategory(const FString& InFunctionName)
+{
+	if (InFunctionName.Contains(TEXT("Cook")) || InFunctionName.StartsWith(TEXT("HAPI_GetStatus")))
+		return TEXT("Cook");
+
+	if (InFunctionName.Contains(TEXT("Attribute")))
+		return TEXT("Attributes");
+
+	if (InFunctionName.Contains(TEXT("Parm")) || InFunctionName.Contains(TEXT("Parameter")) || InFunctionName.Contains(TEXT("Preset")))
+		return TEXT("Parameters");
+
+	if (InFunctionName.Contains(TEXT("String")))
+		return TEXT("Strings");
+
+	static const TCHAR* GeometryTokens[] = {
+		TEXT("Face"), TEXT("Vertex"), TEXT("Part"), TEXT("Geo"), TEXT("Volume"), TEXT("HeightField"), TEXT("Voxel"),
+		TEXT("Curve"), TEXT("Group"), TEXT("Instance"), TEXT("Box"), TEXT("Sphere"), TEXT("Material"), TEXT("Image") };
+	for (const TCHAR* Token : GeometryTokens)
+	{
+		if (InFunctionName.Contains(Token))
+			return TEXT("Geometry");
+	}
+
+	if (InFunctionName.Contains(TEXT("Node")) || InFunctionName.Contains(TEXT("Object")) || InFunctionName.Contains(TEXT("Asset")))
+		return TEXT("Nodes");
+
+	return TEXT("Other");
+}
+
+bool
+FHoudiniApiTrace::Enable()
+{
+	if (bHoudiniApiTraceEnabled)
+		return true;
+
+	if (!FHoudiniApi::IsHAPIInitialized())
+		return false;
+
+#define HOUDINI_API_TRACE_INSTALL(Name) \
+	HOUDINI_API_TRACE_WRAPPER(Name)::Original = FHoudiniApi::Name; \
+	FHoudiniApi::Name = &HOUDINI_API_TRACE_WRAPPER(Name)::Call;
+	HOUDINI_API_TRACED_FUNCTIONS(HOUDINI_API_TRACE_INSTALL)
+#undef HOUDINI_API_TRACE_INSTALL
+
+	bHoudiniApiTraceEnabled = true;
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI call tracing enabled."));
+
+	return true;
+}
+
+void
+FHoudiniApiTrace::Disable()
+{
+	if (!bHoudiniApiTraceEnabled)
+		return;
+
+	// Only restore the functions that are still wrapped
+#define HOUDINI_API_TRACE_UNINSTALL(Name) \
+	if (FHoudiniApi::Name == &HOUDINI_API_TRACE_WRAPPER(Name)::Call) \
+		FHoudiniApi::Name = HOUDINI_API_TRACE_WRAPPER(Name)::Original;
+	HOUDINI_API_TRACED_FUNCTIONS(HOUDINI_API_TRACE_UNINSTALL)
+#undef HOUDINI_API_TRACE_UNINSTALL
+
+	bHoudiniApiTraceEnabled = false;
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI call tracing disabled."));
+}
+
+bool
+FHoudiniApiTrace::IsEnabled()
+{
+	return bHoudiniApiTraceEnabled;
+}
+
+void
+FHoudiniApiTrace::OnHAPIInitialized()
+{
+	if (CVarHoudiniEngineTraceHapiCalls->GetInt() != 0)
+		Enable();
+}
+
+void
+FHoudiniApiTrace::OnHAPIFinalized()
+{
+	Disable();
+}
+
+void
+FHoudiniApiTrace::Reset()
+{
+	FScopeLock ScopeLock(&HoudiniApiTraceLock);
+	HoudiniApiTraceStats.Empty();
+}
+
+void
+FHoudiniApiTrace::ResetOwnerCook(const UHoudiniAssetComponent* InHAC)
+{
+	if (!IsValid(InHAC))
+		return;
+
+	const FString OwnerPath = InHAC->GetPathName();
+
+	FScopeLock ScopeLock(&HoudiniApiTraceLock);
+	TUniquePtr<FHoudiniApiTraceOwnerStats>* OwnerStats = HoudiniApiTraceStats.Find(OwnerPath);
+	if (!OwnerStats || !OwnerStats->IsValid())
+		return;
+
+	for (FHoudiniApiCallStats& CallStats : (*OwnerStats)->CookCalls)
+		CallStats = FHoudiniApiCallStats();
+}
+
+bool
+FHoudiniApiTrace::GetOwnerStats(const UHoudiniAssetComponent* InHAC, FHoudiniEngineOutputStats& OutStats)
+{
+	if (!IsValid(InHAC))
+		return false;
+
+	const FString OwnerPath = InHAC->GetPathName();
+
+	FScopeLock ScopeLock(&HoudiniApiTraceLock);
+	const TUniquePtr<FHoudiniApiTraceOwnerStats>* OwnerStats = HoudiniApiTraceStats.Find(OwnerPath);
+	if (!OwnerStats || !OwnerStats->IsValid())
+		return false;
+
+	for (int32 FunctionIdx = 0; FunctionIdx < HoudiniApiTrace_Count; FunctionIdx++)
+	{
+		const FHoudiniApiCallStats& CallStats = (*OwnerStats)->CookCalls[FunctionIdx];
+		if (CallStats.NumCalls > 0)
+			OutStats.NotifyHapiCalls(HoudiniApiTraceFunctionNames[FunctionIdx], CallStats);
+	}
+
+	return true;
+}
+
+void
+FHoudiniApiTrace::LogOwnerSummary(const UHoudiniAssetComponent* InHAC, const FHoudiniEngineOutputStats& InStats)
+{
+	if (!IsValid(InHAC) || InStats.HapiCalls.Num() <= 0)
+		return;
+
+	TMap<FString, FHoudiniApiCallStats> CategoryStats;
+	for (const auto& CurrentCall : InStats.HapiCalls)
+		CategoryStats.FindOrAdd(HoudiniApiTraceGetCategory(CurrentCall.Key)).Add(CurrentCall.Value);
+
+	FString Summary;
+	for (const auto& CurrentCategory : CategoryStats)
+	{
+		Summary += FString::Printf(TEXT("\n    %s: %lld calls, %.2fms, %.2fMB"),
+			*CurrentCategory.Key, CurrentCategory.Value.NumCalls, CurrentCategory.Value.TotalSeconds * 1000.0,
+			CurrentCategory.Value.NumBytes / (1024.0 * 1024.0));
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI calls for %s during its last cook:%s"), *InHAC->GetDisplayName(), *Summary);
+}
+
+bool
+FHoudiniApiTrace::WriteCSVSummary(const FString& InFilePath)
+{
+	FString CSV = TEXT("Owner,OwnerPath,Function,Category,Calls,Failures,Bytes,TotalMs,AverageMs,MaxMs\n");
+	{
+		FScopeLock ScopeLock(&HoudiniApiTraceLock);
+		for (const auto& CurrentOwner : HoudiniApiTraceStats)
+		{
+			if (!CurrentOwner.Value.IsValid())
+				continue;
+
+			for (int32 FunctionIdx = 0; FunctionIdx < HoudiniApiTrace_Count; FunctionIdx++)
+			{
+				const FHoudiniApiCallStats& CallStats = CurrentOwner.Value->Calls[FunctionIdx];
+				if (CallStats.NumCalls <= 0)
+					continue;
+
+				const FString FunctionName = HoudiniApiTraceFunctionNames[FunctionIdx];
+				CSV += FString::Printf(TEXT("\"%s\",\"%s\",%s,%s,%lld,%lld,%lld,%.3f,%.4f,%.3f\n"),
+					*CurrentOwner.Value->OwnerName.Replace(TEXT("\""), TEXT("\"\"")), *CurrentOwner.Key.Replace(TEXT("\""), TEXT("\"\"")),
+					*FunctionName, HoudiniApiTraceGetCategory(FunctionName),
+					CallStats.NumCalls, CallStats.NumFailures, CallStats.NumBytes,
+					CallStats.TotalSeconds * 1000.0, CallStats.TotalSeconds * 1000.0 / CallStats.NumCalls, CallStats.MaxSeconds * 1000.0);
+			}
+		}
+	}
+
+	return FFileHelper::SaveStringToFile(CSV, *InFilePath);
+}
+
+FString
+FHoudiniApiTrace::GetDefaultCSVPath()
+{
+	return FPaths::Combine(FPaths::ProfilingDir(), TEXT("HoudiniEngine"),
+		FString::Printf(TEXT("HapiTrace-%s.csv"), *FDateTime::Now().ToString()));
+}
+
+static void
+HoudiniApiTraceOnCVarChanged(IConsoleVariable* InVariable)
+{
+	if (InVariable->GetInt() != 0)
+	{
+		if (!FHoudiniApiTrace::Enable())
+			HOUDINI_LOG_WARNING(TEXT("HAPI call tracing will start once HAPI is initialized."));
+	}
+	else
+	{
+		FHoudiniApiTrace::Disable();
+	}
+}
+
+static void
+HoudiniApiTraceDump(const TArray<FString>& InArgs)
+{
+	const FString FilePath = InArgs.Num() > 0 ? InArgs[0] : FHoudiniApiTrace::GetDefaultCSVPath();
+	if (FHoudiniApiTrace::WriteCSVSummary(FilePath))
+		HOUDINI_LOG_MESSAGE(TEXT("HAPI call trace written to %s"), *FilePath);
+	else
+		HOUDINI_LOG_WARNING(TEXT("Failed to write the HAPI call trace to %s"), *FilePath);
+}
+
+FHoudiniApiTraceOwnerScope::FHoudiniApiTraceOwnerScope(const UHoudiniAssetComponent* InHAC)
+	: PreviousOwnerPath(nullptr)
+	, PreviousOwnerName(nullptr)
+	, bPushed(false)
+{
+	// Only get the names when tracing
+	if (FHoudiniApiTrace::IsEnabled() && IsValid(InHAC))
+		Push(InHAC->GetPathName(), InHAC->GetDisplayName());
+}
+
+FHoudiniApiTraceOwnerScope::FHoudiniApiTraceOwnerScope(const FString& InOwnerPath, const FString& InOwnerName)
+	: PreviousOwnerPath(nullptr)
+	, PreviousOwnerName(nullptr)
+	, bPushed(false)
+{
+	if (FHoudiniApiTrace::IsEnabled() && !InOwnerPath.IsEmpty())
+		Push(InOwnerPath, InOwnerName);
+}
+
+FHoudiniApiTraceOwnerScope::~FHoudiniApiTraceOwnerScope()
+{
+	if (bPushed)
+	{
+		HoudiniApiTraceCurrentOwnerPath = PreviousOwnerPath;
+		HoudiniApiTraceCurrentOwnerName = PreviousOwnerName;
+	}
+}
+
+void
+FHoudiniApiTraceOwnerScope::Push(const FString& InOwnerPath, const FString& InOwnerName)
+{
+	OwnerPath = InOwnerPath;
+	OwnerName = InOwnerName;
+	PreviousOwnerPath = HoudiniApiTraceCurrentOwnerPath;
+	PreviousOwnerName = HoudiniApiTraceCurrentOwnerName;
+	HoudiniApiTraceCurrentOwnerPath = &OwnerPath;
+	HoudiniApiTraceCurrentOwnerName = &OwnerName;
+	bPushed = true;
+}
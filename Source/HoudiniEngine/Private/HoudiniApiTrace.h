@@ -0,0 +1,96 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UHoudiniAssetComponent;
+struct FHoudiniEngineOutputStats;
+
+/**
+ * Optional instrumentation of the HAPI calls.
+ * When enabled (HoudiniEngine.TraceHapiCalls 1), the FHoudiniApi function pointers are wrapped
+ * to record the number of calls, the latency and the size of the arrays moved by each function,
+ * per Houdini Asset Component. Each call is also emitted as an Unreal Insights CPU event.
+ * Calls are attributed to the component set by the innermost FHoudiniApiTraceOwnerScope on the calling thread.
+ * Owners are identified by their path name, their display name is only used for the CSV and log output.
+ */
+struct HOUDINIENGINE_API FHoudiniApiTrace
+{
+	public:
+
+		// Wraps the FHoudiniApi function pointers, HAPI must be initialized
+		static bool Enable();
+		// Restores the FHoudiniApi function pointers
+		static void Disable();
+
+		static bool IsEnabled();
+
+		// Re-applies the tracing after HAPI has been (re)initialized, if it is requested
+		static void OnHAPIInitialized();
+		// Must be called before HAPI is finalized
+		static void OnHAPIFinalized();
+
+		// Clears all the recorded stats
+		static void Reset();
+
+		// Clears the calls attributed to a component's current cook, called when the component starts a new cook
+		static void ResetOwnerCook(const UHoudiniAssetComponent* InHAC);
+
+		// Adds the calls made for a component's current cook to the stats, returns false if none were recorded
+		static bool GetOwnerStats(const UHoudiniAssetComponent* InHAC, FHoudiniEngineOutputStats& OutStats);
+
+		// Logs the cost of the HAPI calls of a component's cook stats per category (cook, attributes, geometry...)
+		static void LogOwnerSummary(const UHoudiniAssetComponent* InHAC, const FHoudiniEngineOutputStats& InStats);
+
+		// Writes the recorded stats as CSV, one line per owner and function
+		static bool WriteCSVSummary(const FString& InFilePath);
+
+		// Default path for the CSV summary, in the profiling folder
+		static FString GetDefaultCSVPath();
+
+		// Name used for calls made outside of an owner scope
+		static const FString UnattributedOwnerName;
+};
+
+// Attributes the HAPI calls made on this thread to a component or task for the duration of a scope
+struct HOUDINIENGINE_API FHoudiniApiTraceOwnerScope
+{
+	FHoudiniApiTraceOwnerScope(const UHoudiniAssetComponent* InHAC);
+	// InOwnerPath identifies the owner, InOwnerName is its display name
+	FHoudiniApiTraceOwnerScope(const FString& InOwnerPath, const FString& InOwnerName);
+	~FHoudiniApiTraceOwnerScope();
+
+	private:
+		void Push(const FString& InOwnerPath, const FString& InOwnerName);
+
+		FString OwnerPath;
+		FString OwnerName;
+		const FString* PreviousOwnerPath;
+		const FString* PreviousOwnerName;
+		bool bPushed;
+};
@@ -0,0 +1,312 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniAssetLibraryRegistry.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/SecureHash.h"
+#include "UObject/UObjectIterator.h"
+
+TMap<FString, FHoudiniAssetLibraryRegistry::FLoadedLibrary> FHoudiniAssetLibraryRegistry::LoadedLibraries;
+TMap<TWeakObjectPtr<const UHoudiniAsset>, FHoudiniAssetLibraryRegistry::FAssetBytesHash> FHoudiniAssetLibraryRegistry::AssetBytesHashes;
+TArray<TWeakObjectPtr<const UHoudiniAsset>> FHoudiniAssetLibraryRegistry::PendingPrewarm;
+int32 FHoudiniAssetLibraryRegistry::NumLibraryLoads = 0;
+int32 FHoudiniAssetLibraryRegistry::NumLibraryReuses = 0;
+double FHoudiniAssetLibraryRegistry::LibraryLoadSeconds = 0.0;
+
+FString
+FHoudiniAssetLibraryRegistry::GetAssetBytesHash(const UHoudiniAsset* InHoudiniAsset)
+{
+	if (!IsValid(InHoudiniAsset) || InHoudiniAsset->GetAssetBytesCount() <= 0)
+		return FString();
+
+	// The bytes are replaced when the asset is reimported
+	FAssetBytesHash& CachedHash = AssetBytesHashes.FindOrAdd(InHoudiniAsset);
+	if (CachedHash.Hash.IsEmpty()
+		|| CachedHash.AssetBytes != InHoudiniAsset->GetAssetBytes()
+		|| CachedHash.AssetBytesCount != InHoudiniAsset->GetAssetBytesCount())
+	{
+		FMD5 Md5;
+		Md5.Update(InHoudiniAsset->GetAssetBytes(), InHoudiniAsset->GetAssetBytesCount());
+		FMD5Hash Hash;
+		Hash.Set(Md5);
+
+		CachedHash.AssetBytes = InHoudiniAsset->GetAssetBytes();
+		CachedHash.AssetBytesCount = InHoudiniAsset->GetAssetBytesCount();
+		CachedHash.Hash = LexToString(Hash);
+	}
+
+	return CachedHash.Hash;
+}
+
+FString
+FHoudiniAssetLibraryRegistry::GetLibraryKey(const UHoudiniAsset* InHoudiniAsset, const FString& InAssetFileName)
+{
+	FString Key = GetAssetBytesHash(InHoudiniAsset);
+
+	// The library can also be loaded from its source file, which can be modified without reimporting the asset
+	if (!InAssetFileName.IsEmpty())
+	{
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*InAssetFileName);
+		if (StatData.bIsValid && StatData.bIsDirectory)
+		{
+			// Expanded HDAs are directories, whose own size and timestamp don't change when the files they contain are edited.
+			// Use the number of files, their total size and the newest modification time instead.
+			int32 NumFiles = 0;
+			int64 TotalSize = 0;
+			FDateTime NewestModificationTime = StatData.ModificationTime;
+			IFileManager::Get().IterateDirectoryStatRecursively(*InAssetFileName, [&](const TCHAR* InPath, const FFileStatData& InStatData)
+			{
+				if (!InStatData.bIsDirectory)
+				{
+					NumFiles++;
+					TotalSize += InStatData.FileSize;
+				}
+
+				if (InStatData.ModificationTime > NewestModificationTime)
+					NewestModificationTime = InStatData.ModificationTime;
+
+				return true;
+			});
+
+			Key += FString::Printf(TEXT("|%s|%d|%lld|%lld"), *InAssetFileName, NumFiles, TotalSize, NewestModificationTime.GetTicks());
+		}
+		else if (StatData.bIsValid)
+		{
+			Key += FString::Printf(TEXT("|%s|%lld|%lld"), *InAssetFileName, StatData.FileSize, StatData.ModificationTime.GetTicks());
+		}
+	}
+
+	return Key;
+}
+
+bool
+FHoudiniAssetLibraryRegistry::FindLoadedLibrary(
+	const UHoudiniAsset* InHoudiniAsset, const FString& InAssetFileName, HAPI_AssetLibraryId& OutAssetLibraryId)
+{
+	if (!IsValid(InHoudiniAsset) || LoadedLibraries.Num() <= 0)
+		return false;
+
+	const FString Key = GetLibraryKey(InHoudiniAsset, InAssetFileName);
+	if (Key.IsEmpty())
+		return false;
+
+	FLoadedLibrary* LoadedLibrary = LoadedLibraries.Find(Key);
+	if (!LoadedLibrary)
+		return false;
+
+	// Make sure the library is still in the session
+	int32 AssetCount = 0;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAvailableAssetCount(
+		FHoudiniEngine::Get().GetSession(), LoadedLibrary->AssetLibraryId, &AssetCount) || AssetCount <= 0)
+	{
+		LoadedLibraries.Remove(Key);
+		return false;
+	}
+
+	LoadedLibrary->HoudiniAssets.AddUnique(InHoudiniAsset);
+	OutAssetLibraryId = LoadedLibrary->AssetLibraryId;
+	NumLibraryReuses++;
+
+	return true;
+}
+
+void
+FHoudiniAssetLibraryRegistry::RegisterLoadedLibrary(
+	const UHoudiniAsset* InHoudiniAsset, const FString& InAssetFileName, const HAPI_AssetLibraryId& InAssetLibraryId, const double& InLoadSeconds)
+{
+	if (!IsValid(InHoudiniAsset) || InAssetLibraryId < 0)
+		return;
+
+	NumLibraryLoads++;
+	LibraryLoadSeconds += InLoadSeconds;
+
+	const FString Key = GetLibraryKey(InHoudiniAsset, InAssetFileName);
+	if (Key.IsEmpty())
+		return;
+
+	FLoadedLibrary NewLibrary;
+	NewLibrary.AssetLibraryId = InAssetLibraryId;
+	NewLibrary.HoudiniAssets.Add(InHoudiniAsset);
+
+	TArray<HAPI_StringHandle> AssetNameHandles;
+	if (FHoudiniEngineUtils::GetSubAssetNames(InAssetLibraryId, AssetNameHandles))
+		FHoudiniEngineString::SHArrayToFStringArray(AssetNameHandles, NewLibrary.AssetNames);
+
+	// The library has been loaded with overwrite allowed: other libraries that define the same
+	// assets now point to this library's definitions, forget them so they get reloaded when needed
+	for (auto It = LoadedLibraries.CreateIterator(); It; ++It)
+	{
+		if (It->Key == Key)
+			continue;
+
+		for (const FString& AssetName : It->Value.AssetNames)
+		{
+			if (NewLibrary.AssetNames.Contains(AssetName))
+			{
+				It.RemoveCurrent();
+				break;
+			}
+		}
+	}
+
+	LoadedLibraries.Add(Key, MoveTemp(NewLibrary));
+}
+
+void
+FHoudiniAssetLibraryRegistry::Reset()
+{
+	if (NumLibraryLoads > 0 || NumLibraryReuses > 0)
+		LogStats();
+
+	// Prewarm the same libraries in the next session
+	for (const auto& Pair : LoadedLibraries)
+	{
+		for (const TWeakObjectPtr<const UHoudiniAsset>& HoudiniAsset : Pair.Value.HoudiniAssets)
+		{
+			if (HoudiniAsset.IsValid())
+				PendingPrewarm.AddUnique(HoudiniAsset);
+		}
+	}
+
+	LoadedLibraries.Empty();
+	NumLibraryLoads = 0;
+	NumLibraryReuses = 0;
+	LibraryLoadSeconds = 0.0;
+}
+
+void
+FHoudiniAssetLibraryRegistry::RequestPrewarm(const TArray<const UHoudiniAsset*>& InHoudiniAssets)
+{
+	TArray<const UHoudiniAsset*> AssetsToHash;
+	for (const UHoudiniAsset* HoudiniAsset : InHoudiniAssets)
+	{
+		if (!IsValid(HoudiniAsset))
+			continue;
+
+		PendingPrewarm.AddUnique(HoudiniAsset);
+
+		const FAssetBytesHash* CachedHash = AssetBytesHashes.Find(HoudiniAsset);
+		if (!CachedHash || CachedHash->AssetBytes != HoudiniAsset->GetAssetBytes())
+			AssetsToHash.AddUnique(HoudiniAsset);
+	}
+
+	// Hash the assets in parallel now, so that it is not done when they get instantiated
+	TArray<FAssetBytesHash> Hashes;
+	Hashes.SetNum(AssetsToHash.Num());
+	ParallelFor(AssetsToHash.Num(), [&AssetsToHash, &Hashes](int32 Idx)
+	{
+		const UHoudiniAsset* HoudiniAsset = AssetsToHash[Idx];
+		if (HoudiniAsset->GetAssetBytesCount() <= 0)
+			return;
+
+		FMD5 Md5;
+		Md5.Update(HoudiniAsset->GetAssetBytes(), HoudiniAsset->GetAssetBytesCount());
+		FMD5Hash Hash;
+		Hash.Set(Md5);
+
+		Hashes[Idx].AssetBytes = HoudiniAsset->GetAssetBytes();
+		Hashes[Idx].AssetBytesCount = HoudiniAsset->GetAssetBytesCount();
+		Hashes[Idx].Hash = LexToString(Hash);
+	});
+
+	for (int32 Idx = 0; Idx < AssetsToHash.Num(); Idx++)
+	{
+		if (!Hashes[Idx].Hash.IsEmpty())
+			AssetBytesHashes.Add(AssetsToHash[Idx], Hashes[Idx]);
+	}
+}
+
+void
+FHoudiniAssetLibraryRegistry::PrewarmWorld(UWorld* InWorld)
+{
+	if (!IsValid(InWorld))
+		return;
+
+	TArray<const UHoudiniAsset*> HoudiniAssets;
+	for (TObjectIterator<UHoudiniAssetComponent> It; It; ++It)
+	{
+		UHoudiniAssetComponent* HAC = *It;
+		if (!IsValid(HAC) || HAC->GetWorld() != InWorld)
+			continue;
+
+		const UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
+		if (IsValid(HoudiniAsset))
+			HoudiniAssets.AddUnique(HoudiniAsset);
+	}
+
+	if (HoudiniAssets.Num() <= 0)
+		return;
+
+	HOUDINI_LOG_MESSAGE(TEXT("Prewarming %d asset libraries for %s."), HoudiniAssets.Num(), *InWorld->GetName());
+	RequestPrewarm(HoudiniAssets);
+}
+
+void
+FHoudiniAssetLibraryRegistry::LoadPendingPrewarm()
+{
+	if (PendingPrewarm.Num() <= 0 || !FHoudiniEngine::Get().GetSession())
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniAssetLibraryRegistry::LoadPendingPrewarm);
+
+	TArray<TWeakObjectPtr<const UHoudiniAsset>> AssetsToLoad = MoveTemp(PendingPrewarm);
+	PendingPrewarm.Empty();
+	for (const TWeakObjectPtr<const UHoudiniAsset>& HoudiniAsset : AssetsToLoad)
+	{
+		if (!HoudiniAsset.IsValid())
+			continue;
+
+		// Registers the library, or finds it if it has already been loaded
+		HAPI_AssetLibraryId AssetLibraryId = -1;
+		if (!FHoudiniEngineUtils::LoadHoudiniAsset(HoudiniAsset.Get(), AssetLibraryId))
+		{
+			// The session is gone, try again in the next one
+			if (!FHoudiniEngine::Get().GetSession())
+			{
+				PendingPrewarm = AssetsToLoad;
+				return;
+			}
+		}
+	}
+}
+
+void
+FHoudiniAssetLibraryRegistry::LogStats()
+{
+	HOUDINI_LOG_MESSAGE(TEXT("Asset libraries: %d loaded (%.2fs), %d reused."),
+		NumLibraryLoads, LibraryLoadSeconds, NumLibraryReuses);
+}
@@ -0,0 +1,114 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+
+class UHoudiniAsset;
+class UWorld;
+
+/**
+ * Keeps track of the asset libraries loaded in the current session.
+ * Libraries are identified by the content of their UHoudiniAsset (a hash of the asset's bytes,
+ * and the size/timestamp of the source file, or of the files inside an expanded HDA's directory),
+ * so each unique library is only loaded once per session,
+ * no matter how many components instantiate it.
+ * The libraries used by a level can also be prewarmed: their hashes are computed when the level is opened,
+ * and they are loaded as soon as the session is ready, before the first component gets instantiated.
+ */
+struct HOUDINIENGINE_API FHoudiniAssetLibraryRegistry
+{
+	public:
+
+		// Returns the id of the library if the asset's content is already loaded in the current session
+		static bool FindLoadedLibrary(
+			const UHoudiniAsset* InHoudiniAsset, const FString& InAssetFileName, HAPI_AssetLibraryId& OutAssetLibraryId);
+
+		// Records a library that has just been loaded for an asset.
+		// Libraries defining the same assets are forgotten, as loading a library overwrites their definitions.
+		static void RegisterLoadedLibrary(
+			const UHoudiniAsset* InHoudiniAsset, const FString& InAssetFileName, const HAPI_AssetLibraryId& InAssetLibraryId, const double& InLoadSeconds);
+
+		// Forgets the loaded libraries, must be called when the session is stopped or lost.
+		// The assets are queued to be prewarmed in the next session.
+		static void Reset();
+
+		// Computes the hashes of the assets now, and queues them to be loaded when a session is available
+		static void RequestPrewarm(const TArray<const UHoudiniAsset*>& InHoudiniAssets);
+
+		// Requests the prewarm of the assets used by the Houdini Asset Components of a world
+		static void PrewarmWorld(UWorld* InWorld);
+
+		// Loads the queued libraries, if the session is valid
+		static void LoadPendingPrewarm();
+
+		static bool HasPendingPrewarm() { return PendingPrewarm.Num() > 0; };
+
+		// Logs the number of libraries loaded and reused in the current session
+		static void LogStats();
+
+	protected:
+
+		// Returns the key identifying the content of an asset's library
+		static FString GetLibraryKey(const UHoudiniAsset* InHoudiniAsset, const FString& InAssetFileName);
+
+		// Returns the hash of the asset's bytes, only recomputed when the bytes have changed
+		static FString GetAssetBytesHash(const UHoudiniAsset* InHoudiniAsset);
+
+	protected:
+
+		struct FLoadedLibrary
+		{
+			HAPI_AssetLibraryId AssetLibraryId = -1;
+			// Names of the assets defined by the library
+			TArray<FString> AssetNames;
+			// Assets that use this library, to prewarm them in the next session
+			TArray<TWeakObjectPtr<const UHoudiniAsset>> HoudiniAssets;
+		};
+
+		struct FAssetBytesHash
+		{
+			const void* AssetBytes = nullptr;
+			int32 AssetBytesCount = 0;
+			FString Hash;
+		};
+
+		// Loaded libraries, per key
+		static TMap<FString, FLoadedLibrary> LoadedLibraries;
+
+		// Cached hashes of the assets' bytes
+		static TMap<TWeakObjectPtr<const UHoudiniAsset>, FAssetBytesHash> AssetBytesHashes;
+
+		// Assets waiting to be loaded in the session
+		static TArray<TWeakObjectPtr<const UHoudiniAsset>> PendingPrewarm;
+
+		// Stats for the current session
+		static int32 NumLibraryLoads;
+		static int32 NumLibraryReuses;
+		static double LibraryLoadSeconds;
+};
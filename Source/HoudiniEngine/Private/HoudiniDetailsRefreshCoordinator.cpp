@@ -0,0 +1,399 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniDetailsRefreshCoordinator.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniInput.h"
+#include "HoudiniOutput.h"
+#include "HoudiniParameter.h"
+#include "HoudiniParameterFloat.h"
+#include "HoudiniParameterInt.h"
+#include "HoudiniPDGAssetLink.h"
+#include "HoudiniStaticMesh.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineDetailsRefreshMode(
+	TEXT("HoudiniEngine.DetailsRefreshMode"),
+	1,
+	TEXT("How the details panels are refreshed after cooks and PDG updates.\n")
+	TEXT("0: Every request rebuilds the details panels immediately\n")
+	TEXT("1: Requests are coalesced per frame, and the panels are only rebuilt if the displayed rows have changed (default)\n"));
+
+static FAutoConsoleCommand CCmdHoudiniEngineLogDetailsRefreshStats(
+	TEXT("HoudiniEngine.LogDetailsRefreshStats"),
+	TEXT("Logs the number of details panel refreshes requested after cooks/PDG updates, how many required a rebuild and the time spent."),
+	FConsoleCommandDelegate::CreateStatic(&FHoudiniDetailsRefreshCoordinator::LogStats));
+
+static FAutoConsoleCommand CCmdHoudiniEngineResetDetailsRefreshStats(
+	TEXT("HoudiniEngine.ResetDetailsRefreshStats"),
+	TEXT("Clears the details panel refresh stats."),
+	FConsoleCommandDelegate::CreateStatic(&FHoudiniDetailsRefreshCoordinator::ResetStats));
+
+TMap<TWeakObjectPtr<UHoudiniAssetComponent>, bool> FHoudiniDetailsRefreshCoordinator::PendingComponents;
+TMap<TWeakObjectPtr<UHoudiniAssetComponent>, uint32> FHoudiniDetailsRefreshCoordinator::LastSignatures;
+FDelegateHandle FHoudiniDetailsRefreshCoordinator::TickerHandle;
+bool FHoudiniDetailsRefreshCoordinator::bIsFlushing = false;
+FHoudiniDetailsRefreshStats FHoudiniDetailsRefreshCoordinator::Stats;
+
+// Hashes the exported text of an object's properties.
+// Sub-objects owned by the object (ramp points...) are hashed with it.
+static uint32
+HoudiniHashObjectProperties(const UObject* InObject, const TSet<FName>& InSkippedProperties, uint32 InHash)
+{
+	if (!IsValid(InObject))
+		return HashCombine(InHash, 0);
+
+	InHash = HashCombine(InHash, GetTypeHash(InObject));
+
+	FString ValueString;
+	for (TFieldIterator<FProperty> It(InObject->GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (InSkippedProperties.Contains(Property->GetFName()))
+			continue;
+
+		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(InObject);
+
+		ValueString.Reset();
+		Property->ExportTextItem(ValueString, ValuePtr, nullptr, nullptr, PPF_None);
+		InHash = FCrc::StrCrc32(*ValueString, InHash);
+
+		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+		const FObjectPropertyBase* InnerProperty = ArrayProperty ? CastField<FObjectPropertyBase>(ArrayProperty->Inner) : nullptr;
+		if (!InnerProperty)
+			continue;
+
+		FScriptArrayHelper ArrayHelper(ArrayProperty, ValuePtr);
+		for (int32 Idx = 0; Idx < ArrayHelper.Num(); Idx++)
+		{
+			const UObject* SubObject = InnerProperty->GetObjectPropertyValue(ArrayHelper.GetRawPtr(Idx));
+			if (IsValid(SubObject) && SubObject->GetOuter() == InObject)
+				InHash = HoudiniHashObjectProperties(SubObject, InSkippedProperties, InHash);
+		}
+	}
+
+	return InHash;
+}
+
+static uint32
+HoudiniHashStaticMaterials(const TArray<FStaticMaterial>& InMaterials, uint32 InHash)
+{
+	for (const FStaticMaterial& Material : InMaterials)
+	{
+		InHash = HashCombine(InHash, GetTypeHash(Material.MaterialInterface));
+		InHash = HashCombine(InHash, GetTypeHash(Material.MaterialSlotName));
+	}
+
+	return InHash;
+}
+
+// The output details display the meshes' materials, which can change without the mesh itself being replaced
+static uint32
+HoudiniHashOutputObjectMaterials(const UObject* InObject, uint32 InHash)
+{
+	if (const UStaticMesh* StaticMesh = Cast<UStaticMesh>(InObject))
+		return HoudiniHashStaticMaterials(StaticMesh->GetStaticMaterials(), InHash);
+
+	if (const UHoudiniStaticMesh* ProxyMesh = Cast<UHoudiniStaticMesh>(InObject))
+		return HoudiniHashStaticMaterials(ProxyMesh->GetStaticMaterials(), InHash);
+
+	return InHash;
+}
+
+void
+FHoudiniDetailsRefreshCoordinator::RequestRefresh(UHoudiniAssetComponent* InHAC, const bool& bInForceFullRebuild)
+{
+	if (!IsValid(InHAC))
+		return;
+
+	if (!IsInGameThread())
+	{
+		// The details panels can only be refreshed on the game thread
+		TWeakObjectPtr<UHoudiniAssetComponent> WeakHAC(InHAC);
+		const bool bForceFullRebuild = bInForceFullRebuild;
+		AsyncTask(ENamedThreads::GameThread, [WeakHAC, bForceFullRebuild]()
+		{
+			FHoudiniDetailsRefreshCoordinator::RequestRefreshInternal(WeakHAC.Get(), bForceFullRebuild);
+		});
+	}
+	else
+	{
+		RequestRefreshInternal(InHAC, bInForceFullRebuild);
+	}
+}
+
+void
+FHoudiniDetailsRefreshCoordinator::RequestRefreshInternal(UHoudiniAssetComponent* InHAC, const bool& bInForceFullRebuild)
+{
+	if (!IsValid(InHAC))
+		return;
+
+	Stats.NumRequests++;
+
+	if (CVarHoudiniEngineDetailsRefreshMode.GetValueOnGameThread() == 0)
+	{
+		// Rebuild right away, as every request used to
+		const double StartTime = FPlatformTime::Seconds();
+		FHoudiniEngineUtils::UpdateEditorProperties(InHAC, true);
+		Stats.FullRebuildSeconds += FPlatformTime::Seconds() - StartTime;
+		Stats.NumFullRebuilds++;
+		return;
+	}
+
+	bool& bForceFullRebuild = PendingComponents.FindOrAdd(InHAC, false);
+	bForceFullRebuild |= bInForceFullRebuild;
+
+	if (!TickerHandle.IsValid())
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FHoudiniDetailsRefreshCoordinator::OnTick));
+}
+
+bool
+FHoudiniDetailsRefreshCoordinator::OnTick(float InDeltaTime)
+{
+	// The ticker is removed by returning false
+	TickerHandle.Reset();
+	Flush();
+	return false;
+}
+
+void
+FHoudiniDetailsRefreshCoordinator::Flush()
+{
+	if (PendingComponents.Num() <= 0)
+		return;
+
+	TMap<TWeakObjectPtr<UHoudiniAssetComponent>, bool> Pending = MoveTemp(PendingComponents);
+	PendingComponents.Reset();
+
+	TArray<UObject*> ComponentsToRebuild;
+	TArray<UObject*> ComponentsToUpdate;
+	TArray<TPair<UHoudiniAssetComponent*, uint32>> NewSignatures;
+
+	const double SignatureStartTime = FPlatformTime::Seconds();
+	for (const auto& Entry : Pending)
+	{
+		UHoudiniAssetComponent* HAC = Entry.Key.Get();
+		if (!IsValid(HAC))
+			continue;
+
+		const uint32 Signature = ComputeSignature(HAC);
+		const uint32* LastSignature = LastSignatures.Find(HAC);
+		if (Entry.Value || !LastSignature || *LastSignature != Signature)
+		{
+			ComponentsToRebuild.Add(HAC);
+			NewSignatures.Add(TPair<UHoudiniAssetComponent*, uint32>(HAC, Signature));
+		}
+		else
+		{
+			ComponentsToUpdate.Add(HAC);
+		}
+	}
+	Stats.SignatureSeconds += FPlatformTime::Seconds() - SignatureStartTime;
+
+	TGuardValue<bool> FlushingGuard(bIsFlushing, true);
+
+	if (ComponentsToRebuild.Num() > 0)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		FHoudiniEngineUtils::UpdateEditorProperties(ComponentsToRebuild, true);
+		Stats.FullRebuildSeconds += FPlatformTime::Seconds() - StartTime;
+		Stats.NumFullRebuilds += ComponentsToRebuild.Num();
+
+		for (const auto& NewSignature : NewSignatures)
+			LastSignatures.Add(NewSignature.Key, NewSignature.Value);
+	}
+
+	if (ComponentsToUpdate.Num() > 0)
+	{
+		// The rows are unchanged, the widgets only need to read their values again
+		const double StartTime = FPlatformTime::Seconds();
+		FHoudiniEngineUtils::UpdateEditorProperties(ComponentsToUpdate, false);
+		Stats.LightRefreshSeconds += FPlatformTime::Seconds() - StartTime;
+		Stats.NumLightRefreshes += ComponentsToUpdate.Num();
+	}
+
+	// Forget the destroyed components
+	for (auto It = LastSignatures.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniDetailsRefreshCoordinator::InvalidateSignature(UHoudiniAssetComponent* InHAC)
+{
+	if (bIsFlushing || !InHAC)
+		return;
+
+	LastSignatures.Remove(InHAC);
+}
+
+void
+FHoudiniDetailsRefreshCoordinator::Shutdown()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	PendingComponents.Empty();
+	LastSignatures.Empty();
+}
+
+uint32
+FHoudiniDetailsRefreshCoordinator::ComputeParametersSignature(const TArray<UHoudiniParameter*>& InParameters)
+{
+	// Flags that only drive the cook, and values read by the numeric widgets' attributes
+	static const TSet<FName> SkippedProperties = { TEXT("bHasChanged"), TEXT("bNeedsToTriggerUpdate"), TEXT("bPendingRevertToDefault") };
+	static const TSet<FName> SkippedNumericProperties = { TEXT("bHasChanged"), TEXT("bNeedsToTriggerUpdate"), TEXT("bPendingRevertToDefault"), TEXT("Values") };
+
+	uint32 Hash = GetTypeHash(InParameters.Num());
+	for (const UHoudiniParameter* Parameter : InParameters)
+	{
+		if (!IsValid(Parameter))
+		{
+			Hash = HashCombine(Hash, 0);
+			continue;
+		}
+
+		const bool bIsNumeric = Parameter->IsA<UHoudiniParameterFloat>() || Parameter->IsA<UHoudiniParameterInt>();
+		Hash = HoudiniHashObjectProperties(Parameter, bIsNumeric ? SkippedNumericProperties : SkippedProperties, Hash);
+
+		// The labels of the modified parameters are displayed in bold
+		Hash = HashCombine(Hash, GetTypeHash(Parameter->IsDefault()));
+	}
+
+	return Hash;
+}
+
+uint32
+FHoudiniDetailsRefreshCoordinator::ComputeOutputsSignature(const TArray<UHoudiniOutput*>& InOutputs)
+{
+	uint32 Hash = GetTypeHash(InOutputs.Num());
+	for (const UHoudiniOutput* Output : InOutputs)
+	{
+		if (!IsValid(Output))
+		{
+			Hash = HashCombine(Hash, 0);
+			continue;
+		}
+
+		Hash = HashCombine(Hash, GetTypeHash(Output));
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Output->GetType()));
+		Hash = HashCombine(Hash, GetTypeHash(Output->GetHoudiniGeoPartObjects().Num()));
+
+		FString ValueString;
+		for (const auto& Pair : Output->GetOutputObjects())
+		{
+			const FHoudiniOutputObject& OutputObject = Pair.Value;
+			Hash = HashCombine(Hash, GetTypeHash(Pair.Key));
+
+			ValueString.Reset();
+			FHoudiniOutputObject::StaticStruct()->ExportText(ValueString, &OutputObject, nullptr, nullptr, PPF_None, nullptr);
+			Hash = FCrc::StrCrc32(*ValueString, Hash);
+
+			Hash = HoudiniHashOutputObjectMaterials(OutputObject.OutputObject, Hash);
+			Hash = HoudiniHashOutputObjectMaterials(OutputObject.ProxyObject, Hash);
+		}
+
+		for (const auto& Pair : Output->GetInstancedOutputs())
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Pair.Key));
+
+			ValueString.Reset();
+			FHoudiniInstancedOutput::StaticStruct()->ExportText(ValueString, &Pair.Value, nullptr, nullptr, PPF_None, nullptr);
+			Hash = FCrc::StrCrc32(*ValueString, Hash);
+		}
+	}
+
+	return Hash;
+}
+
+uint32
+FHoudiniDetailsRefreshCoordinator::ComputeSignature(UHoudiniAssetComponent* InHAC)
+{
+	if (!IsValid(InHAC))
+		return 0;
+
+	TArray<UHoudiniParameter*> Parameters;
+	Parameters.Reserve(InHAC->GetNumParameters());
+	for (int32 Idx = 0; Idx < InHAC->GetNumParameters(); Idx++)
+		Parameters.Add(InHAC->GetParameterAt(Idx));
+
+	TArray<UHoudiniOutput*> Outputs;
+	Outputs.Reserve(InHAC->GetNumOutputs());
+	for (int32 Idx = 0; Idx < InHAC->GetNumOutputs(); Idx++)
+		Outputs.Add(InHAC->GetOutputAt(Idx));
+
+	uint32 Hash = ComputeParametersSignature(Parameters);
+	Hash = HashCombine(Hash, ComputeOutputsSignature(Outputs));
+
+	// The inputs' rows only depend on their type and objects, their settings are edited through the panel
+	Hash = HashCombine(Hash, GetTypeHash(InHAC->GetNumInputs()));
+	for (int32 Idx = 0; Idx < InHAC->GetNumInputs(); Idx++)
+	{
+		UHoudiniInput* Input = InHAC->GetInputAt(Idx);
+		Hash = HashCombine(Hash, GetTypeHash(Input));
+		if (!IsValid(Input))
+			continue;
+
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Input->GetInputType()));
+		Hash = HashCombine(Hash, GetTypeHash(Input->GetNumberOfInputObjects()));
+	}
+
+	Hash = HashCombine(Hash, GetTypeHash(InHAC->GetPDGAssetLink()));
+
+	return Hash;
+}
+
+void
+FHoudiniDetailsRefreshCoordinator::ResetStats()
+{
+	Stats = FHoudiniDetailsRefreshStats();
+}
+
+void
+FHoudiniDetailsRefreshCoordinator::LogStats()
+{
+	const int32 NumRefreshes = Stats.NumFullRebuilds + Stats.NumLightRefreshes;
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Details refresh (mode %d): %d requests, %d refreshes (%d coalesced), %d full rebuilds in %.2fms (%.2fms avg), %d light refreshes in %.2fms, %.2fms computing signatures."),
+		CVarHoudiniEngineDetailsRefreshMode.GetValueOnAnyThread(),
+		Stats.NumRequests, NumRefreshes, Stats.NumRequests - NumRefreshes,
+		Stats.NumFullRebuilds, Stats.FullRebuildSeconds * 1000.0,
+		Stats.NumFullRebuilds > 0 ? Stats.FullRebuildSeconds * 1000.0 / Stats.NumFullRebuilds : 0.0,
+		Stats.NumLightRefreshes, Stats.LightRefreshSeconds * 1000.0,
+		Stats.SignatureSeconds * 1000.0);
+}
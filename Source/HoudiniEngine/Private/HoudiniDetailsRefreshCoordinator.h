@@ -0,0 +1,105 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UHoudiniAssetComponent;
+class UHoudiniParameter;
+class UHoudiniOutput;
+
+struct HOUDINIENGINE_API FHoudiniDetailsRefreshStats
+{
+	// Number of refreshes requested by the cooks and PDG updates
+	int32 NumRequests = 0;
+	// Number of requests that required a full rebuild of the details panels
+	int32 NumFullRebuilds = 0;
+	// Number of requests where the values could be updated without a rebuild
+	int32 NumLightRefreshes = 0;
+
+	double FullRebuildSeconds = 0.0;
+	double LightRefreshSeconds = 0.0;
+	// Time spent computing the components' signatures
+	double SignatureSeconds = 0.0;
+};
+
+/**
+ * Coalesces the details panel refreshes requested after cooks and PDG updates.
+ * Requests are flushed once per frame, on the game thread. A component's details are only rebuilt if the rows
+ * they display have changed (the parameters' layout/labels/non-numeric values, inputs or outputs), otherwise the
+ * panels simply update the values of their existing widgets.
+ */
+struct HOUDINIENGINE_API FHoudiniDetailsRefreshCoordinator
+{
+	public:
+
+		// Requests a refresh of the component's details on the next frame, can be called from any thread.
+		// bInForceFullRebuild skips the signature check (used by the PDG asset link, whose rows aren't tracked).
+		static void RequestRefresh(UHoudiniAssetComponent* InHAC, const bool& bInForceFullRebuild = false);
+
+		// Refreshes all the pending components now
+		static void Flush();
+
+		// Forgets the pending requests and the components' signatures
+		static void Shutdown();
+
+		// Called when a component's details have been rebuilt outside of the coordinator,
+		// the panels could now display a state that doesn't match the stored signature.
+		static void InvalidateSignature(UHoudiniAssetComponent* InHAC);
+
+		// Signature of the rows created for the parameters/outputs in the details panel.
+		// Float and int values are read by their widgets every frame, so they aren't part of the signature.
+		static uint32 ComputeParametersSignature(const TArray<UHoudiniParameter*>& InParameters);
+		static uint32 ComputeOutputsSignature(const TArray<UHoudiniOutput*>& InOutputs);
+		static uint32 ComputeSignature(UHoudiniAssetComponent* InHAC);
+
+		static const FHoudiniDetailsRefreshStats& GetStats() { return Stats; };
+		static void ResetStats();
+		static void LogStats();
+
+	protected:
+
+		static void RequestRefreshInternal(UHoudiniAssetComponent* InHAC, const bool& bInForceFullRebuild);
+
+		static bool OnTick(float InDeltaTime);
+
+	protected:
+
+		// Components waiting for a refresh, and if they need a full rebuild
+		static TMap<TWeakObjectPtr<UHoudiniAssetComponent>, bool> PendingComponents;
+
+		// Signature of each component at its last full rebuild
+		static TMap<TWeakObjectPtr<UHoudiniAssetComponent>, uint32> LastSignatures;
+
+		static FDelegateHandle TickerHandle;
+
+		// Set while the coordinator itself rebuilds the panels
+		static bool bIsFlushing;
+
+		static FHoudiniDetailsRefreshStats Stats;
+};
@@ -28,6 +28,7 @@
 #include "HoudiniEnginePrivatePCH.h"
 
 #include "HoudiniApi.h"
+#include "HoudiniApiTrace.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniRuntimeSettings.h"
@@ -36,6 +37,12 @@
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
+#include "UnrealMeshTranslator.h"
+#include "HoudiniAssetLibraryRegistry.h"
+#include "HoudiniInputNodePool.h"
+#include "HoudiniPackageNameIndex.h"
+#include "HoudiniDetailsRefreshCoordinator.h"
+#include "HoudiniSessionStarter.h"
 #include "HAPI/HAPI_Version.h"
 
 #include "Modules/ModuleManager.h"
@@ -54,6 +61,21 @@
 
 #define LOCTEXT_NAMESPACE "HoudiniEngine"
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineAsyncSessionStart(
+	TEXT("HoudiniEngine.AsyncSessionStart"),
+	1,
+	TEXT("Whether the Houdini Engine sessions are started in the background.\n")
+	TEXT("0: Starting/restarting a session blocks the editor until the server is launched and HAPI is initialized\n")
+	TEXT("1: Sessions are started in the background and adopted by the manager once ready (default)\n"));
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineStandbySession(
+	TEXT("HoudiniEngine.StandbySession"),
+	0,
+	TEXT("Whether a standby session is pre-started on its own automatic server.\n")
+	TEXT("When the current session is lost, the standby session is swapped in immediately instead of restarting a new one.\n")
+	TEXT("0: Disabled (default)\n")
+	TEXT("1: Enabled, only for named pipe and socket sessions\n"));
+
 IMPLEMENT_MODULE(FHoudiniEngine, HoudiniEngine)
 DEFINE_LOG_CATEGORY( LogHoudiniEngine );
 
@@ -81,6 +103,8 @@ FHoudiniEngine::FHoudiniEngine()
 	, HoudiniLogoBrush(nullptr)
 	, HoudiniDefaultReferenceMesh(nullptr)
 	, HoudiniDefaultReferenceMeshMaterial(nullptr)
+	, StandbySessionCount(0)
+	, bReinstantiateAssetsOnSessionStart(false)
 {
 	Session.type = HAPI_SESSION_MAX;
 	Session.id = -1;
@@ -129,6 +153,7 @@ FHoudiniEngine::StartupModule()
 		if ( HAPILibraryHandle )
 		{
 			FHoudiniApi::InitializeHAPI( HAPILibraryHandle );
+			FHoudiniApiTrace::OnHAPIInitialized();
 		}
 		else
 		{
@@ -294,6 +319,13 @@ FHoudiniEngine::ShutdownModule()
 		SettingsModule->UnregisterSettings("Project", "Plugins", "HoudiniEngine");
 #endif
 
+	FHoudiniPackageNameIndex::Shutdown();
+	FHoudiniDetailsRefreshCoordinator::Shutdown();
+
+	// Wait for the sessions being started in the background, and close them
+	SessionStarter.Reset();
+	StandbySessionStarter.Reset();
+
 	// Do scheduler and thread clean up.
 	if (HoudiniEngineScheduler)
 		HoudiniEngineScheduler->Stop();
@@ -331,6 +363,8 @@ FHoudiniEngine::ShutdownModule()
 		SessionStatus = EHoudiniSessionStatus::Invalid;
 	}
 
+	// Restore the traced HAPI functions before they are reset
+	FHoudiniApiTrace::OnHAPIFinalized();
 	FHoudiniApi::FinalizeHAPI();
 
 	FHoudiniEngine::HoudiniEngineInstance = nullptr;
@@ -529,114 +563,27 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 	if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(SessionPtr))
 		return true;
 
-	// Set the HAPI_CLIENT_NAME environment variable to "unreal"
-	// We need to do this before starting HARS.
-	FPlatformMisc::SetEnvironmentVar(TEXT("HAPI_CLIENT_NAME"), TEXT("unreal"));
-
-	HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
-
-	HAPI_ThriftServerOptions ServerOptions;
-	FMemory::Memzero< HAPI_ThriftServerOptions >(ServerOptions);
-	ServerOptions.autoClose = true;
-	ServerOptions.timeoutMs = AutomaticServerTimeout;
-
-	// Unless we automatically start the server,
-	// consider we're in SessionSync mode
-	bEnableSessionSync = true;
-
-	auto UpdatePathForServer = [&]
-	{
-		// Modify our PATH so that HARC will find HARS.exe
-		const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
-
-		FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
+	// Set the environment variables needed by HARS
+	FHoudiniSessionStarter::PrepareServerEnvironment(LibHAPILocation);
 
-		FString ModifiedPath =
-#if PLATFORM_MAC
-			// On Mac our binaries are split between two folders
-			LibHAPILocation + TEXT("/../Resources/bin") + PathDelimiter +
-#endif
-			LibHAPILocation + PathDelimiter + OrigPathVar;
-
-		FPlatformMisc::SetEnvironmentVar(TEXT("PATH"), *ModifiedPath);
-	};
-
-
-	// Clear the connection error before starting a new session
-	if(SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_None)
-		FHoudiniApi::ClearConnectionError();
-
-	switch (SessionType)
-	{
-		case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
-		{
-			// Try to connect to an existing socket session first
-			SessionResult = FHoudiniApi::CreateThriftSocketSession(
-				SessionPtr, TCHAR_TO_UTF8(*ServerHost), ServerPort );
-
-			// Start a session and try to connect to it if we failed
-			if ( StartAutomaticServer && SessionResult != HAPI_RESULT_SUCCESS )
-			{
-				UpdatePathForServer();
-				FHoudiniApi::StartThriftSocketServer(
-					&ServerOptions, ServerPort, nullptr);
-
-				// We've started the server manually, disable session sync
-				bEnableSessionSync = false;
+	FHoudiniSessionStartOptions Options = FHoudiniSessionStartOptions::FromSettings(GetDefault<UHoudiniRuntimeSettings>());
+	Options.SessionType = SessionType;
+	Options.bStartAutomaticServer = StartAutomaticServer;
+	Options.AutomaticServerTimeout = AutomaticServerTimeout;
+	Options.ServerPipeName = ServerPipeName;
+	Options.ServerPort = ServerPort;
+	Options.ServerHost = ServerHost;
 
-				SessionResult = FHoudiniApi::CreateThriftSocketSession(
-					SessionPtr, TCHAR_TO_UTF8(*ServerHost), ServerPort);
-			}
-		}
-		break;
-
-		case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
-		{
-			// Try to connect to an existing pipe session first
-			SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-				SessionPtr, TCHAR_TO_UTF8(*ServerPipeName) );
-
-			// Start a session and try to connect to it if we failed
-			if (StartAutomaticServer && SessionResult != HAPI_RESULT_SUCCESS)
-			{
-				UpdatePathForServer();
-				FHoudiniApi::StartThriftNamedPipeServer(
-					&ServerOptions, TCHAR_TO_UTF8(*ServerPipeName), nullptr);
-
-				// We've started the server manually, disable session sync
-				bEnableSessionSync = false;
-
-				SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-					SessionPtr, TCHAR_TO_UTF8(*ServerPipeName));
-			}
-		}
-		break;
-
-		case EHoudiniRuntimeSettingsSessionType::HRSST_None:
-		{
-			HOUDINI_LOG_MESSAGE(TEXT("Session type set to None, Cooking is disabled."));
-			// Disable session sync
-			bEnableSessionSync = false;
-			break;
-		}
-
-		case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
-			// As of Unreal 4.19, InProcess sessions are not supported anymore
-			SessionResult = FHoudiniApi::CreateInProcessSession(SessionPtr);
-			// Disable session sync
-			bEnableSessionSync = false;
-			break;
-
-		default:
-			HOUDINI_LOG_ERROR(TEXT("Unsupported Houdini Engine session type"));
-			// Disable session sync
-			bEnableSessionSync = false;
-			break;
-	}
+	// Unless we automatically start the server, we're in SessionSync mode
+	FString ConnectionError;
+	HAPI_Result SessionResult = FHoudiniSessionStarter::CreateSession(Options, SessionPtr, bEnableSessionSync, &ConnectionError);
 
 	// Stop here if we used a none session
 	if (SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_None)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Session type set to None, Cooking is disabled."));
 		return false;
+	}
 
 	FHoudiniEngine::Get().SetFirstSessionCreated(true);
 
@@ -647,7 +594,6 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 
 		if (SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_InProcess)
 		{
-			FString ConnectionError = FHoudiniEngineUtils::GetConnectionError();
 			if(!ConnectionError.IsEmpty())
 				HOUDINI_LOG_ERROR(TEXT("Houdini Engine Session failed to connect -  %s"), *ConnectionError);
 		}
@@ -753,86 +699,19 @@ FHoudiniEngine::InitializeHAPISession()
 	}
 
 	// Now, initialize HAPI with the new session
-	// We need to make sure HAPI version is correct.
-	int32 RunningEngineMajor = 0;
-	int32 RunningEngineMinor = 0;
-	int32 RunningEngineApi = 0;
-
-	// Retrieve version numbers for running Houdini Engine.
-	FHoudiniApi::GetEnvInt(HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR, &RunningEngineMajor);
-	FHoudiniApi::GetEnvInt(HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR, &RunningEngineMinor);
-	FHoudiniApi::GetEnvInt(HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API, &RunningEngineApi);
-
-	// Compare defined and running versions.
-	if (RunningEngineMajor != HAPI_VERSION_HOUDINI_ENGINE_MAJOR
-		|| RunningEngineMinor != HAPI_VERSION_HOUDINI_ENGINE_MINOR)
-	{
-		// Major or minor HAPI version differs, stop here
-		HOUDINI_LOG_ERROR(
-			TEXT("Starting up the Houdini Engine module failed: built and running versions do not match."));
-		HOUDINI_LOG_ERROR(
-			TEXT("Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d"),
-			HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
-			RunningEngineMajor, RunningEngineMinor, RunningEngineApi);
-
-		// Display an error message
-
-		// 
+	FString InitializeError;
+	if (!FHoudiniSessionStarter::InitializeSession(
+		FHoudiniSessionStartOptions::FromSettings(GetDefault<UHoudiniRuntimeSettings>()), &Session, InitializeError))
 		return false;
 
-	}
-	else if (RunningEngineApi != HAPI_VERSION_HOUDINI_ENGINE_API)
-	{
-		// Major/minor HAPIversions match, but only the API version differs,
-		// Allow the user to continue but warn him of possible instabilities
-		HOUDINI_LOG_WARNING(
-			TEXT("Starting up the Houdini Engine module: built and running versions do not match."));
-		HOUDINI_LOG_WARNING(
-			TEXT("Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d"),
-			HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
-			RunningEngineMajor, RunningEngineMinor, RunningEngineApi);
-		HOUDINI_LOG_WARNING(
-			TEXT("This could cause instabilities and crashes when using the Houdini Engine plugin"));
-	}
+	OnSessionInitialized();
 
-	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-
-	// Default CookOptions
-	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-
-	bool bUseCookingThread = true;
-	HAPI_Result Result = FHoudiniApi::Initialize(
-		&Session,
-		&CookOptions,
-		bUseCookingThread,
-		HoudiniRuntimeSettings->CookingThreadStackSize,
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->OtlSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->DsoSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->ImageDsoSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->AudioDsoSearchPath));
-	
-	if (Result == HAPI_RESULT_SUCCESS)
-	{
-		HOUDINI_LOG_MESSAGE(TEXT("Successfully intialized the Houdini Engine module."));
-	}
-	else if (Result == HAPI_RESULT_ALREADY_INITIALIZED)
-	{
-		// Reused session? just notify the user
-		HOUDINI_LOG_MESSAGE(TEXT("Successfully intialized the Houdini Engine module - HAPI was already initialzed."));
-	}
-	else
-	{
-		HOUDINI_LOG_ERROR(
-			TEXT("Houdini Engine API initialization failed: %s"),
-			*FHoudiniEngineUtils::GetErrorDescription(Result));
-
-		return false;
-	}
-
-	// Let HAPI know we are running inside UE4
-	FHoudiniApi::SetServerEnvString(&Session, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
+	return true;
+}
 
+void
+FHoudiniEngine::OnSessionInitialized()
+{
 	if (bEnableSessionSync)
 	{
 		// Set the session sync infos if needed
@@ -844,19 +723,56 @@ FHoudiniEngine::InitializeHAPISession()
 		HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Session Sync enabled."));		
 	}
 
-	return true;
+	// Get the next standby session ready, whether this session was started synchronously, in the background or swapped in
+	StartStandbySessionIfNeeded();
 }
 
 
 void
 FHoudiniEngine::OnSessionLost()
 {
-	// Mark the session as invalid
+	if (!IsInGameThread())
+	{
+		// The session can be lost while cooking on the scheduler thread. Stop ticking right away so the manager 
+		// doesn't keep using the invalid session, but close it and reset the caches on the game thread.
+		HoudiniEngineManager->StopHoudiniTicking();
+
+		const HAPI_Session LostSession = Session;
+		AsyncTask(ENamedThreads::GameThread, [LostSession]()
+		{
+			// The session may have been replaced or handled already by the time we get there
+			FHoudiniEngine& HEngine = FHoudiniEngine::Get();
+			if (HEngine.Session.type != LostSession.type || HEngine.Session.id != LostSession.id)
+				return;
+
+			HEngine.OnSessionLost();
+		});
+		return;
+	}
+
+	// Release the lost session's connection and mark the session as invalid
+	if (Session.type != HAPI_SESSION_MAX && FHoudiniApi::IsHAPIInitialized())
+		FHoudiniApi::CloseSession(&Session);
+
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Lost);
 
+	// Nodes created in the lost session can't be shared anymore
+	FUnrealMeshTranslator::ClearSharedStaticMeshInputNodes();
+	FHoudiniAssetLibraryRegistry::Reset();
+	FHoudiniInputNodePool::Reset();
+
 	bEnableSessionSync = false;
+
+	// If a standby session is ready, use it right away instead of stopping
+	if (StandbySessionStarter.IsReady())
+	{
+		HOUDINI_LOG_WARNING(TEXT("Houdini Engine Session lost! Switching to the standby session."));
+		if (SwapInStandbySession())
+			return;
+	}
+
 	HoudiniEngineManager->StopHoudiniTicking();
 
 	// This indicates that we likely have lost the session due to a crash in HARS/Houdini
@@ -892,6 +808,10 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
 	bEnableSessionSync = false;
 
+	FUnrealMeshTranslator::ClearSharedStaticMeshInputNodes();
+	FHoudiniAssetLibraryRegistry::Reset();
+	FHoudiniInputNodePool::Reset();
+
 	HoudiniEngineManager->StopHoudiniTicking();
 
 	return true;
@@ -957,6 +877,232 @@ FHoudiniEngine::RestartSession()
 	}
 }
 
+bool
+FHoudiniEngine::IsAsyncSessionStartEnabled()
+{
+	return CVarHoudiniEngineAsyncSessionStart.GetValueOnAnyThread() > 0;
+}
+
+bool
+FHoudiniEngine::RestartSessionAsync(const bool& bInReinstantiateAssets)
+{
+	if (!FHoudiniApi::IsHAPIInitialized())
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to restart the Houdini Engine session - HAPI Not initialized"));
+		return false;
+	}
+
+	// A session is already being started, it will be adopted once ready
+	if (SessionStarter.IsStarting())
+	{
+		bReinstantiateAssetsOnSessionStart |= bInReinstantiateAssets;
+		return true;
+	}
+
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	const FHoudiniSessionStartOptions Options = FHoudiniSessionStartOptions::FromSettings(HoudiniRuntimeSettings);
+
+	// None and in-process sessions can't be started in the background
+	if (!Options.SupportsBackgroundStart())
+	{
+		if (!RestartSession())
+			return false;
+
+		if (bInReinstantiateAssets)
+			MarkAllHACsAsNeedInstantiation();
+		return true;
+	}
+
+	// Use the standby session if we have one
+	if (StandbySessionStarter.IsReady() && StandbySessionStarter.IsReadySessionValid())
+	{
+		StopSession();
+		if (!SwapInStandbySession())
+			return false;
+
+		if (bInReinstantiateAssets)
+			MarkAllHACsAsNeedInstantiation();
+		return true;
+	}
+
+	// Discard a previous start that wasn't adopted
+	SessionStarter.Reset();
+
+	FString StatusText = TEXT("Starting the Houdini Engine session...");
+	CreateTaskSlateNotification(FText::FromString(StatusText), true, 4.0f);
+
+	// Make sure we stop the current session if it is still valid
+	StopSession();
+	SetFirstSessionCreated(true);
+
+	FHoudiniSessionStarter::PrepareServerEnvironment(LibHAPILocation);
+
+	bReinstantiateAssetsOnSessionStart = bInReinstantiateAssets;
+	if (!SessionStarter.Start(Options))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to restart the Houdini Engine session - Failed to start the new Session"));
+		SetSessionStatus(EHoudiniSessionStatus::Failed);
+		return false;
+	}
+
+	// The manager needs to tick to adopt the session once it's ready
+	HoudiniEngineManager->StartHoudiniTicking();
+
+	return true;
+}
+
+bool
+FHoudiniEngine::TickSessionStart()
+{
+	check(IsInGameThread());
+
+	// A standby session that failed to start is simply discarded
+	if (StandbySessionStarter.GetState() == EHoudiniSessionStartState::Failed)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to start the Houdini Engine standby session - %s"), *StandbySessionStarter.GetError());
+		StandbySessionStarter.Reset();
+	}
+
+	switch (SessionStarter.GetState())
+	{
+		case EHoudiniSessionStartState::Starting:
+			return true;
+
+		case EHoudiniSessionStartState::Ready:
+		{
+			const bool bReinstantiate = bReinstantiateAssetsOnSessionStart;
+			bReinstantiateAssetsOnSessionStart = false;
+			AdoptStartedSession(SessionStarter, bReinstantiate);
+		}
+		break;
+
+		case EHoudiniSessionStartState::Failed:
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to restart the Houdini Engine session - %s"), *SessionStarter.GetError());
+			SessionStarter.Reset();
+			bReinstantiateAssetsOnSessionStart = false;
+
+			SetSessionStatus(EHoudiniSessionStatus::Failed);
+			StopTicking();
+
+			FString StatusText = TEXT("Houdini Engine failed to initialize.");
+			FinishTaskSlateNotification(FText::FromString(StatusText));
+		}
+		break;
+
+		case EHoudiniSessionStartState::Idle:
+		default:
+			break;
+	}
+
+	return false;
+}
+
+bool
+FHoudiniEngine::AdoptStartedSession(FHoudiniSessionStarter& InStarter, const bool& bInReinstantiateAssets)
+{
+	if (!InStarter.IsReady())
+		return false;
+
+	// Close the session we're replacing so its connection isn't leaked
+	if (Session.type != HAPI_SESSION_MAX)
+	{
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&Session))
+			FHoudiniApi::Cleanup(&Session);
+		FHoudiniApi::CloseSession(&Session);
+
+		Session.id = -1;
+		Session.type = HAPI_SESSION_MAX;
+
+		// Nodes created in the previous session can't be shared anymore
+		FUnrealMeshTranslator::ClearSharedStaticMeshInputNodes();
+		FHoudiniAssetLibraryRegistry::Reset();
+		FHoudiniInputNodePool::Reset();
+	}
+
+	const double StartDuration = InStarter.GetStartDuration();
+	if (!InStarter.TakeSession(Session, bEnableSessionSync, LicenseType))
+		return false;
+
+	OnSessionInitialized();
+	SetSessionStatus(EHoudiniSessionStatus::Connected);
+	StartTicking();
+
+	HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine session started in %.3lf seconds."), StartDuration);
+
+	FString StatusText = TEXT("Houdini Engine successfully initialized.");
+	FinishTaskSlateNotification(FText::FromString(StatusText));
+
+	if (bInReinstantiateAssets)
+		MarkAllHACsAsNeedInstantiation();
+
+	return true;
+}
+
+void
+FHoudiniEngine::StartStandbySessionIfNeeded()
+{
+	if (CVarHoudiniEngineStandbySession.GetValueOnGameThread() <= 0 || IsRunningCommandlet())
+		return;
+
+	if (StandbySessionStarter.GetState() != EHoudiniSessionStartState::Idle)
+		return;
+
+	// The standby session needs its own automatic server, and can't replace a Session Sync one
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	const FHoudiniSessionStartOptions Options = FHoudiniSessionStartOptions::FromSettings(HoudiniRuntimeSettings);
+	if (!Options.bStartAutomaticServer || !Options.SupportsBackgroundStart() || bEnableSessionSync)
+		return;
+
+	FHoudiniSessionStarter::PrepareServerEnvironment(LibHAPILocation);
+	StandbySessionStarter.Start(Options.MakeStandbyOptions(StandbySessionCount++));
+}
+
+bool
+FHoudiniEngine::SwapInStandbySession()
+{
+	check(IsInGameThread());
+
+	// Nothing to swap if the current session is still alive, but make sure we tick it
+	if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&Session))
+	{
+		if (!HoudiniEngineManager->IsTicking())
+			HoudiniEngineManager->StartHoudiniTicking();
+		return true;
+	}
+
+	if (!StandbySessionStarter.IsReady())
+		return false;
+
+	if (!StandbySessionStarter.IsReadySessionValid())
+	{
+		HOUDINI_LOG_WARNING(TEXT("The Houdini Engine standby session is no longer valid."));
+		StandbySessionStarter.Reset();
+		return false;
+	}
+
+	// The assets need to be re-instantiated in the standby session
+	if (!AdoptStartedSession(StandbySessionStarter, true))
+		return false;
+
+	HOUDINI_LOG_MESSAGE(TEXT("Switched to the Houdini Engine standby session."));
+	return true;
+}
+
+void
+FHoudiniEngine::MarkAllHACsAsNeedInstantiation()
+{
+	// Notify all the HoudiniAssetComponents that they need to re instantiate themselves in the new Houdini engine session.
+	for (TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr)
+	{
+		UHoudiniAssetComponent * HAC = *Itr;
+		if (!IsValid(HAC))
+			continue;
+
+		HAC->MarkAsNeedInstantiation();
+	}
+}
+
 bool
 FHoudiniEngine::CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionType, FName OverrideServerPipeName)
 {
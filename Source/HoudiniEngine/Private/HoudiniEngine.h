@@ -30,6 +30,7 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniRuntimeSettings.h"
+#include "HoudiniSessionStarter.h"
 
 #include "Modules/ModuleInterface.h"
 
@@ -118,6 +119,25 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Connect to an existing HE session
 		bool ConnectSession(const EHoudiniRuntimeSettingsSessionType& SessionType);
 
+		// Whether sessions should be started in the background (HoudiniEngine.AsyncSessionStart)
+		static bool IsAsyncSessionStartEnabled();
+		// Stops the current session, then starts a new one in the background without blocking the editor.
+		// The manager adopts the new session once it's ready, or swaps in the standby session right away if there is one.
+		// If bInReinstantiateAssets is true, all the assets are re-instantiated in the new session.
+		bool RestartSessionAsync(const bool& bInReinstantiateAssets);
+		// Returns true while a session is being started in the background
+		bool IsSessionStarting() const { return SessionStarter.IsStarting(); };
+		EHoudiniSessionStartState GetSessionStartState() const { return SessionStarter.GetState(); };
+		// Adopts the session started in the background once it's ready, must be called on the game thread.
+		// Returns true while the session is still starting.
+		bool TickSessionStart();
+
+		// Pre-starts a standby session on its own server if enabled (HoudiniEngine.StandbySession)
+		void StartStandbySessionIfNeeded();
+		// Replaces the current session with the standby one, must be called on the game thread
+		bool SwapInStandbySession();
+		EHoudiniSessionStartState GetStandbySessionState() const { return StandbySessionStarter.GetState(); };
+
 		// Starts the HoudiniEngineManager ticking
 		void StartTicking();
 		// Stops the HoudiniEngineManager ticking and invalidate the session
@@ -127,6 +147,8 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		// Initialize HAPI
 		bool InitializeHAPISession();
+		// Called once HAPI is initialized for the current session, however it was started
+		void OnSessionInitialized();
 
 		// Indicate to the plugin that the session is now invalid (HAPI has likely crashed...)
 		void OnSessionLost();
@@ -249,6 +271,12 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 	private:
 
+		// Takes the session from a starter once it's ready and makes it the current session
+		bool AdoptStartedSession(FHoudiniSessionStarter& InStarter, const bool& bInReinstantiateAssets);
+
+		// Notifies all the HACs that they need to be re-instantiated in the new session
+		static void MarkAllHACsAsNeedInstantiation();
+
 		// Singleton instance of Houdini Engine.
 		static FHoudiniEngine * HoudiniEngineInstance;
 
@@ -264,6 +292,15 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// The type of HE license used by the current session
 		HAPI_License LicenseType;
 
+		// Starts the sessions in the background
+		FHoudiniSessionStarter SessionStarter;
+		// Pre-started session that replaces the current one when it's lost
+		FHoudiniSessionStarter StandbySessionStarter;
+		// Number of standby sessions started, gives each standby its own server pipe/port
+		int32 StandbySessionCount;
+		// Whether the assets must be re-instantiated once the session started in the background is adopted
+		bool bReinstantiateAssetsOnSessionStart;
+
 		// Synchronization primitive.
 		FCriticalSection CriticalSection;
 		
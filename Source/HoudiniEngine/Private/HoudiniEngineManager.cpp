@@ -32,6 +32,11 @@
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineOutputStats.h"
+#include "HoudiniApiTrace.h"
+#include "HoudiniAssetLibraryRegistry.h"
+#include "HoudiniDetailsRefreshCoordinator.h"
+#include "HoudiniInputNodePool.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
@@ -39,6 +44,7 @@
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
 #include "HoudiniSplineTranslator.h"
+#include "UnrealMeshTranslator.h"
 
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
@@ -64,6 +70,9 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineTickTimeLimit(
 	TEXT("1.0: Default\n")
 );
 
+// Output stats of each HAC's current or last cook, only accessed on the game thread
+static TMap<TWeakObjectPtr<const UHoudiniAssetComponent>, FHoudiniEngineOutputStats> HoudiniEngineCookStats;
+
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
@@ -145,6 +154,10 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		return true;
 	}
 
+	// Wait for the session being started in the background, and adopt it once it's ready
+	if (FHoudiniEngine::Get().TickSessionStart())
+		return true;
+
 	// Build a set of components that need to be processed
 	// 1 - selected HACs
 	// 2 - "Active" HACs
@@ -234,6 +247,10 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		CurrentIndex++;
 	}
 
+	// Load the libraries prewarmed for the level before instantiating its components
+	if (FHoudiniAssetLibraryRegistry::HasPendingPrewarm())
+		FHoudiniAssetLibraryRegistry::LoadPendingPrewarm();
+
 	// Sort the components by last tick time
 	ComponentsToProcess.Sort([](const UHoudiniAssetComponent& A, const UHoudiniAssetComponent& B) { return A.LastTickTime < B.LastTickTime; });
 
@@ -306,6 +323,8 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 
 			// See if we should start the default "first" session
 			AutoStartFirstSessionIfNeeded(CurrentComponent);
+			if (FHoudiniEngine::Get().IsSessionStarting())
+				return true;
 
 			EHoudiniAssetState PrevState = CurrentComponent->GetAssetState();
 			ProcessComponent(CurrentComponent);
@@ -360,8 +379,19 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		for (int32 DeleteIdx = PendingDeleteCount - 1; DeleteIdx >= 0; DeleteIdx--)
 		{
 			HAPI_NodeId NodeIdToDelete = (HAPI_NodeId)FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteAt(DeleteIdx);
+			FUnrealMeshTranslator::ReleaseSharedStaticMeshInputNode(NodeIdToDelete);
 			FGuid HapiDeletionGUID;
 			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete);
+
+			// Input nodes from destroyed components are reclaimed by the pool instead of deleted
+			if (FHoudiniInputNodePool::ReleaseNode(NodeIdToDelete))
+			{
+				FHoudiniEngineRuntime::Get().RemoveNodeIdPendingDeleteAt(DeleteIdx);
+				if (bShouldDeleteParent)
+					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete);
+				continue;
+			}
+
 			if (StartTaskAssetDelete(NodeIdToDelete, HapiDeletionGUID, bShouldDeleteParent))
 			{
 				FHoudiniEngineRuntime::Get().RemoveNodeIdPendingDeleteAt(DeleteIdx);
@@ -435,8 +465,16 @@ FHoudiniEngineManager::AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InC
 		// Indicates that we've tried to start the session once no matter if it failed or succeed
 		FHoudiniEngine::Get().SetFirstSessionCreated(true);
 
-		// Attempt to restart the session
-		if (!FHoudiniEngine::Get().RestartSession())
+		// Attempt to restart the session, in the background if possible
+		const bool bStarted = FHoudiniEngine::IsAsyncSessionStartEnabled()
+			? FHoudiniEngine::Get().RestartSessionAsync(false)
+			: FHoudiniEngine::Get().RestartSession();
+
+		// The notification will be finished once the session is adopted
+		if (bStarted && FHoudiniEngine::Get().IsSessionStarting())
+			return;
+
+		if (!bStarted)
 		{
 			// We failed to start the session
 			// Stop ticking until it's manually restarted
@@ -466,6 +504,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 	if (!HAC->GetHoudiniAsset())
 		return;
 
+	// Attribute the HAPI calls made while processing to this component
+	FHoudiniApiTraceOwnerScope TraceOwner(HAC);
+
 	const EHoudiniAssetState AssetStateToProcess = HAC->GetAssetState();
 	
 	// If cooking is paused, stay in the current state until cooking's resumed, unless we are in NewHDA
@@ -482,7 +523,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		{
 			// Trigger a details panel update if the Houdini asset actor is selected
 			if (HAC->IsOwnerSelected())
-				FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+				FHoudiniDetailsRefreshCoordinator::RequestRefresh(HAC, true);
 
 			// Finished refreshing UI of one HDA.
 			FHoudiniEngine::Get().RefreshUIDisplayedWhenPauseCooking();
@@ -541,7 +582,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			FGuid TaskGuid;
 			FString HapiAssetName;
 			UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
-			if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), TaskGuid, HapiAssetName))
+			if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), HAC->GetPathName(), TaskGuid, HapiAssetName))
 			{
 				// Update the HAC's state
 				HAC->SetAssetState(EHoudiniAssetState::Instantiating);
@@ -584,6 +625,11 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if (HAC->NeedsToWaitForInputHoudiniAssets())
 				break;
 
+			// Start collecting the stats of the new cook
+			ResetCookStats(HAC);
+			if (FHoudiniApiTrace::IsEnabled())
+				FHoudiniApiTrace::ResetOwnerCook(HAC);
+
 			HAC->OnPrePreCook();
 			// Update all the HAPI nodes, parameters, inputs etc...
 			PreCook(HAC);
@@ -603,6 +649,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 					HAC->GetAssetId(),
 					OutputNodes,
 					HAC->GetDisplayName(),
+					HAC->GetPathName(),
 					HAC->bUseOutputNodes,
 					HAC->bOutputTemplateGeos,
 					TaskGUID) )
@@ -617,7 +664,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if(!bCookStarted)
 			{
 				// Just refresh editor properties?
-				FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+				FHoudiniDetailsRefreshCoordinator::RequestRefresh(HAC);
 
 				// TODO: Check! update state?
 				HAC->SetAssetState(EHoudiniAssetState::None);
@@ -672,6 +719,14 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		{
 			UpdateProcess(HAC);
 
+			if (FHoudiniApiTrace::IsEnabled())
+			{
+				// Add the HAPI calls of this cook to its stats
+				FHoudiniEngineOutputStats& CookStats = GetCookStats(HAC);
+				FHoudiniApiTrace::GetOwnerStats(HAC, CookStats);
+				FHoudiniApiTrace::LogOwnerSummary(HAC, CookStats);
+			}
+
 			int32 CookCount = FHoudiniEngineUtils::HapiGetCookCount(HAC->GetAssetId());
 			HAC->SetAssetCookCount(CookCount);
 
@@ -747,7 +802,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 
 bool 
-FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, FGuid& OutTaskGUID, FString& OutHAPIAssetName)
+FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, const FString& PathName, FGuid& OutTaskGUID, FString& OutHAPIAssetName)
 {
 	// Make sure we have a valid session before attempting anything
 	if (!FHoudiniEngine::Get().GetSession())
@@ -803,6 +858,7 @@ FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset,
 	FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetInstantiation, OutTaskGUID);
 	Task.Asset = HoudiniAsset;
 	Task.ActorName = DisplayName;
+	Task.ActorPathName = PathName;
 	//Task.bLoadedComponent = bLocalLoadedComponent;
 	Task.AssetLibraryId = AssetLibraryId;
 	Task.AssetHapiName = PickedAssetName;
@@ -994,6 +1050,7 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	const HAPI_NodeId& AssetId,
 	const TArray<HAPI_NodeId>& NodeIdsToCook,
 	const FString& DisplayName,
+	const FString& PathName,
 	bool bUseOutputNodes,
 	bool bOutputTemplateGeos,
 	FGuid& OutTaskGUID)
@@ -1016,6 +1073,7 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	// Add a new cook task
 	FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, OutTaskGUID);
 	Task.ActorName = DisplayName;
+	Task.ActorPathName = PathName;
 	Task.AssetId = AssetId;
 
 	if (NodeIdsToCook.Num() > 0)
@@ -1225,12 +1283,13 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 		HAC->UpdateRenderingInformation();
 
 		// Since we have new asset, we need to update bounds.
+		HAC->InvalidateBoundsCaches();
 		HAC->UpdateBounds();
 
 		FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString("Finished processing outputs"), true);
 
-		// Trigger a details panel update
-		FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+		// Trigger a details panel update, only the changed rows will be rebuilt
+		FHoudiniDetailsRefreshCoordinator::RequestRefresh(HAC);
 
 		// If any outputs have HoudiniStaticMeshes, and if timer based refinement is enabled on the HAC,
 		// set the RefineMeshesTimer and ensure BuildStaticMeshesForAllHoudiniStaticMeshes is bound to
@@ -1772,3 +1831,26 @@ FHoudiniEngineManager::EnableEditorAutoSave(const UHoudiniAssetComponent* HAC =
 	AutoSaver.ResetAutoSaveTimer();
 #endif
 }
+
+FHoudiniEngineOutputStats&
+FHoudiniEngineManager::GetCookStats(const UHoudiniAssetComponent* HAC)
+{
+	check(IsInGameThread());
+	return HoudiniEngineCookStats.FindOrAdd(HAC);
+}
+
+void
+FHoudiniEngineManager::ResetCookStats(const UHoudiniAssetComponent* HAC)
+{
+	check(IsInGameThread());
+
+	// Drop the stats of the components that were destroyed
+	for (auto It = HoudiniEngineCookStats.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	if (IsValid(HAC))
+		HoudiniEngineCookStats.Add(HAC, FHoudiniEngineOutputStats());
+}
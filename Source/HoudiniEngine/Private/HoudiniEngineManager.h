@@ -39,6 +39,7 @@ class UHoudiniAsset;
 class UHoudiniAssetComponent;
 
 struct FHoudiniEngineTaskInfo;
+struct FHoudiniEngineOutputStats;
 struct FGuid;
 
 enum class EHoudiniAssetState : uint8;
@@ -82,6 +83,11 @@ public:
 	}
 
 	EHoudiniBGEOCommandletStatus GetPDGCommandletStatus() { return PDGManager.UpdateAndGetBGEOCommandletStatus(); }
+
+	// Output stats of a HAC's current or last cook, created if needed
+	static FHoudiniEngineOutputStats& GetCookStats(const UHoudiniAssetComponent* HAC);
+	// Clears a HAC's cook stats, called when a new cook starts
+	static void ResetCookStats(const UHoudiniAssetComponent* HAC);
 	
 	
 protected:
@@ -97,6 +103,7 @@ protected:
 	bool StartTaskAssetInstantiation(
 		UHoudiniAsset* HoudiniAsset,
 		const FString& DisplayName,
+		const FString& PathName,
 		FGuid& OutTaskGUID,
 		FString& OutHAPIAssetName);
 
@@ -112,6 +119,7 @@ protected:
 		const HAPI_NodeId& AssetId,
 		const TArray<HAPI_NodeId>& NodeIdsToCook,
 		const FString& DisplayName,
+		const FString& PathName,
 		bool bUseOutputNodes,
 		bool bOutputTemplateGeos,
 		FGuid& OutTaskGUID);
@@ -26,6 +26,23 @@
 
 #include "HoudiniEngineOutputStats.h"
 
+FHoudiniApiCallStats::FHoudiniApiCallStats()
+	: NumCalls(0)
+	, NumFailures(0)
+	, NumBytes(0)
+	, TotalSeconds(0.0)
+	, MaxSeconds(0.0)
+{ }
+
+void FHoudiniApiCallStats::Add(const FHoudiniApiCallStats& InOther)
+{
+	NumCalls += InOther.NumCalls;
+	NumFailures += InOther.NumFailures;
+	NumBytes += InOther.NumBytes;
+	TotalSeconds += InOther.TotalSeconds;
+	MaxSeconds = FMath::Max(MaxSeconds, InOther.MaxSeconds);
+}
+
 FHoudiniEngineOutputStats::FHoudiniEngineOutputStats()
 	: NumPackagesCreated(0)
 	, NumPackagesUpdated(0)
@@ -41,6 +58,11 @@ void FHoudiniEngineOutputStats::NotifyPackageUpdated(int32 NumUpdated)
 	NumPackagesUpdated += NumUpdated;
 }
 
+void FHoudiniEngineOutputStats::NotifyHapiCalls(const FString& FunctionName, const FHoudiniApiCallStats& CallStats)
+{
+	HapiCalls.FindOrAdd(FunctionName).Add(CallStats);
+}
+
 void FHoudiniEngineOutputStats::NotifyObjectsCreated(const FString& ObjectTypeName, int32 NumCreated)
 {
 	const int32 Count = OutputObjectsCreated.FindOrAdd(ObjectTypeName, 0);
@@ -29,6 +29,21 @@
 #include "CoreMinimal.h"
 #include "UObject/Class.h"
 
+// Totals of the HAPI calls made to a function, see FHoudiniApiTrace
+struct HOUDINIENGINE_API FHoudiniApiCallStats
+{
+	FHoudiniApiCallStats();
+
+	int64 NumCalls;
+	int64 NumFailures;
+	// Size of the arrays sent/received, estimated from the element counts
+	int64 NumBytes;
+	double TotalSeconds;
+	double MaxSeconds;
+
+	void Add(const FHoudiniApiCallStats& InOther);
+};
+
 struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 {
 	FHoudiniEngineOutputStats();
@@ -42,9 +57,15 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	TMap<FString, int32> OutputObjectsUpdated;
 	TMap<FString, int32> OutputObjectsReplaced;
 
+	// HAPI calls made while processing, keyed by function name
+	TMap<FString, FHoudiniApiCallStats> HapiCalls;
+
 	void NotifyPackageCreated(int32 NumCreated);
 	void NotifyPackageUpdated(int32 NumUpdated);
 
+	// HAPI calls traced
+	void NotifyHapiCalls(const FString& FunctionName, const FHoudiniApiCallStats& CallStats);
+
 	// Objects created
 	void NotifyObjectsCreated(const FString& ObjectTypeName, int32 NumCreated);
 	template<typename EnumT>
@@ -444,6 +444,7 @@
 #define HAPI_UNREAL_ATTRIB_GC_PIECE                                                       "unreal_gc_piece"
 #define HAPI_UNREAL_ATTRIB_GC_CLUSTER_PIECE                                               "unreal_gc_cluster"
 #define HAPI_UNREAL_ATTRIB_GC_NAME                                                       "unreal_gc_name"
+#define HAPI_UNREAL_ATTRIB_GC_PIECE_INDEX                                                 "unreal_gc_piece_index"
 
 #define HAPI_UNREAL_ATTRIB_GC_CLUSTERING_DAMAGE_THRESHOLD                                 "unreal_gc_clustering_damage_threshold"
 #define HAPI_UNREAL_ATTRIB_GC_COLLISIONS_COLLISION_TYPE                                   "unreal_gc_collisions_collision_type"
@@ -28,6 +28,7 @@
 
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniApiTrace.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
 
@@ -94,6 +95,8 @@ FHoudiniEngineScheduler::TaskDescription(
 void
 FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 {
+	FHoudiniApiTraceOwnerScope TraceOwner(Task.ActorPathName, Task.ActorName);
+
 	FString AssetN;
 	FHoudiniEngineString(Task.AssetHapiName).ToFString(AssetN);
 
@@ -250,6 +253,8 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 void
 FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 {
+	FHoudiniApiTraceOwnerScope TraceOwner(Task.ActorPathName, Task.ActorName);
+
 	if (!FHoudiniEngineUtils::IsInitialized())
 	{
 		HOUDINI_LOG_ERROR(
@@ -422,6 +427,8 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 void
 FHoudiniEngineScheduler::TaskDeleteAsset(const FHoudiniEngineTask & Task)
 {
+	FHoudiniApiTraceOwnerScope TraceOwner(Task.ActorPathName, Task.ActorName);
+
 	HOUDINI_LOG_MESSAGE(
 		TEXT("HAPI Asynchronous Destruction Started for %s. ")
 		TEXT("AssetId = %d"),
@@ -540,6 +547,8 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 void
 FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 {
+	FHoudiniApiTraceOwnerScope TraceOwner(Task.ActorPathName, Task.ActorName);
+
 	if (!FHoudiniEngineUtils::IsInitialized())
 	{
 		HOUDINI_LOG_ERROR(
@@ -31,6 +31,7 @@
 FHoudiniEngineTask::FHoudiniEngineTask()
 	: TaskType(EHoudiniEngineTaskType::None)
 	, ActorName(TEXT(""))
+	, ActorPathName(TEXT(""))
 	, AssetId(-1)
 	, bUseOutputNodes(false)
 	, bOutputTemplateGeos(false)
@@ -45,6 +46,7 @@ FHoudiniEngineTask::FHoudiniEngineTask(EHoudiniEngineTaskType InTaskType, FGuid
 	: HapiGUID(InHapiGUID)
 	, TaskType(InTaskType)
 	, ActorName(TEXT(""))
+	, ActorPathName(TEXT(""))
 	, AssetId(-1)
 	, bUseOutputNodes(false)
 	, bOutputTemplateGeos(false)
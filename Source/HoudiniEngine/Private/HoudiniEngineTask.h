@@ -86,6 +86,9 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// Name of the actor requesting this task.
 	FString ActorName;
 
+	// Path name of the component requesting this task, identifies it in the HAPI call traces.
+	FString ActorPathName;
+
 	// Asset Id.
 	HAPI_NodeId AssetId;
 
@@ -43,6 +43,8 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
+#include "HoudiniAssetLibraryRegistry.h"
+#include "HoudiniDetailsRefreshCoordinator.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniGeoPartObject.h"
@@ -135,6 +137,10 @@ FHoudiniEngineUtils::PackageGUIDItemNameLength = 8;
 //#define THRIFT_MAX_CHUNKSIZE			2048 * 2048
 //#define THRIFT_MAX_CHUNKSIZE_STRING		256 * 256
 
+// Strings are sent in smaller chunks due to their potential size
+const int32
+FHoudiniEngineUtils::ThriftMaxStringChunkSize = (THRIFT_MAX_CHUNKSIZE / 100);
+
 const FString
 FHoudiniEngineUtils::GetErrorDescription(HAPI_Result Result)
 {
@@ -1590,6 +1596,12 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 		AssetFileName = FPaths::GetPath(AssetFileName);
 	}
 
+	// Reuse the library if the same content has already been loaded in this session
+	if (FHoudiniAssetLibraryRegistry::FindLoadedLibrary(HoudiniAsset, AssetFileName, OutAssetLibraryId))
+		return true;
+
+	const double LoadStartTime = FPlatformTime::Seconds();
+
 	//Check whether we can Load from file/memory
 	bool bCanLoadFromMemory = (!HoudiniAsset->IsExpandedHDA() && HoudiniAsset->GetAssetBytesCount() > 0);
 		
@@ -1728,6 +1740,8 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 		return false;
 	}
 
+	FHoudiniAssetLibraryRegistry::RegisterLoadedLibrary(HoudiniAsset, AssetFileName, OutAssetLibraryId, FPlatformTime::Seconds() - LoadStartTime);
+
 	return true;
 }
 
@@ -3117,6 +3131,11 @@ FHoudiniEngineUtils::UpdateEditorProperties_Internal(TArray<UObject*> ObjectsToU
 		if (IsValid(SceneComp))
 		{
 			AllSceneComponents.Add(SceneComp);
+
+			// The details are rebuilt, the refresh coordinator's signature for this component might be outdated
+			if (UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(SceneComp))
+				FHoudiniDetailsRefreshCoordinator::InvalidateSignature(HAC);
+
 			continue;
 		}
 	}
@@ -3479,7 +3498,7 @@ FHoudiniEngineUtils::HapiSetAttributeStringData(
 	}
 
 	// Send strings in smaller chunks due to their potential size
-	int32 ChunkSize = (THRIFT_MAX_CHUNKSIZE / 100) / InAttributeInfo.tupleSize;
+	int32 ChunkSize = ThriftMaxStringChunkSize / InAttributeInfo.tupleSize;
 
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
 	if (InAttributeInfo.count > ChunkSize)
@@ -409,6 +409,9 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const FString& InAttributeName,
 			const HAPI_AttributeInfo& InAttributeInfo);
 
+		/** Maximum number of string values sent per call when setting string attributes. **/
+		static const int32 ThriftMaxStringChunkSize;
+
 		// Helper function to set Heightfield data
 		// The data will be sent in chunks if too large for thrift
 		static HAPI_Result HapiSetHeightFieldData(
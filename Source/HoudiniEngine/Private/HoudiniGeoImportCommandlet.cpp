@@ -38,6 +38,11 @@
 
 #include "PackageTools.h"
 
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
+
 #include "IDirectoryWatcher.h"
 
 #include "Internationalization/Regex.h"
@@ -82,7 +87,12 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 		"guid",
 		"watch",
 		"managerpid",
-		"bake"
+		"bake",
+		"batch",
+		"manifest",
+		"workers",
+		"force",
+		"hashcache"
 	};
 
 	HelpParamDescriptions = {
@@ -91,7 +101,12 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 		"Specify a GUID for the commandlet. Useful to identify the commandlet when the messaging system is used.",
 		"A directory to watch for new .bgeo files to import.",
 		"The PID of the owner/manager process. If the manager process dies the commandlet also quits.",
-		"Bake generated assets. Instancers are baked to blueprints. Not supported in -listen mode."
+		"Bake generated assets. Instancers are baked to blueprints. Not supported in -listen mode.",
+		"A directory to scan (recursively) for .bgeo files to import in batch. Packages are saved in bulk at the end of the batch.",
+		"A text file listing the .bgeo files to import in batch, one path per line. Relative paths are relative to the manifest.",
+		"Batch mode: the number of commandlet processes (each with its own Houdini Engine session) to import the files with. Defaults to 1.",
+		"Batch mode: import all the files, even the ones that have not changed since the last batch.",
+		"Batch mode: the file used to store the content hashes of the imported files. Defaults to a file in the project's Saved folder."
 	};
 
 	IsClient = false;
@@ -105,6 +120,7 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 
 	Mode = EHoudiniGeoImportCommandletMode::None;
 	bBakeOutputs = false;
+	bDeferPackageSaves = false;
 }
 
 void UHoudiniGeoImportCommandlet::PrintUsage() const
@@ -427,9 +443,12 @@ bool UHoudiniGeoImportCommandlet::StartHoudiniEngineSession()
 	// Start Houdini Engine session
 	HOUDINI_LOG_DISPLAY(TEXT("Starting Houdini Engine session..."));
 	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+	// Several commandlets can run at the same time (PDG import workers, batch workers),
+	// so each process needs its own pipe
+	const FString PipeName = FString::Printf(TEXT("hapi_bgeo_cmdlet_%u"), FPlatformProcess::GetCurrentProcessId());
 	if (!HoudiniEngine.CreateSession(
 		EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe,
-		"hapi_bgeo_cmdlet"))
+		FName(*PipeName)))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to start Houdini Engine session."));
 		return false;
@@ -625,9 +644,21 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 		}
 	}
 
-	if (PackagesToSave.Num() > 0)
+	if (bDeferPackageSaves)
 	{
-		UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true);
+		for (UPackage* Package : PackagesToSave)
+		{
+			DeferredPackagesToSave.AddUnique(Package);
+			DeferredPackageSourceFiles.AddUnique(Package, InFilename);
+		}
+	}
+	else if (PackagesToSave.Num() > 0)
+	{
+		if (!UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to save the packages imported from %s."), *InFilename);
+			return 1;
+		}
 	}
 	
 	PackagesToSave.Empty();
@@ -765,6 +796,11 @@ int32 UHoudiniGeoImportCommandlet::Main(const FString& InParams)
 			return 10;
 		}
 	}
+	else if (Params.Contains(TEXT("batch")) || Params.Contains(TEXT("manifest")))
+	{
+		Mode = EHoudiniGeoImportCommandletMode::Batch;
+		return RunBatch(Params, Switches);
+	}
 	else if (Tokens.Num() > 0)
 	{
 		Mode = EHoudiniGeoImportCommandletMode::SpecifiedFiles;
@@ -790,3 +826,485 @@ int32 UHoudiniGeoImportCommandlet::Main(const FString& InParams)
 
 	return 0;
 }
+
+bool
+UHoudiniGeoImportCommandlet::IsBGEOFile(const FString& InFileName)
+{
+	const FRegexPattern BGEOPattern(TEXT(R"((.*)\.(bgeo(\.[^\.]*)?)$)"));
+	FRegexMatcher BGEOMatcher(BGEOPattern, InFileName.ToLower());
+	return BGEOMatcher.FindNext() && BGEOMatcher.GetCaptureGroup(2).StartsWith(TEXT("bgeo"));
+}
+
+bool
+UHoudiniGeoImportCommandlet::GatherBatchFiles(const FString& InDirectory, const FString& InManifest, TArray<FString>& OutFiles)
+{
+	OutFiles.Empty();
+
+	if (!InDirectory.IsEmpty())
+	{
+		const FString Directory = FPaths::IsRelative(InDirectory) ? FPaths::ConvertRelativePathToFull(InDirectory) : InDirectory;
+		if (!IFileManager::Get().DirectoryExists(*Directory))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Batch directory %s does not exist."), *Directory);
+			return false;
+		}
+
+		TArray<FString> FoundFiles;
+		IFileManager::Get().FindFilesRecursive(FoundFiles, *Directory, TEXT("*.bgeo*"), true, false);
+		for (const FString& FoundFile : FoundFiles)
+		{
+			if (!IsBGEOFile(FoundFile))
+				continue;
+
+			FString FileName = FoundFile;
+			FPaths::NormalizeFilename(FileName);
+			OutFiles.Add(FileName);
+		}
+	}
+
+	if (!InManifest.IsEmpty())
+	{
+		const FString Manifest = FPaths::IsRelative(InManifest) ? FPaths::ConvertRelativePathToFull(InManifest) : InManifest;
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *Manifest))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Could not read the batch manifest %s."), *Manifest);
+			return false;
+		}
+
+		const FString ManifestDirectory = FPaths::GetPath(Manifest);
+		for (FString& Line : Lines)
+		{
+			Line.TrimStartAndEndInline();
+			// Skip empty lines and comments
+			if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+				continue;
+
+			FString FileName = FPaths::IsRelative(Line) ? FPaths::ConvertRelativePathToFull(ManifestDirectory, Line) : Line;
+			FPaths::NormalizeFilename(FileName);
+			if (!FPaths::FileExists(FileName))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Skipping %s listed in the manifest: the file does not exist."), *FileName);
+				continue;
+			}
+
+			OutFiles.Add(FileName);
+		}
+	}
+
+	// Sort and remove duplicates so the batch is stable from one run to the next
+	OutFiles.Sort();
+	for (int32 Idx = OutFiles.Num() - 1; Idx > 0; --Idx)
+	{
+		if (OutFiles[Idx] == OutFiles[Idx - 1])
+			OutFiles.RemoveAt(Idx);
+	}
+
+	return true;
+}
+
+void
+UHoudiniGeoImportCommandlet::SaveDeferredPackages(TSet<FString>& OutFailedFiles)
+{
+	// Packages that were destroyed before being saved weren't written either
+	for (auto It = DeferredPackageSourceFiles.CreateConstIterator(); It; ++It)
+	{
+		if (!IsValid(It.Key()))
+			OutFailedFiles.Add(It.Value());
+	}
+
+	DeferredPackagesToSave.RemoveAll([](const UPackage* InPackage) { return !IsValid(InPackage); });
+	if (DeferredPackagesToSave.Num() > 0)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("Saving %d packages..."), DeferredPackagesToSave.Num());
+		const bool bAllSaved = UEditorLoadingAndSavingUtils::SavePackages(DeferredPackagesToSave, true);
+
+		// The bulk save only reports a global result: the packages that are still dirty weren't written
+		for (UPackage* Package : DeferredPackagesToSave)
+		{
+			if (!Package->IsDirty())
+				continue;
+
+			TArray<FString> SourceFiles;
+			DeferredPackageSourceFiles.MultiFind(Package, SourceFiles);
+			HOUDINI_LOG_ERROR(TEXT("Failed to save %s (imported from %d file(s))."), *Package->GetName(), SourceFiles.Num());
+			OutFailedFiles.Append(SourceFiles);
+		}
+
+		if (!bAllSaved && OutFailedFiles.Num() <= 0)
+			HOUDINI_LOG_WARNING(TEXT("Saving the packages reported a failure, but all of them were written."));
+	}
+
+	DeferredPackagesToSave.Empty();
+	DeferredPackageSourceFiles.Empty();
+}
+
+void
+UHoudiniGeoImportCommandlet::ImportBatchFiles(
+	const TArray<FString>& InFiles,
+	TArray<FHoudiniGeoImportBatchFileResult>& OutResults,
+	double& OutSaveSeconds)
+{
+	OutSaveSeconds = 0.0;
+	if (InFiles.Num() <= 0)
+		return;
+
+	if (!IsHoudiniEngineSessionRunning() && !StartHoudiniEngineSession())
+	{
+		for (const FString& FileName : InFiles)
+			OutResults.Add(FHoudiniGeoImportBatchFileResult(FileName, false, 0.0));
+		return;
+	}
+
+	// Saving is by far the slowest part of small imports: defer it and save everything at once.
+	// Packages are still flushed regularly to bound the memory used by large batches.
+	const int32 MaxDeferredPackages = 512;
+	bDeferPackageSaves = true;
+
+	// Files whose packages could not be saved, they are reported as failed
+	TSet<FString> FailedSaveFiles;
+
+	for (int32 Idx = 0; Idx < InFiles.Num(); ++Idx)
+	{
+		if (OwnerProcHandle.IsValid() && !FPlatformProcess::IsProcRunning(OwnerProcHandle))
+		{
+			// The batch was cancelled, save what has been imported so far
+			HOUDINI_LOG_WARNING(TEXT("The owner process has disappeared, stopping the batch."));
+			break;
+		}
+
+		const FString& FileName = InFiles[Idx];
+		HOUDINI_LOG_DISPLAY(TEXT("[%d/%d] Importing %s..."), Idx + 1, InFiles.Num(), *FileName);
+
+		const double StartTime = FPlatformTime::Seconds();
+		FHoudiniPackageParams PackageParams;
+		PopulatePackageParams(FileName, PackageParams);
+
+		TArray<UHoudiniOutput*> Outputs;
+		const int32 Error = ImportBGEO(FileName, PackageParams, Outputs);
+		for (UHoudiniOutput* Output : Outputs)
+		{
+			if (IsValid(Output))
+				Output->RemoveFromRoot();
+		}
+		Outputs.Empty();
+
+		OutResults.Add(FHoudiniGeoImportBatchFileResult(FileName, Error == 0, FPlatformTime::Seconds() - StartTime));
+		if (Error != 0)
+			HOUDINI_LOG_WARNING(TEXT("Importing %s... Failed (%d)"), *FileName, Error);
+
+		if (DeferredPackagesToSave.Num() >= MaxDeferredPackages)
+		{
+			const double SaveStartTime = FPlatformTime::Seconds();
+			SaveDeferredPackages(FailedSaveFiles);
+			OutSaveSeconds += FPlatformTime::Seconds() - SaveStartTime;
+		}
+	}
+
+	const double SaveStartTime = FPlatformTime::Seconds();
+	SaveDeferredPackages(FailedSaveFiles);
+	OutSaveSeconds += FPlatformTime::Seconds() - SaveStartTime;
+
+	bDeferPackageSaves = false;
+
+	// An import is only successful once all of its packages are written
+	for (FHoudiniGeoImportBatchFileResult& Result : OutResults)
+	{
+		if (Result.bSuccess && FailedSaveFiles.Contains(Result.FileName))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Importing %s... Failed (the packages could not be saved)"), *Result.FileName);
+			Result.bSuccess = false;
+		}
+	}
+}
+
+bool
+UHoudiniGeoImportCommandlet::ImportBatchFilesInWorkers(
+	const TArray<FString>& InFiles,
+	const int32& InNumWorkers,
+	TArray<FHoudiniGeoImportBatchFileResult>& OutResults,
+	double& OutSaveSeconds)
+{
+	OutSaveSeconds = 0.0;
+
+	// A process can only have one Houdini Engine session, so the parallel imports are done by
+	// child commandlets, each importing its share of the files from a manifest and writing its results to a file
+	IFileManager& FileManager = IFileManager::Get();
+	FString ProjectPathOrName = FApp::GetProjectName();
+	if (FPaths::IsProjectFilePathSet())
+	{
+		const FString ProjectPath = FPaths::GetProjectFilePath();
+		if (!ProjectPath.IsEmpty())
+		{
+			ProjectPathOrName = FString::Printf(
+				TEXT("\"%s\""),
+				*FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath));
+		}
+	}
+
+	FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
+	if (!ExePath.IsEmpty())
+		ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+
+	if (ProjectPathOrName.IsEmpty() || ExePath.IsEmpty())
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not find the editor executable or project to start the batch workers."));
+		return false;
+	}
+
+	const FString WorkDirectory = FPaths::ConvertRelativePathToFull(
+		FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("HoudiniEngine"), TEXT("GeoImportBatch"), Guid.ToString()));
+	FileManager.MakeDirectory(*WorkDirectory, true);
+
+	// Distribute the files round robin, the files are sorted by path so neighbouring caches (often
+	// frames of the same sequence, with similar sizes) end up in different workers
+	const int32 NumWorkers = FMath::Min(InNumWorkers, InFiles.Num());
+	TArray<TArray<FString>> WorkerFiles;
+	WorkerFiles.SetNum(NumWorkers);
+	for (int32 Idx = 0; Idx < InFiles.Num(); ++Idx)
+		WorkerFiles[Idx % NumWorkers].Add(InFiles[Idx]);
+
+	TArray<FProcHandle> WorkerHandles;
+	TArray<FString> WorkerResultFiles;
+	for (int32 WorkerIdx = 0; WorkerIdx < NumWorkers; ++WorkerIdx)
+	{
+		const FString ManifestFile = FPaths::Combine(WorkDirectory, FString::Printf(TEXT("Worker%d.txt"), WorkerIdx));
+		const FString ResultFile = FPaths::Combine(WorkDirectory, FString::Printf(TEXT("Worker%d_Results.txt"), WorkerIdx));
+		FileManager.Delete(*ResultFile, false, true, true);
+		if (!FFileHelper::SaveStringArrayToFile(WorkerFiles[WorkerIdx], *ManifestFile))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Could not write the batch worker manifest %s."), *ManifestFile);
+			continue;
+		}
+
+		const FString CommandLineParameters = FString::Printf(
+			TEXT("%s -run=HoudiniGeoImport -manifest=\"%s\" -batchresults=\"%s\" -managerpid=%u%s"),
+			*ProjectPathOrName,
+			*ManifestFile,
+			*ResultFile,
+			FPlatformProcess::GetCurrentProcessId(),
+			bBakeOutputs ? TEXT(" -bake") : TEXT(""));
+
+		HOUDINI_LOG_DISPLAY(TEXT("Starting batch worker %d with %d files..."), WorkerIdx, WorkerFiles[WorkerIdx].Num());
+		FProcHandle Handle = FPlatformProcess::CreateProc(
+			*ExePath, *CommandLineParameters, false, true, false, nullptr, 0, nullptr, nullptr);
+		if (!Handle.IsValid())
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to start batch worker %d."), WorkerIdx);
+			continue;
+		}
+
+		WorkerHandles.Add(Handle);
+		WorkerResultFiles.Add(ResultFile);
+	}
+
+	// Wait for the workers
+	for (FProcHandle& Handle : WorkerHandles)
+	{
+		FPlatformProcess::WaitForProc(Handle);
+		FPlatformProcess::CloseProc(Handle);
+	}
+
+	// Gather the results, files without a result (worker failed to start or crashed) are failures
+	TSet<FString> FilesWithResult;
+	for (const FString& ResultFile : WorkerResultFiles)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *ResultFile))
+			continue;
+
+		double WorkerSaveSeconds = 0.0;
+		for (const FString& Line : Lines)
+		{
+			// status \t seconds \t file
+			TArray<FString> Fields;
+			Line.ParseIntoArray(Fields, TEXT("\t"), false);
+			if (Fields.Num() < 2)
+				continue;
+
+			const double Seconds = FCString::Atod(*Fields[1]);
+			if (Fields[0] == TEXT("save"))
+			{
+				WorkerSaveSeconds = Seconds;
+			}
+			else if (Fields.Num() >= 3)
+			{
+				OutResults.Add(FHoudiniGeoImportBatchFileResult(Fields[2], Fields[0] == TEXT("ok"), Seconds));
+				FilesWithResult.Add(Fields[2]);
+			}
+		}
+		// Workers save in parallel, report the longest save
+		OutSaveSeconds = FMath::Max(OutSaveSeconds, WorkerSaveSeconds);
+	}
+
+	for (const FString& FileName : InFiles)
+	{
+		if (!FilesWithResult.Contains(FileName))
+			OutResults.Add(FHoudiniGeoImportBatchFileResult(FileName, false, 0.0));
+	}
+
+	FileManager.DeleteDirectory(*WorkDirectory, false, true);
+
+	return WorkerHandles.Num() > 0;
+}
+
+int32
+UHoudiniGeoImportCommandlet::RunBatch(const TMap<FString, FString>& InParams, const TArray<FString>& InSwitches)
+{
+	const double BatchStartTime = FPlatformTime::Seconds();
+
+	const FString* DirectoryParam = InParams.Find(TEXT("batch"));
+	const FString* ManifestParam = InParams.Find(TEXT("manifest"));
+	TArray<FString> Files;
+	if (!GatherBatchFiles(
+		DirectoryParam ? DirectoryParam->TrimQuotes() : FString(), 
+		ManifestParam ? ManifestParam->TrimQuotes() : FString(), 
+		Files))
+	{
+		return 1;
+	}
+
+	// -batchresults is passed to the worker commandlets started by ImportBatchFilesInWorkers:
+	// import the files and write the results for the main commandlet, which owns the hash cache
+	if (const FString* ResultsParam = InParams.Find(TEXT("batchresults")))
+	{
+		if (const FString* ManagerPidParam = InParams.Find(TEXT("managerpid")))
+			OwnerProcHandle = FPlatformProcess::OpenProcess(FCString::Strtoi(**ManagerPidParam, nullptr, 10));
+
+		TArray<FHoudiniGeoImportBatchFileResult> Results;
+		double SaveSeconds = 0.0;
+		ImportBatchFiles(Files, Results, SaveSeconds);
+
+		TArray<FString> Lines;
+		for (const FHoudiniGeoImportBatchFileResult& Result : Results)
+			Lines.Add(FString::Printf(TEXT("%s\t%f\t%s"), Result.bSuccess ? TEXT("ok") : TEXT("failed"), Result.ImportSeconds, *Result.FileName));
+		Lines.Add(FString::Printf(TEXT("save\t%f"), SaveSeconds));
+
+		return FFileHelper::SaveStringArrayToFile(Lines, *ResultsParam->TrimQuotes()) ? 0 : 1;
+	}
+
+	const double GatherEndTime = FPlatformTime::Seconds();
+	const int32 NumFound = Files.Num();
+	HOUDINI_LOG_DISPLAY(TEXT("Batch: found %d .bgeo files."), NumFound);
+
+	// Hash the files in parallel, reading is IO bound so this is mostly useful on large batches
+	TArray<FString> Hashes;
+	Hashes.SetNum(Files.Num());
+	ParallelFor(Files.Num(), [&Files, &Hashes](int32 Idx)
+	{
+		Hashes[Idx] = LexToString(FMD5Hash::HashFile(*Files[Idx]));
+	});
+
+	// Load the hashes of the previous batch, one "hash \t file" entry per line.
+	// Baked and temporary imports are tracked separately as they produce different assets.
+	FString HashCacheFile;
+	if (const FString* HashCacheParam = InParams.Find(TEXT("hashcache")))
+	{
+		HashCacheFile = HashCacheParam->TrimQuotes();
+	}
+	else
+	{
+		HashCacheFile = FPaths::Combine(
+			FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), 
+			bBakeOutputs ? TEXT("GeoImportBatchHashes_Bake.txt") : TEXT("GeoImportBatchHashes.txt"));
+	}
+
+	TMap<FString, FString> CachedHashes;
+	{
+		TArray<FString> Lines;
+		if (FFileHelper::LoadFileToStringArray(Lines, *HashCacheFile))
+		{
+			for (const FString& Line : Lines)
+			{
+				FString Hash;
+				FString FileName;
+				if (Line.Split(TEXT("\t"), &Hash, &FileName))
+					CachedHashes.Add(FileName, Hash);
+			}
+		}
+	}
+
+	// Skip the files that have not changed since they were last imported successfully
+	const bool bForce = InSwitches.Contains(TEXT("force"));
+	TArray<FString> FilesToImport;
+	TMap<FString, FString> FileHashes;
+	for (int32 Idx = 0; Idx < Files.Num(); ++Idx)
+	{
+		const FString& Hash = Hashes[Idx];
+		FileHashes.Add(Files[Idx], Hash);
+
+		const FString* CachedHash = CachedHashes.Find(Files[Idx]);
+		if (!bForce && !Hash.IsEmpty() && CachedHash && *CachedHash == Hash)
+			continue;
+
+		FilesToImport.Add(Files[Idx]);
+	}
+	const int32 NumSkipped = NumFound - FilesToImport.Num();
+	HOUDINI_LOG_DISPLAY(TEXT("Batch: %d files unchanged since the last batch, %d to import."), NumSkipped, FilesToImport.Num());
+
+	const double HashEndTime = FPlatformTime::Seconds();
+
+	int32 NumWorkers = 1;
+	if (const FString* WorkersParam = InParams.Find(TEXT("workers")))
+		NumWorkers = FMath::Max(1, FCString::Atoi(**WorkersParam));
+
+	TArray<FHoudiniGeoImportBatchFileResult> Results;
+	double SaveSeconds = 0.0;
+	if (NumWorkers > 1 && FilesToImport.Num() > 1)
+	{
+		if (!ImportBatchFilesInWorkers(FilesToImport, NumWorkers, Results, SaveSeconds))
+			HOUDINI_LOG_ERROR(TEXT("Batch: no worker could be started."));
+	}
+	else
+	{
+		ImportBatchFiles(FilesToImport, Results, SaveSeconds);
+	}
+
+	const double ImportEndTime = FPlatformTime::Seconds();
+
+	// Update the hash cache with the successful imports
+	int32 NumFailed = 0;
+	double TotalImportSeconds = 0.0;
+	for (const FHoudiniGeoImportBatchFileResult& Result : Results)
+	{
+		TotalImportSeconds += Result.ImportSeconds;
+		if (!Result.bSuccess)
+		{
+			NumFailed++;
+			CachedHashes.Remove(Result.FileName);
+			continue;
+		}
+
+		const FString* Hash = FileHashes.Find(Result.FileName);
+		if (Hash && !Hash->IsEmpty())
+			CachedHashes.Add(Result.FileName, *Hash);
+	}
+
+	{
+		TArray<FString> Lines;
+		for (const auto& Entry : CachedHashes)
+			Lines.Add(FString::Printf(TEXT("%s\t%s"), *Entry.Value, *Entry.Key));
+		if (!FFileHelper::SaveStringArrayToFile(Lines, *HashCacheFile))
+			HOUDINI_LOG_WARNING(TEXT("Batch: could not write the hash cache %s."), *HashCacheFile);
+	}
+
+	// Timing report
+	const double BatchEndTime = FPlatformTime::Seconds();
+	HOUDINI_LOG_DISPLAY(TEXT("===== HoudiniGeoImport batch report ====="));
+	HOUDINI_LOG_DISPLAY(TEXT("Files: %d found, %d unchanged, %d imported, %d failed (%d worker(s))"),
+		NumFound, NumSkipped, Results.Num() - NumFailed, NumFailed, NumWorkers > 1 && FilesToImport.Num() > 1 ? FMath::Min(NumWorkers, FilesToImport.Num()) : 1);
+	HOUDINI_LOG_DISPLAY(TEXT("Gather: %.3fs"), GatherEndTime - BatchStartTime);
+	HOUDINI_LOG_DISPLAY(TEXT("Hash: %.3fs"), HashEndTime - GatherEndTime);
+	HOUDINI_LOG_DISPLAY(TEXT("Import: %.3fs (%.3fs of file imports, %.3fs saving packages)"), ImportEndTime - HashEndTime, TotalImportSeconds, SaveSeconds);
+	HOUDINI_LOG_DISPLAY(TEXT("Total: %.3fs"), BatchEndTime - BatchStartTime);
+
+	// The slowest files
+	Results.Sort([](const FHoudiniGeoImportBatchFileResult& A, const FHoudiniGeoImportBatchFileResult& B) { return A.ImportSeconds > B.ImportSeconds; });
+	const int32 NumSlowest = FMath::Min(5, Results.Num());
+	for (int32 Idx = 0; Idx < NumSlowest; ++Idx)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("  %.3fs %s%s"), Results[Idx].ImportSeconds, *Results[Idx].FileName, Results[Idx].bSuccess ? TEXT("") : TEXT(" (failed)"));
+	}
+
+	return NumFailed > 0 ? 1 : 0;
+}
@@ -42,6 +42,7 @@ class FSocket;
 
 class UHoudiniGeoImporter;
 class UHoudiniOutput;
+class UPackage;
 
 struct FHoudiniPackageParams;
 
@@ -54,7 +55,9 @@ enum class EHoudiniGeoImportCommandletMode : uint8
 	// Directory watch mode
 	Watch,
 	// Listen mode (via PDGManager)
-	Listen
+	Listen,
+	// Batch import of a directory or manifest
+	Batch
 };
 
 struct FDiscoveredFileData
@@ -79,6 +82,24 @@ public:
 	bool bImported;
 };
 
+// Result of the import of one file in batch mode
+struct FHoudiniGeoImportBatchFileResult
+{
+	FHoudiniGeoImportBatchFileResult() : bSuccess(false), ImportSeconds(0.0) {}
+
+	FHoudiniGeoImportBatchFileResult(const FString& InFileName, bool bInSuccess, double InImportSeconds)
+		: FileName(InFileName), bSuccess(bInSuccess), ImportSeconds(InImportSeconds) {}
+
+	// Full/absolute file path
+	FString FileName;
+
+	// The file has been imported successfully
+	bool bSuccess;
+
+	// Time spent importing the file, excluding the package save
+	double ImportSeconds;
+};
+
 UCLASS()
 class HOUDINIENGINE_API UHoudiniGeoImportCommandlet : public UCommandlet
 {
@@ -124,6 +145,29 @@ protected:
 
 	void TickDiscoveredFiles();
 
+	// Batch mode: imports the .bgeo files of a directory (-batch) or listed in a manifest (-manifest),
+	// skipping the files whose content hash has not changed since the last batch
+	int32 RunBatch(const TMap<FString, FString>& InParams, const TArray<FString>& InSwitches);
+
+	// Finds the .bgeo files in a directory (recursively) or listed in a manifest file
+	static bool GatherBatchFiles(const FString& InDirectory, const FString& InManifest, TArray<FString>& OutFiles);
+
+	// Imports the files in this process, the packages are saved in bulk after the imports
+	void ImportBatchFiles(const TArray<FString>& InFiles, TArray<FHoudiniGeoImportBatchFileResult>& OutResults, double& OutSaveSeconds);
+
+	// Splits the files across several commandlet processes, each with its own HAPI session, and waits for them
+	bool ImportBatchFilesInWorkers(
+		const TArray<FString>& InFiles, 
+		const int32& InNumWorkers, 
+		TArray<FHoudiniGeoImportBatchFileResult>& OutResults, 
+		double& OutSaveSeconds);
+
+	// Saves the packages collected while bDeferPackageSaves is set.
+	// The files that created a package which could not be saved are added to OutFailedFiles.
+	void SaveDeferredPackages(TSet<FString>& OutFailedFiles);
+
+	static bool IsBGEOFile(const FString& InFileName);
+
 private:
 
 	// Messaging end point for receiving messages from PDG manager
@@ -152,4 +196,12 @@ private:
 	
 	// Bake outputs via FHoudiniEngineBakeUtils
 	bool bBakeOutputs;
+
+	// When set, ImportBGEO adds the packages to DeferredPackagesToSave instead of saving them
+	bool bDeferPackageSaves;
+
+	// Packages waiting to be saved in bulk (batch mode)
+	TArray<UPackage*> DeferredPackagesToSave;
+	// The files that created or modified each deferred package
+	TMultiMap<UPackage*, FString> DeferredPackageSourceFiles;
 };
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionObject.h"
 #include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionActor.h"
 #include "Materials/Material.h"
+#include "Async/ParallelFor.h"
 
 void
 FHoudiniGeometryCollectionTranslator::SetupGeometryCollectionComponentFromOutputs(
@@ -133,6 +134,15 @@ FHoudiniGeometryCollectionTranslator::SetupGeometryCollectionComponentFromOutput
 	
 		// Append the static meshes build from instancers to the UGeometryCollection, destroying the StaticMeshComponents as you go
 		// Kind of similar to UFractureToolGenerateAsset::ConvertStaticMeshToGeometryCollection
+		// The pieces' render data is converted in parallel, then appended to the collection at once.
+		TArray<FHoudiniGeometryCollectionPiece*> ValidPieces;
+		TArray<const UStaticMesh*> PieceStaticMeshes;
+		TArray<FTransform> PieceTransforms;
+		TArray<TArray<UMaterialInterface*>> PieceMaterials;
+		ValidPieces.Reserve(GeometryCollectionPieces.Num());
+		PieceStaticMeshes.Reserve(GeometryCollectionPieces.Num());
+		PieceTransforms.Reserve(GeometryCollectionPieces.Num());
+		PieceMaterials.Reserve(GeometryCollectionPieces.Num());
 		for (auto & GeometryCollectionPiece : GeometryCollectionPieces)
 		{
 			if (!GeometryCollectionPiece.InstancerOutput || !IsValid(GeometryCollectionPiece.InstancerOutput->OutputComponent))
@@ -145,8 +155,6 @@ FHoudiniGeometryCollectionTranslator::SetupGeometryCollectionComponentFromOutput
 			TArray<FHoudiniGeometryCollectionPiece *> & Cluster = Clusters.FindOrAdd(ClusterKey);
 			Cluster.Add(&GeometryCollectionPiece);
 			
-			UObject * OldComponent = GeometryCollectionPiece.InstancerOutput->OutputComponent;
-			
 			UStaticMeshComponent * StaticMeshComponent = Cast<UStaticMeshComponent>(GeometryCollectionPiece.InstancerOutput->OutputComponent);
 			UStaticMesh * ComponentStaticMesh = StaticMeshComponent->GetStaticMesh();
 			FTransform ComponentTransform(StaticMeshComponent->GetComponentTransform());
@@ -155,14 +163,46 @@ FHoudiniGeometryCollectionTranslator::SetupGeometryCollectionComponentFromOutput
 			decltype(FGeometryCollectionSource::SourceMaterial) SourceMaterials(StaticMeshComponent->GetMaterials());
 			GeometryCollection->GeometrySource.Add({ SourceSoftObjectPath, ComponentTransform, SourceMaterials });
 
-			FHoudiniGeometryCollectionTranslator::AppendStaticMesh(ComponentStaticMesh, SourceMaterials, ComponentTransform, GeometryCollection, true);
+			ValidPieces.Add(&GeometryCollectionPiece);
+			PieceStaticMeshes.Add(ComponentStaticMesh);
+			PieceTransforms.Add(ComponentTransform);
+			PieceMaterials.Add(SourceMaterials);
+		}
 
-			RemoveAndDestroyComponent(OldComponent);
-			
+		TArray<FHoudiniGeometryCollectionFragment> Fragments;
+		TArray<bool> FragmentBuilt;
+		Fragments.SetNum(ValidPieces.Num());
+		FragmentBuilt.SetNumZeroed(ValidPieces.Num());
+		ParallelFor(ValidPieces.Num(), [&](int32 PieceIdx)
+		{
+			FragmentBuilt[PieceIdx] = BuildGeometryCollectionFragment(
+				PieceStaticMeshes[PieceIdx], PieceMaterials[PieceIdx], PieceTransforms[PieceIdx], Fragments[PieceIdx]);
+		});
+
+		// Pieces without a valid mesh are not added, and keep the index of the previous piece
+		TArray<FHoudiniGeometryCollectionFragment> BuiltFragments;
+		BuiltFragments.Reserve(Fragments.Num());
+		for (int32 PieceIdx = 0; PieceIdx < Fragments.Num(); PieceIdx++)
+		{
+			if (FragmentBuilt[PieceIdx])
+				BuiltFragments.Add(MoveTemp(Fragments[PieceIdx]));
+		}
+		Fragments.Empty();
+
+		const int32 FirstTransformIndex = AppendGeometryCollectionFragments(BuiltFragments, GeometryCollection, true);
+		BuiltFragments.Empty();
+
+		int32 GeometryIndex = FirstTransformIndex - 1;
+		for (int32 PieceIdx = 0; PieceIdx < ValidPieces.Num(); PieceIdx++)
+		{
+			FHoudiniGeometryCollectionPiece& GeometryCollectionPiece = *ValidPieces[PieceIdx];
+
+			RemoveAndDestroyComponent(GeometryCollectionPiece.InstancerOutput->OutputComponent);
 			GeometryCollectionPiece.InstancerOutput->OutputComponent = nullptr;
 	
 			// Sets the GeometryIndex, to identify which this piece is when dealing with the geometry collection
-			int32 GeometryIndex = GeometryCollection->NumElements(FGeometryCollection::TransformGroup) - 1;
+			if (FragmentBuilt[PieceIdx])
+				GeometryIndex++;
 			GeometryCollectionPiece.GeometryIndex = GeometryIndex;
 		}
 		
@@ -988,187 +1028,290 @@ FHoudiniGeometryCollectionTranslator::ApplyGeometryCollectionAttributes(
 
 
 //----------------------------------------------------------------------------------------------------------
-// AppendStaticMesh function copied from GeometryCollectionConversion.h
+// Fragment conversion and append, based on AppendStaticMesh from GeometryCollectionConversion.h
 // Replace this when you can figure out a way to access this code without depending on the GC plugin
+// The conversion is split from the append so that fragments can be converted in parallel, and the
+// collection's groups only grow once instead of once per fragment.
 //----------------------------------------------------------------------------------------------------------
-void 
-FHoudiniGeometryCollectionTranslator::AppendStaticMesh(
+bool
+FHoudiniGeometryCollectionTranslator::BuildGeometryCollectionFragment(
 	const UStaticMesh* StaticMesh,
 	const TArray<UMaterialInterface*>& Materials,
 	const FTransform& StaticMeshTransform,
-	UGeometryCollection* GeometryCollectionObject,
-	const bool& ReindexMaterials,
-	const int32& Level)
+	FHoudiniGeometryCollectionFragment& OutFragment)
 {
 	if (!IsValid(StaticMesh))
+		return false;
+
+	// @todo : Discuss how to handle multiple LOD's
+	if (!StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() <= 0)
+		return false;
+
+	const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[0];
+	const FStaticMeshVertexBuffers& VertexBuffer = LODResources.VertexBuffers;
+
+	OutFragment.Name = StaticMesh->GetName();
+	OutFragment.Transform = StaticMeshTransform;
+	OutFragment.Materials = Materials;
+
+	// Vertex information
+	const int32 VertexCount = VertexBuffer.PositionVertexBuffer.GetNumVertices();
+	const bool bHasColors = VertexBuffer.ColorVertexBuffer.GetNumVertices() == VertexCount;
+	const FVector Scale = StaticMeshTransform.GetScale3D();
+
+	OutFragment.Vertices.SetNumUninitialized(VertexCount);
+	OutFragment.TangentU.SetNumUninitialized(VertexCount);
+	OutFragment.TangentV.SetNumUninitialized(VertexCount);
+	OutFragment.Normals.SetNumUninitialized(VertexCount);
+	OutFragment.UVs.SetNumUninitialized(VertexCount);
+	OutFragment.Colors.SetNumUninitialized(bHasColors ? VertexCount : 0);
+
+	FVector Center(FVector::ZeroVector);
+	for (int32 VertexIndex = 0; VertexIndex < VertexCount; VertexIndex++)
 	{
-		return;
+		OutFragment.Vertices[VertexIndex] = VertexBuffer.PositionVertexBuffer.VertexPosition(VertexIndex) * Scale;
+		OutFragment.TangentU[VertexIndex] = VertexBuffer.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
+		OutFragment.TangentV[VertexIndex] = VertexBuffer.StaticMeshVertexBuffer.VertexTangentY(VertexIndex);
+		OutFragment.Normals[VertexIndex] = VertexBuffer.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex);
+
+		// @todo : Support multiple UV's per vertex based on MAX_STATIC_TEXCOORDS
+		OutFragment.UVs[VertexIndex] = VertexBuffer.StaticMeshVertexBuffer.GetVertexUV(VertexIndex, 0);
+		if (bHasColors)
+			OutFragment.Colors[VertexIndex] = VertexBuffer.ColorVertexBuffer.VertexColor(VertexIndex);
+
+		Center += OutFragment.Vertices[VertexIndex];
+	}
+	if (VertexCount) Center /= VertexCount;
+
+	// Triangle indices
+	FIndexArrayView IndexBufferView = LODResources.IndexBuffer.GetArrayView();
+	const int32 IndicesCount = LODResources.IndexBuffer.GetNumIndices() / 3;
+	OutFragment.Indices.SetNumUninitialized(IndicesCount);
+	OutFragment.FaceMaterialIndices.Init(INDEX_NONE, IndicesCount);
+	for (int32 IndicesIndex = 0, StaticIndex = 0; IndicesIndex < IndicesCount; IndicesIndex++, StaticIndex += 3)
+	{
+		OutFragment.Indices[IndicesIndex] = FIntVector(
+			IndexBufferView[StaticIndex],
+			IndexBufferView[StaticIndex + 1],
+			IndexBufferView[StaticIndex + 2]);
+	}
+
+	// Sections, and the material of their faces
+	// note the divide by 3 - the GeometryCollection stores indices in tuples of 3 rather than in a flat array
+	OutFragment.Sections.Reset(LODResources.Sections.Num());
+	for (const FStaticMeshSection& CurrSection : LODResources.Sections)
+	{
+		FHoudiniGeometryCollectionFragmentSection& Section = OutFragment.Sections.AddDefaulted_GetRef();
+		Section.MaterialIndex = CurrSection.MaterialIndex;
+		Section.FirstIndex = CurrSection.FirstIndex;
+		Section.NumTriangles = CurrSection.NumTriangles;
+		Section.MinVertexIndex = CurrSection.MinVertexIndex;
+		Section.MaxVertexIndex = CurrSection.MaxVertexIndex;
+
+		const int32 FirstFace = FMath::Clamp<int32>(CurrSection.FirstIndex / 3, 0, IndicesCount);
+		const int32 LastFace = FMath::Clamp<int32>(FirstFace + CurrSection.NumTriangles, 0, IndicesCount);
+		for (int32 i = FirstFace; i < LastFace; ++i)
+			OutFragment.FaceMaterialIndices[i] = CurrSection.MaterialIndex;
+	}
+
+	// Inner/Outer vertices, bounding box
+	OutFragment.BoundingBox = FBox(ForceInitToZero);
+	OutFragment.InnerRadius = FLT_MAX;
+	OutFragment.OuterRadius = -FLT_MAX;
+	for (const FVector& Vertex : OutFragment.Vertices)
+	{
+		OutFragment.BoundingBox += Vertex;
+
+		float Delta = (Center - Vertex).Size();
+		OutFragment.InnerRadius = FMath::Min(OutFragment.InnerRadius, Delta);
+		OutFragment.OuterRadius = FMath::Max(OutFragment.OuterRadius, Delta);
 	}
 
+	// Inner/Outer centroid and edges
+	const TArray<FVector>& Vertices = OutFragment.Vertices;
+	for (const FIntVector& Face : OutFragment.Indices)
+	{
+		FVector Centroid(0);
+		for (int e = 0; e < 3; e++)
+		{
+			Centroid += Vertices[Face[e]];
+		}
+		Centroid /= 3;
+
+		float Delta = (Center - Centroid).Size();
+		OutFragment.InnerRadius = FMath::Min(OutFragment.InnerRadius, Delta);
+		OutFragment.OuterRadius = FMath::Max(OutFragment.OuterRadius, Delta);
+
+		for (int e = 0; e < 3; e++)
+		{
+			int i = e, j = (e + 1) % 3;
+			FVector Edge = Vertices[Face[i]] + 0.5 * (Vertices[Face[j]] - Vertices[Face[i]]);
+			Delta = (Center - Edge).Size();
+			OutFragment.InnerRadius = FMath::Min(OutFragment.InnerRadius, Delta);
+			OutFragment.OuterRadius = FMath::Max(OutFragment.OuterRadius, Delta);
+		}
+	}
+
+	return true;
+}
+
+int32
+FHoudiniGeometryCollectionTranslator::AppendGeometryCollectionFragments(
+	const TArray<FHoudiniGeometryCollectionFragment>& InFragments,
+	UGeometryCollection* GeometryCollectionObject,
+	const bool& bReindexMaterials)
+{
 	check(GeometryCollectionObject);
 	TSharedPtr<FGeometryCollection, ESPMode::ThreadSafe> GeometryCollectionPtr = GeometryCollectionObject->GetGeometryCollection();
 	FGeometryCollection* GeometryCollection = GeometryCollectionPtr.Get();
 	check(GeometryCollection);
 
-	// @todo : Discuss how to handle multiple LOD's
-	if (StaticMesh->GetRenderData() && StaticMesh->GetRenderData()->LODResources.Num() > 0)
+	const int32 NumFragments = InFragments.Num();
+	if (NumFragments <= 0)
+		return GeometryCollection->NumElements(FGeometryCollection::TransformGroup);
+
+	// Offsets of each fragment's data in the collection
+	const int32 InitialNumVertices = GeometryCollection->NumElements(FGeometryCollection::VerticesGroup);
+	const int32 InitialNumFaces = GeometryCollection->NumElements(FGeometryCollection::FacesGroup);
+	const int32 InitialNumSections = GeometryCollection->NumElements(FGeometryCollection::MaterialGroup);
+	const int32 InitialNumMaterials = GeometryCollectionObject->Materials.Num();
+
+	TArray<int32> VertexStarts;
+	TArray<int32> FaceStarts;
+	TArray<int32> SectionStarts;
+	TArray<int32> MaterialStarts;
+	VertexStarts.SetNumUninitialized(NumFragments);
+	FaceStarts.SetNumUninitialized(NumFragments);
+	SectionStarts.SetNumUninitialized(NumFragments);
+	MaterialStarts.SetNumUninitialized(NumFragments);
+
+	int32 NumVertices = 0;
+	int32 NumFaces = 0;
+	int32 NumSections = 0;
+	int32 NumMaterials = 0;
+	for (int32 FragmentIdx = 0; FragmentIdx < NumFragments; FragmentIdx++)
+	{
+		const FHoudiniGeometryCollectionFragment& Fragment = InFragments[FragmentIdx];
+		VertexStarts[FragmentIdx] = InitialNumVertices + NumVertices;
+		FaceStarts[FragmentIdx] = InitialNumFaces + NumFaces;
+		SectionStarts[FragmentIdx] = InitialNumSections + NumSections;
+		MaterialStarts[FragmentIdx] = InitialNumMaterials + NumMaterials;
+
+		NumVertices += Fragment.Vertices.Num();
+		NumFaces += Fragment.Indices.Num();
+		NumSections += Fragment.Sections.Num();
+		NumMaterials += Fragment.Materials.Num();
+	}
+
+	// Grow each group once
+	if (NumVertices > 0)
+		GeometryCollection->AddElements(NumVertices, FGeometryCollection::VerticesGroup);
+	if (NumFaces > 0)
+		GeometryCollection->AddElements(NumFaces, FGeometryCollection::FacesGroup);
+	if (NumSections > 0)
+		GeometryCollection->AddElements(NumSections, FGeometryCollection::MaterialGroup);
+	const int32 TransformStart = GeometryCollection->AddElements(NumFragments, FGeometryCollection::TransformGroup);
+	const int32 GeometryStart = GeometryCollection->AddElements(NumFragments, FGeometryCollection::GeometryGroup);
+
+	TManagedArray<FVector>& Vertex = GeometryCollection->Vertex;
+	TManagedArray<FVector>& TangentU = GeometryCollection->TangentU;
+	TManagedArray<FVector>& TangentV = GeometryCollection->TangentV;
+	TManagedArray<FVector>& Normal = GeometryCollection->Normal;
+	TManagedArray<FVector2D>& UV = GeometryCollection->UV;
+	TManagedArray<FLinearColor>& Color = GeometryCollection->Color;
+	TManagedArray<int32>& BoneMap = GeometryCollection->BoneMap;
+
+	TManagedArray<FIntVector>& Indices = GeometryCollection->Indices;
+	TManagedArray<bool>& Visible = GeometryCollection->Visible;
+	TManagedArray<int32>& MaterialID = GeometryCollection->MaterialID;
+	TManagedArray<int32>& MaterialIndex = GeometryCollection->MaterialIndex;
+
+	TManagedArray<FTransform>& Transform = GeometryCollection->Transform;
+	TManagedArray<int32>& Parent = GeometryCollection->Parent;
+	TManagedArray<int32>& SimulationType = GeometryCollection->SimulationType;
+	TManagedArray<FString>& BoneName = GeometryCollection->BoneName;
+	TManagedArray<int32>& TransformToGeometryIndexArray = GeometryCollection->TransformToGeometryIndex;
+
+	TManagedArray<int32>& TransformIndex = GeometryCollection->TransformIndex;
+	TManagedArray<FBox>& BoundingBox = GeometryCollection->BoundingBox;
+	TManagedArray<float>& InnerRadius = GeometryCollection->InnerRadius;
+	TManagedArray<float>& OuterRadius = GeometryCollection->OuterRadius;
+	TManagedArray<int32>& VertexStartArray = GeometryCollection->VertexStart;
+	TManagedArray<int32>& VertexCountArray = GeometryCollection->VertexCount;
+	TManagedArray<int32>& FaceStartArray = GeometryCollection->FaceStart;
+	TManagedArray<int32>& FaceCountArray = GeometryCollection->FaceCount;
+
+	// Each fragment writes to its own ranges, so they can be copied in parallel
+	ParallelFor(NumFragments, [&](int32 FragmentIdx)
 	{
-		const FStaticMeshVertexBuffers& VertexBuffer = StaticMesh->GetRenderData()->LODResources[0].VertexBuffers;
-
-		// vertex information
-		TManagedArray<FVector>& Vertex = GeometryCollection->Vertex;
-		TManagedArray<FVector>& TangentU = GeometryCollection->TangentU;
-		TManagedArray<FVector>& TangentV = GeometryCollection->TangentV;
-		TManagedArray<FVector>& Normal = GeometryCollection->Normal;
-		TManagedArray<FVector2D>& UV = GeometryCollection->UV;
-		TManagedArray<FLinearColor>& Color = GeometryCollection->Color;
-		TManagedArray<int32>& BoneMap = GeometryCollection->BoneMap;
-		TManagedArray<FLinearColor>& BoneColor = GeometryCollection->BoneColor;
-		TManagedArray<FString>& BoneName = GeometryCollection->BoneName;
-
-		const int32 VertexCount = VertexBuffer.PositionVertexBuffer.GetNumVertices();
-		int InitialNumVertices = GeometryCollection->NumElements(FGeometryCollection::VerticesGroup);
-		int VertexStart = GeometryCollection->AddElements(VertexCount, FGeometryCollection::VerticesGroup);
-		FVector Scale = StaticMeshTransform.GetScale3D();
+		const FHoudiniGeometryCollectionFragment& Fragment = InFragments[FragmentIdx];
+		const int32 VertexStart = VertexStarts[FragmentIdx];
+		const int32 FaceStart = FaceStarts[FragmentIdx];
+		const int32 MaterialStart = MaterialStarts[FragmentIdx];
+		const int32 TransformIndex1 = TransformStart + FragmentIdx;
+		const int32 GeometryIndex = GeometryStart + FragmentIdx;
+
+		const int32 VertexCount = Fragment.Vertices.Num();
+		const bool bHasColors = Fragment.Colors.Num() == VertexCount;
 		for (int32 VertexIndex = 0; VertexIndex < VertexCount; VertexIndex++)
 		{
-			int VertexOffset = VertexStart + VertexIndex;
-			Vertex[VertexOffset] = VertexBuffer.PositionVertexBuffer.VertexPosition(VertexIndex) * Scale;
-			BoneMap[VertexOffset] = GeometryCollection->NumElements(FGeometryCollection::TransformGroup);
-
-			TangentU[VertexOffset] = VertexBuffer.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
-			TangentV[VertexOffset] = VertexBuffer.StaticMeshVertexBuffer.VertexTangentY(VertexIndex);
-			Normal[VertexOffset] = VertexBuffer.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex);
-
-			// @todo : Support multiple UV's per vertex based on MAX_STATIC_TEXCOORDS
-			UV[VertexOffset] = VertexBuffer.StaticMeshVertexBuffer.GetVertexUV(VertexIndex, 0);
-			if (VertexBuffer.ColorVertexBuffer.GetNumVertices() == VertexCount)
-				Color[VertexOffset] = VertexBuffer.ColorVertexBuffer.VertexColor(VertexIndex);
+			const int32 VertexOffset = VertexStart + VertexIndex;
+			Vertex[VertexOffset] = Fragment.Vertices[VertexIndex];
+			BoneMap[VertexOffset] = TransformIndex1;
+			TangentU[VertexOffset] = Fragment.TangentU[VertexIndex];
+			TangentV[VertexOffset] = Fragment.TangentV[VertexIndex];
+			Normal[VertexOffset] = Fragment.Normals[VertexIndex];
+			UV[VertexOffset] = Fragment.UVs[VertexIndex];
 			// Houdini plugin: Vertex colors seem to not be added properly for Houdini generated materials with textures. 
 			// Hack it by setting it to white for now. TODO: Revisit this.
-			else if (VertexOffset < Color.Num())
-				Color[VertexOffset] = FLinearColor(1, 1, 1, 1);				
+			Color[VertexOffset] = bHasColors ? Fragment.Colors[VertexIndex] : FLinearColor(1, 1, 1, 1);
 		}
 
-		// Triangle Indices
-		TManagedArray<FIntVector>& Indices = GeometryCollection->Indices;
-		TManagedArray<bool>& Visible = GeometryCollection->Visible;
-		TManagedArray<int32>& MaterialID = GeometryCollection->MaterialID;
-		TManagedArray<int32>& MaterialIndex = GeometryCollection->MaterialIndex;
-
-		const FRawStaticIndexBuffer& IndexBuffer = StaticMesh->GetRenderData()->LODResources[0].IndexBuffer;
-		FIndexArrayView IndexBufferView = IndexBuffer.GetArrayView();
-		const int32 IndicesCount = IndexBuffer.GetNumIndices() / 3;
-		int InitialNumIndices = GeometryCollection->NumElements(FGeometryCollection::FacesGroup);
-		int IndicesStart = GeometryCollection->AddElements(IndicesCount, FGeometryCollection::FacesGroup);
-		for (int32 IndicesIndex = 0, StaticIndex = 0; IndicesIndex < IndicesCount; IndicesIndex++, StaticIndex += 3)
+		const int32 IndicesCount = Fragment.Indices.Num();
+		for (int32 IndicesIndex = 0; IndicesIndex < IndicesCount; IndicesIndex++)
 		{
-			int32 IndicesOffset = IndicesStart + IndicesIndex;
-			Indices[IndicesOffset] = FIntVector(
-				IndexBufferView[StaticIndex] + VertexStart,
-				IndexBufferView[StaticIndex + 1] + VertexStart,
-				IndexBufferView[StaticIndex + 2] + VertexStart);
+			const int32 IndicesOffset = FaceStart + IndicesIndex;
+			const FIntVector& Face = Fragment.Indices[IndicesIndex];
+			Indices[IndicesOffset] = FIntVector(Face.X + VertexStart, Face.Y + VertexStart, Face.Z + VertexStart);
 			Visible[IndicesOffset] = true;
-			MaterialID[IndicesOffset] = 0;
+			const int32 FaceMaterial = Fragment.FaceMaterialIndices[IndicesIndex];
+			MaterialID[IndicesOffset] = FaceMaterial == INDEX_NONE ? 0 : MaterialStart + FaceMaterial;
 			MaterialIndex[IndicesOffset] = IndicesOffset;
 		}
 
-		// Geometry transform
-		TManagedArray<FTransform>& Transform = GeometryCollection->Transform;
-
-		int32 TransformIndex1 = GeometryCollection->AddElements(1, FGeometryCollection::TransformGroup);
-		Transform[TransformIndex1] = StaticMeshTransform;
+		// Geometry transform, bone hierarchy - added at root with no common parent
+		Transform[TransformIndex1] = Fragment.Transform;
 		Transform[TransformIndex1].SetScale3D(FVector::OneVector);
-
-		// Bone Hierarchy - Added at root with no common parent
-		TManagedArray<int32>& Parent = GeometryCollection->Parent;
-		TManagedArray<int32>& SimulationType = GeometryCollection->SimulationType;
 		Parent[TransformIndex1] = FGeometryCollection::Invalid;
 		SimulationType[TransformIndex1] = FGeometryCollection::ESimulationTypes::FST_Rigid;
-
-		const FColor RandBoneColor(FMath::Rand() % 100 + 5, FMath::Rand() % 100 + 5, FMath::Rand() % 100 + 5, 255);
-		BoneColor[TransformIndex1] = FLinearColor(RandBoneColor);
-		BoneName[TransformIndex1] = StaticMesh->GetName();
+		BoneName[TransformIndex1] = Fragment.Name;
+		TransformToGeometryIndexArray[TransformIndex1] = GeometryIndex;
 
 		// GeometryGroup
-		int GeometryIndex = GeometryCollection->AddElements(1, FGeometryCollection::GeometryGroup);
-
-		TManagedArray<int32>& TransformIndex = GeometryCollection->TransformIndex;
-		TManagedArray<FBox>& BoundingBox = GeometryCollection->BoundingBox;
-		TManagedArray<float>& InnerRadius = GeometryCollection->InnerRadius;
-		TManagedArray<float>& OuterRadius = GeometryCollection->OuterRadius;
-		TManagedArray<int32>& VertexStartArray = GeometryCollection->VertexStart;
-		TManagedArray<int32>& VertexCountArray = GeometryCollection->VertexCount;
-		TManagedArray<int32>& FaceStartArray = GeometryCollection->FaceStart;
-		TManagedArray<int32>& FaceCountArray = GeometryCollection->FaceCount;
-
-		TransformIndex[GeometryIndex] = BoneMap[VertexStart];
-		VertexStartArray[GeometryIndex] = InitialNumVertices;
+		TransformIndex[GeometryIndex] = TransformIndex1;
+		VertexStartArray[GeometryIndex] = VertexStart;
 		VertexCountArray[GeometryIndex] = VertexCount;
-		FaceStartArray[GeometryIndex] = InitialNumIndices;
+		FaceStartArray[GeometryIndex] = FaceStart;
 		FaceCountArray[GeometryIndex] = IndicesCount;
+		BoundingBox[GeometryIndex] = Fragment.BoundingBox;
+		InnerRadius[GeometryIndex] = Fragment.InnerRadius;
+		OuterRadius[GeometryIndex] = Fragment.OuterRadius;
+	});
+
+	// Bone colors use the global random stream, keep them on this thread
+	TManagedArray<FLinearColor>& BoneColor = GeometryCollection->BoneColor;
+	for (int32 FragmentIdx = 0; FragmentIdx < NumFragments; FragmentIdx++)
+	{
+		const FColor RandBoneColor(FMath::Rand() % 100 + 5, FMath::Rand() % 100 + 5, FMath::Rand() % 100 + 5, 255);
+		BoneColor[TransformStart + FragmentIdx] = FLinearColor(RandBoneColor);
+	}
 
-		// TransformGroup
-		TManagedArray<int32>& TransformToGeometryIndexArray = GeometryCollection->TransformToGeometryIndex;
-		TransformToGeometryIndexArray[TransformIndex1] = GeometryIndex;
-
-		FVector Center(FVector::ZeroVector);
-		for (int32 VertexIndex = VertexStart; VertexIndex < VertexStart + VertexCount; VertexIndex++)
-		{
-			Center += Vertex[VertexIndex];
-		}
-		if (VertexCount) Center /= VertexCount;
-
-		// Inner/Outer edges, bounding box
-		BoundingBox[GeometryIndex] = FBox(ForceInitToZero);
-		InnerRadius[GeometryIndex] = FLT_MAX;
-		OuterRadius[GeometryIndex] = -FLT_MAX;
-		for (int32 VertexIndex = VertexStart; VertexIndex < VertexStart + VertexCount; VertexIndex++)
-		{
-			BoundingBox[GeometryIndex] += Vertex[VertexIndex];
-
-			float Delta = (Center - Vertex[VertexIndex]).Size();
-			InnerRadius[GeometryIndex] = FMath::Min(InnerRadius[GeometryIndex], Delta);
-			OuterRadius[GeometryIndex] = FMath::Max(OuterRadius[GeometryIndex], Delta);
-		}
-
-		// Inner/Outer centroid
-		for (int fdx = IndicesStart; fdx < IndicesStart + IndicesCount; fdx++)
-		{
-			FVector Centroid(0);
-			for (int e = 0; e < 3; e++)
-			{
-				Centroid += Vertex[Indices[fdx][e]];
-			}
-			Centroid /= 3;
-
-			float Delta = (Center - Centroid).Size();
-			InnerRadius[GeometryIndex] = FMath::Min(InnerRadius[GeometryIndex], Delta);
-			OuterRadius[GeometryIndex] = FMath::Max(OuterRadius[GeometryIndex], Delta);
-		}
-
-		// Inner/Outer edges
-		for (int fdx = IndicesStart; fdx < IndicesStart + IndicesCount; fdx++)
-		{
-			for (int e = 0; e < 3; e++)
-			{
-				int i = e, j = (e + 1) % 3;
-				FVector Edge = Vertex[Indices[fdx][i]] + 0.5 * (Vertex[Indices[fdx][j]] - Vertex[Indices[fdx][i]]);
-				float Delta = (Center - Edge).Size();
-				InnerRadius[GeometryIndex] = FMath::Min(InnerRadius[GeometryIndex], Delta);
-				OuterRadius[GeometryIndex] = FMath::Max(OuterRadius[GeometryIndex], Delta);
-			}
-		}
-
-		// for each material, add a reference in our GeometryCollectionObject
-		const int32 MaterialStart = GeometryCollectionObject->Materials.Num();
-		const int32 NumMeshMaterials = Materials.Num();
-		GeometryCollectionObject->Materials.Reserve(MaterialStart + NumMeshMaterials);
-
-		for (int32 Index = 0; Index < NumMeshMaterials; ++Index)
+	// for each material, add a reference in our GeometryCollectionObject
+	GeometryCollectionObject->Materials.Reserve(InitialNumMaterials + NumMaterials);
+	for (const FHoudiniGeometryCollectionFragment& Fragment : InFragments)
+	{
+		for (UMaterialInterface* CurrMaterial : Fragment.Materials)
 		{
-			UMaterialInterface* CurrMaterial = Materials[Index];
-
 			// Possible we have a null entry - replace with default
 			if (CurrMaterial == nullptr)
 			{
@@ -1177,40 +1320,36 @@ FHoudiniGeometryCollectionTranslator::AppendStaticMesh(
 
 			GeometryCollectionObject->Materials.Add(CurrMaterial);
 		}
+	}
 
-		TManagedArray<FGeometryCollectionSection>& Sections = GeometryCollection->Sections;
-
-		// We make sections that mirror what is in the static mesh.  Note that this isn't explicitly
-		// necessary since we reindex after all the meshes are added, but it is a good step to have
-		// optimal min/max vertex index right from the static mesh.  All we really need to do is
-		// assign material ids and rely on reindexing, in theory
-		for (const FStaticMeshSection& CurrSection : StaticMesh->RenderData->LODResources[0].Sections)
+	// We make sections that mirror what is in the static mesh.  Note that this isn't explicitly
+	// necessary since we reindex after all the meshes are added, but it is a good step to have
+	// optimal min/max vertex index right from the static mesh.
+	TManagedArray<FGeometryCollectionSection>& Sections = GeometryCollection->Sections;
+	for (int32 FragmentIdx = 0; FragmentIdx < NumFragments; FragmentIdx++)
+	{
+		const FHoudiniGeometryCollectionFragment& Fragment = InFragments[FragmentIdx];
+		const int32 VertexStart = VertexStarts[FragmentIdx];
+		for (int32 Idx = 0; Idx < Fragment.Sections.Num(); Idx++)
 		{
-			// create new section
-			int32 SectionIndex = GeometryCollection->AddElements(1, FGeometryCollection::MaterialGroup);
-
-			Sections[SectionIndex].MaterialID = MaterialStart + CurrSection.MaterialIndex;
+			const FHoudiniGeometryCollectionFragmentSection& CurrSection = Fragment.Sections[Idx];
+			const int32 SectionIndex = SectionStarts[FragmentIdx] + Idx;
 
-			Sections[SectionIndex].FirstIndex = IndicesStart * 3 + CurrSection.FirstIndex;
+			Sections[SectionIndex].MaterialID = MaterialStarts[FragmentIdx] + CurrSection.MaterialIndex;
+			Sections[SectionIndex].FirstIndex = FaceStarts[FragmentIdx] * 3 + CurrSection.FirstIndex;
 			Sections[SectionIndex].MinVertexIndex = VertexStart + CurrSection.MinVertexIndex;
-
 			Sections[SectionIndex].NumTriangles = CurrSection.NumTriangles;
 			Sections[SectionIndex].MaxVertexIndex = VertexStart + CurrSection.MaxVertexIndex;
-
-			// set the MaterialID for all of the faces
-			// note the divide by 3 - the GeometryCollection stores indices in tuples of 3 rather than in a flat array
-			for (int32 i = Sections[SectionIndex].FirstIndex / 3; i < Sections[SectionIndex].FirstIndex / 3 + Sections[SectionIndex].NumTriangles; ++i)
-			{
-				MaterialID[i] = Sections[SectionIndex].MaterialID;
-			}
 		}
+	}
 
-		if (ReindexMaterials)
-		{
-			GeometryCollection->ReindexMaterials();
-		}
+	// Reindexing goes over all the faces, so only do it once for all the fragments
+	if (bReindexMaterials)
+	{
+		GeometryCollection->ReindexMaterials();
 	}
 
+	return TransformStart;
 }
 
 // Copied from FractureToolEmbed.h
@@ -37,6 +37,8 @@
 class AGeometryCollectionActor;
 class UGeometryCollection;
 class UGeometryCollectionComponent;
+class UMaterialInterface;
+class UStaticMesh;
 struct FHoudiniGenericAttribute;
 
 struct HOUDINIENGINE_API FHoudiniGeometryCollectionTranslator
@@ -70,6 +72,42 @@ struct HOUDINIENGINE_API FHoudiniGeometryCollectionTranslator
 			PackParams = InPackParams;
 		}
 	};
+
+	// A static mesh section, relative to its fragment
+	struct FHoudiniGeometryCollectionFragmentSection
+	{
+		int32 MaterialIndex = 0;
+		int32 FirstIndex = 0;
+		int32 NumTriangles = 0;
+		int32 MinVertexIndex = 0;
+		int32 MaxVertexIndex = 0;
+	};
+
+	// A static mesh's render data converted to the geometry collection's layout, ready to be appended.
+	// Indices, sections and face materials are relative to the fragment.
+	struct FHoudiniGeometryCollectionFragment
+	{
+		FString Name;
+		FTransform Transform;
+		TArray<UMaterialInterface*> Materials;
+
+		TArray<FVector> Vertices;
+		TArray<FVector> TangentU;
+		TArray<FVector> TangentV;
+		TArray<FVector> Normals;
+		TArray<FVector2D> UVs;
+		// Empty if the mesh has no vertex colors
+		TArray<FLinearColor> Colors;
+
+		TArray<FIntVector> Indices;
+		// Index in Materials of each face, INDEX_NONE for faces outside of the sections
+		TArray<int32> FaceMaterialIndices;
+		TArray<FHoudiniGeometryCollectionFragmentSection> Sections;
+
+		FBox BoundingBox = FBox(ForceInitToZero);
+		float InnerRadius = FLT_MAX;
+		float OuterRadius = -FLT_MAX;
+	};
 	
 	public:
 		static void SetupGeometryCollectionComponentFromOutputs(TArray<UHoudiniOutput*>& InAllOutputs,
@@ -88,6 +126,21 @@ struct HOUDINIENGINE_API FHoudiniGeometryCollectionTranslator
 
 		static bool GetGeometryCollectionNames(TArray<UHoudiniOutput*>& InAllOutputs, TSet<FString>& Names);
 
+		// Converts the LOD0 render data of a static mesh to a fragment.
+		// Only reads the mesh, so it can be called for several fragments in parallel.
+		static bool BuildGeometryCollectionFragment(
+			const UStaticMesh* StaticMesh,
+			const TArray<UMaterialInterface*>& Materials,
+			const FTransform& StaticMeshTransform,
+			FHoudiniGeometryCollectionFragment& OutFragment);
+
+		// Appends fragments to a geometry collection, growing each of its groups only once.
+		// Each fragment is added as a root bone. Returns the transform index of the first fragment.
+		static int32 AppendGeometryCollectionFragments(
+			const TArray<FHoudiniGeometryCollectionFragment>& InFragments,
+			UGeometryCollection* GeometryCollectionObject,
+			const bool& bReindexMaterials = true);
+
 	private:
 
 		static UGeometryCollectionComponent* CreateGeometryCollectionComponent(UObject *InOuterComponent);
@@ -101,23 +154,6 @@ struct HOUDINIENGINE_API FHoudiniGeometryCollectionTranslator
 	
 		static void ApplyGeometryCollectionAttributes(UGeometryCollection* GeometryCollection, FHoudiniGeometryCollectionPiece FirstPiece);
 
-		// Copied from GeometryCollectionConversion.h
-		// As we cannot access the UE function without depending on the GC plugin.
-		/**
-		*  Appends a static mesh to a GeometryCollectionComponent.
-		*  @param StaticMesh : Const mesh to read vertex/normals/index data from
-		*  @param Materials : Materials fetched from the StaticMeshComponent used to configure this geometry
-		*  @param StaticMeshTransform : Mesh transform.
-		*  @param GeometryCollection  : Collection to append the mesh into.
-		*/
-		static void AppendStaticMesh(
-			const UStaticMesh* StaticMesh,
-			const TArray<UMaterialInterface*>& Materials,
-			const FTransform& StaticMeshTransform,
-			UGeometryCollection* GeometryCollectionObject,
-			const bool& ReindexMaterials = true,
-			const int32& Level = 0);
-
 		// Copied from FractureToolEmbed.h
 		static void AddSingleRootNodeIfRequired(UGeometryCollection* GeometryCollectionObject);	
 };
@@ -0,0 +1,428 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniInputNodePool.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInputNodePoolSize(
+	TEXT("HoudiniEngine.InputNodePoolSize"),
+	16,
+	TEXT("Maximum number of unused input nodes of each type (mesh, curve, heightfield, object merge, merge) kept in the session to be reused by other inputs.\n")
+	TEXT("0: Disabled, input nodes are always deleted\n"));
+
+static FAutoConsoleCommand CCmdHoudiniEngineLogInputNodePool(
+	TEXT("HoudiniEngine.LogInputNodePool"),
+	TEXT("Logs the number of input nodes created, reused and deleted by the input node pool in the current session."),
+	FConsoleCommandDelegate::CreateStatic(&FHoudiniInputNodePool::LogStats));
+
+TMap<HAPI_NodeId, FHoudiniInputNodePool::FPooledNode> FHoudiniInputNodePool::PooledNodes;
+TMap<HAPI_NodeId, HAPI_NodeId> FHoudiniInputNodePool::PooledNodeIdsByObjNodeId;
+TArray<HAPI_NodeId> FHoudiniInputNodePool::FreeNodeIds[(int32)EHoudiniInputNodePoolType::Count];
+FHoudiniInputNodePoolStats FHoudiniInputNodePool::Stats;
+
+float
+FHoudiniInputNodePoolStats::GetReuseRate() const
+{
+	const int32 NumAcquired = NumCreated + NumReused;
+	return NumAcquired > 0 ? (float)NumReused / (float)NumAcquired : 0.0f;
+}
+
+bool
+FHoudiniInputNodePool::AcquireNode(const EHoudiniInputNodePoolType& InType, const FString& InNodeName, HAPI_NodeId& OutNodeId)
+{
+	if (!ensure(InType != EHoudiniInputNodePoolType::Heightfield && InType != EHoudiniInputNodePoolType::Count))
+		return false;
+
+	return AcquireNodeInternal(InType, InNodeName, 0, 0, OutNodeId);
+}
+
+bool
+FHoudiniInputNodePool::AcquireHeightfieldNode(
+	const FString& InNodeName, const int32& InXSize, const int32& InYSize,
+	HAPI_NodeId& OutHeightfieldNodeId, HAPI_NodeId& OutHeightNodeId, HAPI_NodeId& OutMaskNodeId, HAPI_NodeId& OutMergeNodeId)
+{
+	if (!AcquireNodeInternal(EHoudiniInputNodePoolType::Heightfield, InNodeName, InXSize, InYSize, OutHeightfieldNodeId))
+		return false;
+
+	const FPooledNode& PooledNode = PooledNodes.FindChecked(OutHeightfieldNodeId);
+	OutHeightNodeId = PooledNode.HeightNodeId;
+	OutMaskNodeId = PooledNode.MaskNodeId;
+	OutMergeNodeId = PooledNode.MergeNodeId;
+
+	return true;
+}
+
+bool
+FHoudiniInputNodePool::AcquireNodeInternal(
+	const EHoudiniInputNodePoolType& InType, const FString& InNodeName,
+	const int32& InXSize, const int32& InYSize, HAPI_NodeId& OutNodeId)
+{
+	TArray<HAPI_NodeId>& Free = FreeNodeIds[(int32)InType];
+	for (int32 Idx = Free.Num() - 1; Idx >= 0; Idx--)
+	{
+		const HAPI_NodeId NodeId = Free[Idx];
+		FPooledNode* PooledNode = PooledNodes.Find(NodeId);
+		if (!PooledNode)
+		{
+			Free.RemoveAt(Idx);
+			continue;
+		}
+
+		// Heightfields can only be reused for the same size
+		if (InType == EHoudiniInputNodePoolType::Heightfield && (PooledNode->XSize != InXSize || PooledNode->YSize != InYSize))
+			continue;
+
+		Free.RemoveAt(Idx);
+
+		// The node could have been deleted by something else
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(NodeId))
+		{
+			PooledNodeIdsByObjNodeId.Remove(PooledNode->ObjNodeId);
+			PooledNodes.Remove(NodeId);
+			continue;
+		}
+
+		// The name is only cosmetic, keep the node even if the rename fails
+		FHoudiniApi::RenameNode(FHoudiniEngine::Get().GetSession(), PooledNode->ObjNodeId, TCHAR_TO_UTF8(*InNodeName));
+
+		PooledNode->bFree = false;
+		Stats.NumReused++;
+
+		OutNodeId = NodeId;
+		return true;
+	}
+
+	if (!CreatePooledNode(InType, InNodeName, InXSize, InYSize, OutNodeId))
+		return false;
+
+	Stats.NumCreated++;
+	return true;
+}
+
+bool
+FHoudiniInputNodePool::CreatePooledNode(
+	const EHoudiniInputNodePoolType& InType, const FString& InNodeName,
+	const int32& InXSize, const int32& InYSize, HAPI_NodeId& OutNodeId)
+{
+	FPooledNode PooledNode;
+	PooledNode.Type = InType;
+
+	HAPI_NodeId NewNodeId = -1;
+	switch (InType)
+	{
+		case EHoudiniInputNodePoolType::Mesh:
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
+				FHoudiniEngine::Get().GetSession(), &NewNodeId, TCHAR_TO_UTF8(*InNodeName)), false);
+		}
+		break;
+
+		case EHoudiniInputNodePoolType::Curve:
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputCurveNode(
+				FHoudiniEngine::Get().GetSession(), &NewNodeId, TCHAR_TO_UTF8(*InNodeName)), false);
+		}
+		break;
+
+		case EHoudiniInputNodePoolType::Heightfield:
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateHeightFieldInput(
+				FHoudiniEngine::Get().GetSession(),
+				-1, TCHAR_TO_UTF8(*InNodeName), InYSize, InXSize, 1.0f, HAPI_HeightFieldSampling::HAPI_HEIGHTFIELD_SAMPLING_CORNER,
+				&NewNodeId, &PooledNode.HeightNodeId, &PooledNode.MaskNodeId, &PooledNode.MergeNodeId), false);
+
+			PooledNode.XSize = InXSize;
+			PooledNode.YSize = InYSize;
+			GetChildNodeIds(NewNodeId, PooledNode.InitialChildNodeIds);
+		}
+		break;
+
+		case EHoudiniInputNodePoolType::ObjectMerge:
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+				-1, TEXT("SOP/object_merge"), InNodeName, true, &NewNodeId), false);
+		}
+		break;
+
+		case EHoudiniInputNodePoolType::Merge:
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+				-1, TEXT("SOP/merge"), InNodeName, true, &NewNodeId), false);
+		}
+		break;
+
+		default:
+			return false;
+	}
+
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(NewNodeId))
+		return false;
+
+	// SOPs are created in their own OBJ node, that we rename and transform
+	HAPI_NodeInfo NodeInfo;
+	FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetNodeInfo(
+		FHoudiniEngine::Get().GetSession(), NewNodeId, &NodeInfo), false);
+
+	PooledNode.ObjNodeId = NewNodeId;
+	if (NodeInfo.type != HAPI_NODETYPE_OBJ)
+	{
+		const HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
+		if (ParentId >= 0)
+			PooledNode.ObjNodeId = ParentId;
+	}
+
+	PooledNodeIdsByObjNodeId.Add(PooledNode.ObjNodeId, NewNodeId);
+	PooledNodes.Add(NewNodeId, PooledNode);
+
+	OutNodeId = NewNodeId;
+	return true;
+}
+
+bool
+FHoudiniInputNodePool::ReleaseNode(const HAPI_NodeId& InNodeId)
+{
+	if (InNodeId < 0)
+		return false;
+
+	HAPI_NodeId NodeId = InNodeId;
+	FPooledNode* PooledNode = PooledNodes.Find(NodeId);
+	if (!PooledNode)
+	{
+		// The OBJ nodes are usually released along with their SOP
+		const HAPI_NodeId* PooledNodeId = PooledNodeIdsByObjNodeId.Find(InNodeId);
+		if (!PooledNodeId)
+			return false;
+
+		NodeId = *PooledNodeId;
+		PooledNode = PooledNodes.Find(NodeId);
+		if (!PooledNode)
+		{
+			PooledNodeIdsByObjNodeId.Remove(InNodeId);
+			return false;
+		}
+	}
+
+	if (PooledNode->bFree)
+		return true;
+
+	Stats.NumReleased++;
+
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(NodeId))
+	{
+		PooledNodeIdsByObjNodeId.Remove(PooledNode->ObjNodeId);
+		PooledNodes.Remove(NodeId);
+		return true;
+	}
+
+	TArray<HAPI_NodeId>& Free = FreeNodeIds[(int32)PooledNode->Type];
+	const int32 MaxFreeNodes = FMath::Max(0, CVarHoudiniEngineInputNodePoolSize.GetValueOnAnyThread());
+	if (Free.Num() >= MaxFreeNodes || !ResetPooledNode(NodeId, *PooledNode))
+	{
+		DeletePooledNode(NodeId);
+		return true;
+	}
+
+	PooledNode->bFree = true;
+	Free.Add(NodeId);
+
+	return true;
+}
+
+bool
+FHoudiniInputNodePool::IsPooledNode(const HAPI_NodeId& InNodeId)
+{
+	return PooledNodes.Contains(InNodeId) || PooledNodeIdsByObjNodeId.Contains(InNodeId);
+}
+
+bool
+FHoudiniInputNodePool::ResetPooledNode(const HAPI_NodeId& InNodeId, FPooledNode& InPooledNode)
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	// Disconnect the node from whatever it was feeding
+	FHoudiniApi::DisconnectNodeOutputsAt(Session, InNodeId, 0);
+
+	switch (InPooledNode.Type)
+	{
+		case EHoudiniInputNodePoolType::Mesh:
+		{
+			// Replace the geometry by an empty part, so the free node doesn't hold on to the data
+			HAPI_PartInfo PartInfo;
+			FHoudiniApi::PartInfo_Init(&PartInfo);
+			PartInfo.type = HAPI_PARTTYPE_MESH;
+
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetPartInfo(Session, InNodeId, 0, &PartInfo))
+				return false;
+
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::CommitGeo(Session, InNodeId))
+				return false;
+		}
+		break;
+
+		case EHoudiniInputNodePoolType::Curve:
+			// The curve info and positions are always set when the node is used
+			break;
+
+		case EHoudiniInputNodePoolType::Heightfield:
+		{
+			// Delete the layer volumes added to the heightfield, they will be recreated as needed
+			TArray<HAPI_NodeId> ChildNodeIds;
+			if (!GetChildNodeIds(InNodeId, ChildNodeIds))
+				return false;
+
+			for (const HAPI_NodeId& ChildNodeId : ChildNodeIds)
+			{
+				if (InPooledNode.InitialChildNodeIds.Contains(ChildNodeId))
+					continue;
+
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(Session, ChildNodeId))
+					return false;
+			}
+		}
+		break;
+
+		case EHoudiniInputNodePoolType::ObjectMerge:
+		{
+			// Stop referencing the merged object, it might be deleted
+			HAPI_ParmId ParmId = -1;
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmIdFromName(Session, InNodeId, "objpath1", &ParmId))
+				return false;
+
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetParmStringValue(Session, InNodeId, "", ParmId, 0))
+				return false;
+		}
+		break;
+
+		case EHoudiniInputNodePoolType::Merge:
+		{
+			HAPI_NodeInfo NodeInfo;
+			FHoudiniApi::NodeInfo_Init(&NodeInfo);
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeInfo(Session, InNodeId, &NodeInfo))
+				return false;
+
+			for (int32 InputIdx = 0; InputIdx < NodeInfo.inputCount; InputIdx++)
+				FHoudiniApi::DisconnectNodeInput(Session, InNodeId, InputIdx);
+		}
+		break;
+
+		default:
+			return false;
+	}
+
+	// Reset the OBJ node's transform
+	if (InPooledNode.ObjNodeId != InNodeId)
+	{
+		HAPI_TransformEuler Transform;
+		FHoudiniApi::TransformEuler_Init(&Transform);
+		FHoudiniApi::SetObjectTransform(Session, InPooledNode.ObjNodeId, &Transform);
+	}
+
+	return true;
+}
+
+void
+FHoudiniInputNodePool::DeletePooledNode(const HAPI_NodeId& InNodeId)
+{
+	FPooledNode PooledNode;
+	if (!PooledNodes.RemoveAndCopyValue(InNodeId, PooledNode))
+		return;
+
+	PooledNodeIdsByObjNodeId.Remove(PooledNode.ObjNodeId);
+	FreeNodeIds[(int32)PooledNode.Type].Remove(InNodeId);
+
+	// Deleting the OBJ node also deletes the node
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), PooledNode.ObjNodeId))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to delete pooled input node %d."), InNodeId);
+		return;
+	}
+
+	Stats.NumDeleted++;
+}
+
+bool
+FHoudiniInputNodePool::GetChildNodeIds(const HAPI_NodeId& InNodeId, TArray<HAPI_NodeId>& OutChildNodeIds)
+{
+	OutChildNodeIds.Empty();
+
+	int32 ChildCount = 0;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ComposeChildNodeList(
+		FHoudiniEngine::Get().GetSession(), InNodeId,
+		HAPI_NODETYPE_ANY, HAPI_NODEFLAGS_ANY, false, &ChildCount), false);
+
+	if (ChildCount <= 0)
+		return true;
+
+	OutChildNodeIds.SetNumUninitialized(ChildCount);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetComposedChildNodeList(
+		FHoudiniEngine::Get().GetSession(), InNodeId,
+		OutChildNodeIds.GetData(), ChildCount), false);
+
+	return true;
+}
+
+void
+FHoudiniInputNodePool::Reset()
+{
+	if (Stats.NumCreated > 0)
+		LogStats();
+
+	// The nodes belong to the session, they don't need to be deleted
+	PooledNodes.Empty();
+	PooledNodeIdsByObjNodeId.Empty();
+	for (TArray<HAPI_NodeId>& Free : FreeNodeIds)
+		Free.Empty();
+
+	Stats = FHoudiniInputNodePoolStats();
+}
+
+FHoudiniInputNodePoolStats
+FHoudiniInputNodePool::GetStats()
+{
+	FHoudiniInputNodePoolStats CurrentStats = Stats;
+	CurrentStats.NumFree = 0;
+	for (const TArray<HAPI_NodeId>& Free : FreeNodeIds)
+		CurrentStats.NumFree += Free.Num();
+
+	return CurrentStats;
+}
+
+void
+FHoudiniInputNodePool::LogStats()
+{
+	const FHoudiniInputNodePoolStats CurrentStats = GetStats();
+	HOUDINI_LOG_MESSAGE(TEXT("Input node pool: %d created, %d reused (%.1f%% reuse rate), %d released, %d deleted, %d free."),
+		CurrentStats.NumCreated, CurrentStats.NumReused, CurrentStats.GetReuseRate() * 100.0f,
+		CurrentStats.NumReleased, CurrentStats.NumDeleted, CurrentStats.NumFree);
+}
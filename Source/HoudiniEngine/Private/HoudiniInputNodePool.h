@@ -0,0 +1,145 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+
+// Types of input nodes that can be reused
+enum class EHoudiniInputNodePoolType : uint8
+{
+	// Input node created with HAPI_CreateInputNode
+	Mesh,
+	// Input curve node created with HAPI_CreateInputCurveNode
+	Curve,
+	// Heightfield input created with HAPI_CreateHeightFieldInput
+	Heightfield,
+	// SOP/object_merge in its own OBJ node
+	ObjectMerge,
+	// SOP/merge in its own OBJ node
+	Merge,
+
+	Count
+};
+
+struct HOUDINIENGINE_API FHoudiniInputNodePoolStats
+{
+	int32 NumCreated = 0;
+	int32 NumReused = 0;
+	int32 NumReleased = 0;
+	int32 NumDeleted = 0;
+	int32 NumFree = 0;
+
+	// Ratio of the acquired nodes that were reused instead of created
+	float GetReuseRate() const;
+};
+
+/**
+ * Per-session pool of input nodes.
+ * Instead of deleting an input's nodes and creating new ones every time its type or objects change,
+ * the nodes are released to the pool, reset (geometry cleared, inputs disconnected, transform reset)
+ * and handed back, renamed, to the next input that needs a node of the same type.
+ * Only the nodes created by the pool are reused, other nodes are left to the caller to delete.
+ * The size of the pool is controlled by HoudiniEngine.InputNodePoolSize.
+ */
+struct HOUDINIENGINE_API FHoudiniInputNodePool
+{
+	public:
+
+		// Returns a node of the given type, reused from the pool or created.
+		// The node's OBJ is renamed to InNodeName. Heightfields have to use AcquireHeightfieldNode.
+		static bool AcquireNode(const EHoudiniInputNodePoolType& InType, const FString& InNodeName, HAPI_NodeId& OutNodeId);
+
+		// Returns a heightfield input of the given size and its height, mask and merge nodes
+		static bool AcquireHeightfieldNode(
+			const FString& InNodeName, const int32& InXSize, const int32& InYSize,
+			HAPI_NodeId& OutHeightfieldNodeId, HAPI_NodeId& OutHeightNodeId, HAPI_NodeId& OutMaskNodeId, HAPI_NodeId& OutMergeNodeId);
+
+		// Returns a node created by the pool (or its parent OBJ node) to the pool.
+		// Nodes in excess of the pool's size are deleted with their OBJ node.
+		// Returns false if the node wasn't created by the pool, in which case the caller should delete it.
+		static bool ReleaseNode(const HAPI_NodeId& InNodeId);
+
+		// Indicates if the node (or OBJ node) was created by the pool
+		static bool IsPooledNode(const HAPI_NodeId& InNodeId);
+
+		// Forgets all the nodes, must be called when the session is stopped or lost
+		static void Reset();
+
+		static FHoudiniInputNodePoolStats GetStats();
+
+		// Logs the number of nodes created, reused and deleted in the current session
+		static void LogStats();
+
+	protected:
+
+		struct FPooledNode
+		{
+			EHoudiniInputNodePoolType Type = EHoudiniInputNodePoolType::Mesh;
+			// The OBJ node containing the node, renamed and transformed when the node is reused
+			HAPI_NodeId ObjNodeId = -1;
+			bool bFree = false;
+
+			// Heightfields only
+			int32 XSize = 0;
+			int32 YSize = 0;
+			HAPI_NodeId HeightNodeId = -1;
+			HAPI_NodeId MaskNodeId = -1;
+			HAPI_NodeId MergeNodeId = -1;
+			// Nodes created with the heightfield, the other children (layers) are deleted when it is released
+			TArray<HAPI_NodeId> InitialChildNodeIds;
+		};
+
+		static bool AcquireNodeInternal(
+			const EHoudiniInputNodePoolType& InType, const FString& InNodeName,
+			const int32& InXSize, const int32& InYSize, HAPI_NodeId& OutNodeId);
+
+		static bool CreatePooledNode(
+			const EHoudiniInputNodePoolType& InType, const FString& InNodeName,
+			const int32& InXSize, const int32& InYSize, HAPI_NodeId& OutNodeId);
+
+		// Clears the node's data so it can be reused, returns false if the node should be deleted instead
+		static bool ResetPooledNode(const HAPI_NodeId& InNodeId, FPooledNode& InPooledNode);
+
+		static void DeletePooledNode(const HAPI_NodeId& InNodeId);
+
+		static bool GetChildNodeIds(const HAPI_NodeId& InNodeId, TArray<HAPI_NodeId>& OutChildNodeIds);
+
+	protected:
+
+		// All the nodes created by the pool, free or in use
+		static TMap<HAPI_NodeId, FPooledNode> PooledNodes;
+
+		// Pooled nodes, per OBJ node id
+		static TMap<HAPI_NodeId, HAPI_NodeId> PooledNodeIdsByObjNodeId;
+
+		// Free nodes, per type
+		static TArray<HAPI_NodeId> FreeNodeIds[(int32)EHoudiniInputNodePoolType::Count];
+
+		static FHoudiniInputNodePoolStats Stats;
+};
@@ -71,6 +71,7 @@
 #include "HCsgUtils.h"
 #include "LandscapeInfo.h"
 #include "UnrealGeometryCollectionTranslator.h"
+#include "HoudiniInputNodePool.h"
 
 #include "Async/Async.h"
 #include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionActor.h"
@@ -480,7 +481,18 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 
 			if (CurInputObject->InputNodeId >= 0)
 			{
-				FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), CurInputObject->InputNodeId);
+				FUnrealMeshTranslator::ReleaseSharedStaticMeshInputNode(CurInputObject->InputNodeId);
+				if (FHoudiniInputNodePool::ReleaseNode(CurInputObject->InputNodeId))
+				{
+					// The pool now owns the node and its OBJ, make sure they aren't deleted below
+					CreatedInputDataAssetIds.Remove(CurInputObject->InputNodeId);
+					InputToDestroy->GetCreatedDataNodeIds().Remove(CurInputObject->InputNodeId);
+					CurInputObject->InputObjectNodeId = -1;
+				}
+				else
+				{
+					FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), CurInputObject->InputNodeId);
+				}
 				CurInputObject->InputNodeId = -1;
 			}
 
@@ -518,7 +530,10 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 		if (AssetNodeId < 0)
 			continue;
 
-		FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), AssetNodeId);
+		if (FHoudiniInputNodePool::ReleaseNode(AssetNodeId))
+			InputToDestroy->GetCreatedDataNodeIds().Remove(AssetNodeId);
+		else
+			FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), AssetNodeId);
 	}
 	CreatedInputDataAssetIds.Empty();
 
@@ -526,6 +541,14 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 	if (InputToDestroy->GetInputNodeId() >= 0)
 	{
 		HAPI_NodeId CreatedInputId = InputToDestroy->GetInputNodeId();
+
+		// Merge nodes from the pool are reset and kept for the next input
+		if (FHoudiniInputNodePool::ReleaseNode(CreatedInputId))
+		{
+			InputToDestroy->SetInputNodeId(-1);
+			return true;
+		}
+
 		HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId(CreatedInputId);
 
 		if (CreatedInputId >= 0)
@@ -769,6 +792,9 @@ FHoudiniInputTranslator::UploadChangedInputs(UHoudiniAssetComponent * HAC)
 			if (InputNodeIdPendingDelete < 0)
 				continue;
 
+			if (FHoudiniInputNodePool::ReleaseNode(InputNodeIdPendingDelete))
+				continue;
+
 			HAPI_NodeInfo NodeInfo;
 			FHoudiniApi::NodeInfo_Init(&NodeInfo);
 
@@ -1114,8 +1140,11 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput, const FTransfor
 							FHoudiniEngine::Get().GetSession(), InputNodeId, Idx));
 
 						// Destroy the object merge node, do not delete other HDA (Asset input type)
-						HOUDINI_CHECK_ERROR(FHoudiniApi::DeleteNode(
-							FHoudiniEngine::Get().GetSession(), InputObjectMergeId));
+						if (!FHoudiniInputNodePool::ReleaseNode(InputObjectMergeId))
+						{
+							HOUDINI_CHECK_ERROR(FHoudiniApi::DeleteNode(
+								FHoudiniEngine::Get().GetSession(), InputObjectMergeId));
+						}
 					}
 				}
 			}
@@ -1133,8 +1162,8 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput, const FTransfor
 		// This input doesn't have a valid NodeId yet,
 		// we need to create this input's merge node and update this input's node ID
 		FString MergeName = InInput->GetNodeBaseName() + TEXT("_Merge");
-		HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::CreateNode(
-			-1,	TEXT("SOP/merge"), MergeName, true, &InputNodeId), false);
+		if (!FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Merge, MergeName, InputNodeId))
+			return false;
 
 		InInput->SetInputNodeId(InputNodeId);
 	}
@@ -1188,8 +1217,11 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput, const FTransfor
 			// Destroy the object merge node, do not destroy other HDA (Asset input type)
 			if (InInput->GetInputType() != EHoudiniInputType::Asset)
 			{
-				HOUDINI_CHECK_ERROR(FHoudiniApi::DeleteNode(
-					FHoudiniEngine::Get().GetSession(), InputObjectMergeId));
+				if (!FHoudiniInputNodePool::ReleaseNode(InputObjectMergeId))
+				{
+					HOUDINI_CHECK_ERROR(FHoudiniApi::DeleteNode(
+						FHoudiniEngine::Get().GetSession(), InputObjectMergeId));
+				}
 			}
 		}
 	}
@@ -1843,8 +1875,8 @@ FHoudiniInputTranslator::HapiCreateInputNodeForObject(const FString& InObjNodeNa
 	// For UObjects we can't upload much, but can still create an input node
 	// with a single point, with an attribute pointing to the input object's path
 	HAPI_NodeId InputNodeId = -1;
-	HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
-		FHoudiniEngine::Get().GetSession(), &InputNodeId, TCHAR_TO_UTF8(*NodeName)), false);
+	if (!FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, NodeName, InputNodeId))
+		return false;
 
 	// Update this input object's NodeId and ObjectNodeId
 	InObject->InputNodeId = (int32)InputNodeId;
@@ -2396,8 +2428,9 @@ FHoudiniInputTranslator::HapiCreateInputNodeForInstancedStaticMeshComponent(
 	InObject->InputNodeId = NewNodeId;
 	InObject->InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
 
-	// Update the component's cached instances
+	// Update the component's cached data and snapshot the uploaded instances
 	InObject->Update(ISMC);
+	InObject->UpdateInstancesHash(ISMC);
 
 	// Update the component's transform
 	const FTransform ComponentTransform = InObject->Transform;
@@ -3123,8 +3156,8 @@ FHoudiniInputTranslator::CreateInputNodeForReference(
 	HAPI_NodeId NewNodeId = -1;
 
 	// Create a single input node 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
-		FHoudiniEngine::Get().GetSession(), &NewNodeId, TCHAR_TO_UTF8(*InputNodeName)), false);
+	if (!FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, InputNodeName, NewNodeId))
+		return false;
 
 	/*
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
@@ -3137,7 +3170,7 @@ FHoudiniInputTranslator::CreateInputNodeForReference(
 
 	// We have now created a valid new input node, delete the previous one
 	HAPI_NodeId PreviousInputNodeId = InputNodeId;
-	if (PreviousInputNodeId >= 0)
+	if (PreviousInputNodeId >= 0 && !FHoudiniInputNodePool::ReleaseNode(PreviousInputNodeId))
 	{
 		// Get the parent OBJ node ID before deleting!
 		HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
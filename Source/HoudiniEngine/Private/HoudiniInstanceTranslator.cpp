@@ -2220,6 +2220,8 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	// Set the number of needed instances
 	InstancedActorComponent->SetNumberOfInstances(InstancedObjectTransforms.Num());
 
+	TArray<UObject*> InstanceActors;
+	InstanceActors.SetNumZeroed(InstancedObjectTransforms.Num());
 	for (int32 Idx = 0; Idx < InstancedObjectTransforms.Num(); Idx++)
 	{
 		// if we already have an actor, we can reuse it
@@ -2239,10 +2241,12 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 			InstancedActorComponent->SetInstanceTransformAt(Idx, CurTransform);
 		}
 
-		// Update the generic properties for that instance if any
-		UpdateGenericPropertiesAttributes(CurInstance, AllPropertyAttributes, OriginalInstancerObjectIndices[Idx]);
+		InstanceActors[Idx] = CurInstance;
 	}
 
+	// Update the generic properties for all the instances if any
+	UpdateGenericPropertiesAttributes(InstanceActors, AllPropertyAttributes, OriginalInstancerObjectIndices);
+
 	// Assign the new ISMC / HISMC to the output component if we created a new one
 	if (bCreatedNewComponent)
 	{
@@ -2411,20 +2415,25 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
-	// TODO: Optimize
-	// Loop on attributes first, then components,
-	// if failing to find the attrib on a component, skip the rest
+	// Loop on attributes first, then components, so each property is only resolved once
 	if (AllPropertyAttributes.Num() > 0)
 	{
 		TArray<class UStaticMeshComponent*>& Instances = MeshSplitComponent->GetInstancesForWrite();
+		TArray<UObject*> InstanceObjects;
+		TArray<int32> InstanceIndices;
+		InstanceObjects.Reserve(Instances.Num());
+		InstanceIndices.Reserve(Instances.Num());
 		for (int32 InstIndex = 0; InstIndex < Instances.Num(); InstIndex++)
 		{
 			UStaticMeshComponent* CurSMC = Instances[InstIndex];
 			if (!IsValid(CurSMC))
 				continue;
 
-			UpdateGenericPropertiesAttributes(CurSMC, AllPropertyAttributes, InstIndex);
+			InstanceObjects.Add(CurSMC);
+			InstanceIndices.Add(InstIndex);
 		}
+
+		UpdateGenericPropertiesAttributes(InstanceObjects, AllPropertyAttributes, InstanceIndices);
 	}
 
 	// Assign the new ISMC / HISMC to the output component if we created a new one
@@ -2818,6 +2827,36 @@ FHoudiniInstanceTranslator::UpdateGenericPropertiesAttributes(
 	return (NumSuccess > 0);
 }
 
+bool
+FHoudiniInstanceTranslator::UpdateGenericPropertiesAttributes(
+	const TArray<UObject*>& InObjects, const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes, const TArray<int32>& InAtIndices)
+{
+	if (InObjects.Num() != InAtIndices.Num())
+		return false;
+
+	int32 NumSuccess = 0;
+	for (const auto& CurrentPropAttribute : InAllPropertyAttributes)
+	{
+		if (CurrentPropAttribute.AttributeName.Equals(TEXT("NumCustomDataFloats"), ESearchCase::IgnoreCase))
+		{
+			// Skip, as setting NumCustomDataFloats this way causes Unreal to crash!
+			HOUDINI_LOG_WARNING(
+				TEXT("Skipping UProperty %s, custom data floats should be modified via the unreal_num_custom_floats and unreal_per_instance_custom_dataX attributes"),
+				*CurrentPropAttribute.AttributeName);
+			continue;
+		}
+
+		const int32 NumUpdated = FHoudiniGenericAttribute::UpdatePropertyAttributeOnObjects(InObjects, CurrentPropAttribute, InAtIndices);
+		if (NumUpdated <= 0)
+			continue;
+
+		NumSuccess += NumUpdated;
+		HOUDINI_LOG_MESSAGE(TEXT("Modified UProperty %s on %d instances"), *CurrentPropAttribute.AttributeName, NumUpdated);
+	}
+
+	return (NumSuccess > 0);
+}
+
 bool
 FHoudiniInstanceTranslator::RemoveAndDestroyComponent(UObject* InComponent, UObject* InFoliageObject)
 {
@@ -400,6 +400,13 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes,
 			const int32& AtIndex);
 
+		// Updates the generic properties on all the instances at once, resolving each property once per class
+		// InAtIndices contains the attribute index to use for each object
+		static bool UpdateGenericPropertiesAttributes(
+			const TArray<UObject*>& InObjects,
+			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes,
+			const TArray<int32>& InAtIndices);
+
 		static bool GetMaterialOverridesFromAttributes(
 			const int32& InGeoNodeId,
 			const int32& InPartId, 
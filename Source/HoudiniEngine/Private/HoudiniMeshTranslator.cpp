@@ -59,12 +59,13 @@
 #include "Interfaces/ITargetPlatformManagerModule.h"
 #include "GeometryToolsEngine.h"
 
-// #include "Async/ParallelFor.h"
+#include "Async/ParallelFor.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #include "EditorSupportDelegates.h"
 #include "HoudiniGeometryCollectionTranslator.h"
+#include "HoudiniOutputTranslator.h"
 
 
 #if WITH_EDITOR
@@ -82,6 +83,14 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineParallelSimpleColliders(
+	TEXT("HoudiniEngine.ParallelSimpleColliders"),
+	1,
+	TEXT("Fit the simple colliders (box, sphere, capsule, kdop) of a part's split groups in parallel.\n")
+	TEXT("0: Fit the simple colliders one after the other on the game thread\n")
+	TEXT("1: Fit the simple colliders in parallel (default)\n")
+);
+
 // 
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
@@ -1637,6 +1646,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
+	QueuedCollisions.Empty();
 
 	// We need to know the number of LODs that will be needed for this part, and we also need the identifier for the
 	// main split (Normal or LOD0)
@@ -1750,7 +1760,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		FHoudiniOutputObjectIdentifier OutputObjectIdentifier = MakeOutputObjectIdentifier(SplitGroupName, SplitType);
 
 		// Get/Create the Aggregate Collisions for this mesh identifier
-		FKAggregateGeom& AggregateCollisions = AllAggregateCollisions.FindOrAdd(OutputObjectIdentifier);
+		AllAggregateCollisions.FindOrAdd(OutputObjectIdentifier);
 
 		// Handle UCX / Convex Hull colliders
 		if (SplitType == EHoudiniSplitType::InvisibleUCXCollider || SplitType == EHoudiniSplitType::RenderedUCXCollider)
@@ -1759,14 +1769,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			// Get the part position if needed
 			UpdatePartPositionIfNeeded();
 
-			// Create the convex hull colliders and add them to the Aggregate
-			if (!AddConvexCollisionToAggregate(SplitGroupName, AggregateCollisions))
-			{
-				// Failed to generate a convex collider
-				HOUDINI_LOG_WARNING(
-					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] failed to create convex collider."),
-					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-			}
+			// Queue the convex hull colliders, they are added to the Aggregate after the split loop
+			QueuedCollisions.Add({ SplitGroupName, SplitId, OutputObjectIdentifier, true });
 
 			// If the collider is not visible, stop here
 			if (SplitType == EHoudiniSplitType::InvisibleUCXCollider)
@@ -1778,14 +1782,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			// Get the part position if needed
 			UpdatePartPositionIfNeeded();
 
-			// Create the simple colliders and add them to the aggregate
-			if (!AddSimpleCollisionToAggregate(SplitGroupName, AggregateCollisions))
-			{
-				// Failed to generate a convex collider
-				HOUDINI_LOG_WARNING(
-					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] failed to create simple collider."),
-					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-			}
+			// Queue the simple colliders, they are fitted in parallel after the split loop
+			QueuedCollisions.Add({ SplitGroupName, SplitId, OutputObjectIdentifier, false });
 
 			// If the collider is not visible, stop here
 			if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider)
@@ -2912,6 +2910,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		}
 	}
 
+	// Generate the simple/UCX colliders found during the split loop
+	GenerateQueuedCollisions();
+
 	// Look if we only have colliders
 	// If we do, we'll allow attaching sockets to the collider meshes
 	bool bCollidersOnly = true;
@@ -3041,6 +3042,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			tick = FPlatformTime::Seconds();
 		}
 
+		// When the output translator batches the static mesh builds, only queue the mesh:
+		// it will be built concurrently with the other meshes of the cook.
+		if (FHoudiniOutputTranslator::IsStaticMeshBuildBatchOpen())
+		{
+			FHoudiniOutputTranslator::AddStaticMeshToBuildBatch(SM);
+			continue;
+		}
+
 		// BUILD the Static Mesh
 		// bSilent doesnt add the Build Errors...
 		double build_start = FPlatformTime::Seconds();
@@ -3125,6 +3134,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
+	QueuedCollisions.Empty();
 
 	// We need to know the number of LODs that will be needed for this part, and we also need the identifier for the
 	// main split (Normal or LOD0)
@@ -3236,7 +3246,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		FHoudiniOutputObjectIdentifier OutputObjectIdentifier = MakeOutputObjectIdentifier(SplitGroupName, SplitType);
 
 		// Get/Create the Aggregate Collisions for this mesh identifier
-		FKAggregateGeom& AggregateCollisions = AllAggregateCollisions.FindOrAdd(OutputObjectIdentifier);
+		AllAggregateCollisions.FindOrAdd(OutputObjectIdentifier);
 
 		// Handle UCX / Convex Hull colliders
 		if (SplitType == EHoudiniSplitType::InvisibleUCXCollider || SplitType == EHoudiniSplitType::RenderedUCXCollider)
@@ -3244,15 +3254,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			// Get the part position if needed
 			UpdatePartPositionIfNeeded();
 
-			// Create the convex hull colliders and add them to the Aggregate
-			if (!AddConvexCollisionToAggregate(SplitGroupName, AggregateCollisions))
-			{
-				MainStaticMeshCTF = ECollisionTraceFlag::CTF_UseDefault;
-				// Failed to generate a convex collider
-				HOUDINI_LOG_WARNING(
-					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] failed to create convex collider."),
-					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-			}
+			// Queue the convex hull colliders, they are added to the Aggregate after the split loop
+			QueuedCollisions.Add({ SplitGroupName, SplitId, OutputObjectIdentifier, true });
 
 			// If the collider is not visible, stop here
 			if (SplitType == EHoudiniSplitType::InvisibleUCXCollider)
@@ -3264,14 +3267,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			// Get the part position if needed
 			UpdatePartPositionIfNeeded();
 
-			// Create the simple colliders and add them to the aggregate
-			if (!AddSimpleCollisionToAggregate(SplitGroupName, AggregateCollisions))
-			{
-				// Failed to generate a convex collider
-				HOUDINI_LOG_WARNING(
-					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] failed to create simple collider."),
-					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-			}
+			// Queue the simple colliders, they are fitted in parallel after the split loop
+			QueuedCollisions.Add({ SplitGroupName, SplitId, OutputObjectIdentifier, false });
 
 			// If the collider is not visible, stop here
 			if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider)
@@ -4306,6 +4303,11 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		}
 	}
 
+	// Generate the simple/UCX colliders found during the split loop
+	// If a convex collider failed, the main static mesh falls back to its default collision
+	if (GenerateQueuedCollisions().Num() > 0)
+		MainStaticMeshCTF = ECollisionTraceFlag::CTF_UseDefault;
+
 	// Look if we only have colliders
 	// If we do, we'll allow attaching sockets to the collider meshes
 	bool bCollidersOnly = true;
@@ -4434,6 +4436,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			tick = FPlatformTime::Seconds();
 		}
 
+		// When the output translator batches the static mesh builds, only queue the mesh:
+		// it will be built concurrently with the other meshes of the cook.
+		if (FHoudiniOutputTranslator::IsStaticMeshBuildBatchOpen())
+		{
+			FHoudiniOutputTranslator::AddStaticMeshToBuildBatch(SM);
+			continue;
+		}
+
 		// BUILD the Static Mesh
 		// bSilent doesnt add the Build Errors...
 		double build_start = FPlatformTime::Seconds();
@@ -5400,6 +5410,11 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 
 		FoundStaticMesh->Optimize();
 
+		// Keep the normals, tangents and UVs in the render buffers' formats
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->bPackProxyStaticMeshVertexData)
+			FoundStaticMesh->PackVertexData();
+
 		// Check if the mesh is valid (check all the counts (vertex, triangles, vertex instances, UVs etc) but skip
 		// looping over each individual triangle vertex index to check if the value is valid).
 		const bool bSkipVertexIndicesCheck = true;
@@ -5743,28 +5758,8 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 
 	// We're only interested in unique vertices
 	TArray<int32> UniqueVertexIndexes;
-	for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
-	{
-		int32 Index = SplitGroupVertexList[VertexIdx];
-		if (!PartPositions.IsValidIndex(Index))
-			continue;
-
-		UniqueVertexIndexes.AddUnique(Index);
-	}
-
-	// Extract the collision geo's vertices
 	TArray< FVector > VertexArray;
-	VertexArray.SetNum(UniqueVertexIndexes.Num());
-	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
-	{
-		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
-			continue;
-
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
+	GetSplitGroupUniquePositions(SplitGroupVertexList, PartPositions, UniqueVertexIndexes, VertexArray);
 
 #if WITH_EDITOR
 	// Do we want to create multiple convex hulls?
@@ -5845,81 +5840,228 @@ FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupN
 
 	// We're only interested in unique vertices
 	TArray<int32> UniqueVertexIndexes;
-	for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
-	{
-		int32 Index = SplitGroupVertexList[VertexIdx];
-		if (!PartPositions.IsValidIndex(Index))
-			continue;
+	TArray< FVector > VertexArray;
+	GetSplitGroupUniquePositions(SplitGroupVertexList, PartPositions, UniqueVertexIndexes, VertexArray);
 
-		UniqueVertexIndexes.AddUnique(Index);
+	const int32 NewColliders = GenerateSimpleCollisionForSplitGroup(SplitGroupName, VertexArray, AggCollisions);
+
+	return (NewColliders > 0);
+}
+
+TSet<FHoudiniOutputObjectIdentifier>
+FHoudiniMeshTranslator::GenerateQueuedCollisions()
+{
+	TSet<FHoudiniOutputObjectIdentifier> FailedConvexIdentifiers;
+	if (QueuedCollisions.Num() <= 0)
+		return FailedConvexIdentifiers;
+
+	// Gather the simple colliders, they can be fitted independently from one another
+	TArray<FString> SimpleSplitGroupNames;
+	for (const FQueuedCollision& CurQueued : QueuedCollisions)
+	{
+		if (!CurQueued.bIsConvex)
+			SimpleSplitGroupNames.Add(CurQueued.SplitGroupName);
 	}
 
-	// Extract the collision geo's vertices
-	TArray< FVector > VertexArray;
-	VertexArray.SetNum(UniqueVertexIndexes.Num());
-	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
+	TArray<FKAggregateGeom> SimpleAggregates;
+	TArray<int32> SimpleColliderCounts;
+	if (SimpleSplitGroupNames.Num() > 0)
 	{
-		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
-			continue;
+		// Extract the unique positions of each simple collider's split group
+		const bool bSingleThread = CVarHoudiniEngineParallelSimpleColliders.GetValueOnAnyThread() == 0;
+		TArray<TArray<FVector>> SimplePositionArrays;
+		SimplePositionArrays.SetNum(SimpleSplitGroupNames.Num());
+		ParallelFor(SimpleSplitGroupNames.Num(), [&](int32 Idx)
+		{
+			const TArray<int32>* SplitGroupVertexList = AllSplitVertexLists.Find(SimpleSplitGroupNames[Idx]);
+			if (!SplitGroupVertexList)
+				return;
+
+			TArray<int32> UniqueVertexIndexes;
+			GetSplitGroupUniquePositions(*SplitGroupVertexList, PartPositions, UniqueVertexIndexes, SimplePositionArrays[Idx]);
+		}, bSingleThread);
 
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		GenerateSimpleCollisionsForSplitGroups(SimpleSplitGroupNames, SimplePositionArrays, SimpleAggregates, SimpleColliderCounts);
 	}
 
-	int32 NewColliders = 0;
-	if (SplitGroupName.Contains("Box"))
+	// Add the colliders to their aggregate, in the order they were found in the split loop
+	int32 SimpleIdx = 0;
+	for (const FQueuedCollision& CurQueued : QueuedCollisions)
 	{
-		NewColliders = FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(VertexArray, AggCollisions);
+		FKAggregateGeom& AggregateCollisions = AllAggregateCollisions.FindOrAdd(CurQueued.Identifier);
+		if (CurQueued.bIsConvex)
+		{
+			if (!AddConvexCollisionToAggregate(CurQueued.SplitGroupName, AggregateCollisions))
+			{
+				FailedConvexIdentifiers.Add(CurQueued.Identifier);
+				// Failed to generate a convex collider
+				HOUDINI_LOG_WARNING(
+					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] failed to create convex collider."),
+					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, CurQueued.SplitId, *CurQueued.SplitGroupName);
+			}
+			continue;
+		}
+
+		const int32 CurrentSimpleIdx = SimpleIdx++;
+		if (!SimpleColliderCounts.IsValidIndex(CurrentSimpleIdx) || SimpleColliderCounts[CurrentSimpleIdx] <= 0)
+		{
+			// Failed to generate a simple collider
+			HOUDINI_LOG_WARNING(
+				TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] failed to create simple collider."),
+				HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, CurQueued.SplitId, *CurQueued.SplitGroupName);
+			continue;
+		}
+
+		const FKAggregateGeom& SimpleAggregate = SimpleAggregates[CurrentSimpleIdx];
+		AggregateCollisions.SphereElems.Append(SimpleAggregate.SphereElems);
+		AggregateCollisions.BoxElems.Append(SimpleAggregate.BoxElems);
+		AggregateCollisions.SphylElems.Append(SimpleAggregate.SphylElems);
+		AggregateCollisions.ConvexElems.Append(SimpleAggregate.ConvexElems);
 	}
-	else if (SplitGroupName.Contains("Sphere"))
+
+	QueuedCollisions.Empty();
+
+	return FailedConvexIdentifiers;
+}
+
+void
+FHoudiniMeshTranslator::GetSplitGroupUniquePositions(
+	const TArray<int32>& InSplitVertexList,
+	const TArray<float>& InPartPositions,
+	TArray<int32>& OutUniqueVertexIndices,
+	TArray<FVector>& OutPositions)
+{
+	// Keep the vertices in order of first use, the set only replaces the linear AddUnique() lookups
+	TSet<int32> FoundVertexIndices;
+	FoundVertexIndices.Reserve(InSplitVertexList.Num());
+	OutUniqueVertexIndices.Reset(InSplitVertexList.Num());
+	for (const int32& Index : InSplitVertexList)
 	{
-		NewColliders = FHoudiniMeshTranslator::GenerateSphereAsSimpleCollision(VertexArray, AggCollisions);
+		if (!InPartPositions.IsValidIndex(Index))
+			continue;
+
+		bool bAlreadyFound = false;
+		FoundVertexIndices.Add(Index, &bAlreadyFound);
+		if (!bAlreadyFound)
+			OutUniqueVertexIndices.Add(Index);
 	}
-	else if (SplitGroupName.Contains("Capsule"))
+
+	// Extract the collision geo's vertices
+	OutPositions.Reset();
+	OutPositions.SetNumZeroed(OutUniqueVertexIndices.Num());
+	for (int32 Idx = 0; Idx < OutUniqueVertexIndices.Num(); Idx++)
 	{
-		NewColliders = FHoudiniMeshTranslator::GenerateOrientedSphylAsSimpleCollision(VertexArray, AggCollisions);
+		const int32 VertexIndex = OutUniqueVertexIndices[Idx];
+		if (!InPartPositions.IsValidIndex(VertexIndex * 3 + 2))
+			continue;
+
+		OutPositions[Idx].X = InPartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[Idx].Y = InPartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[Idx].Z = InPartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
 	}
-	else
+}
+
+int32
+FHoudiniMeshTranslator::GenerateSimpleCollisionForSplitGroup(
+	const FString& InSplitGroupName, const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions)
+{
+	if (InSplitGroupName.Contains("Box"))
+		return FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(InPositionArray, OutAggregateCollisions);
+
+	if (InSplitGroupName.Contains("Sphere"))
+		return FHoudiniMeshTranslator::GenerateSphereAsSimpleCollision(InPositionArray, OutAggregateCollisions);
+
+	if (InSplitGroupName.Contains("Capsule"))
+		return FHoudiniMeshTranslator::GenerateOrientedSphylAsSimpleCollision(InPositionArray, OutAggregateCollisions);
+
+	// We need to see what type of collision the user wants
+	// by default, a kdop26 will be created
+	TArray<FVector> DirArray;
+	GetKDopDirectionsForSplitGroup(InSplitGroupName, DirArray);
+
+	return FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(InPositionArray, DirArray, OutAggregateCollisions);
+}
+
+void
+FHoudiniMeshTranslator::GenerateSimpleCollisionsForSplitGroups(
+	const TArray<FString>& InSplitGroupNames,
+	const TArray<TArray<FVector>>& InPositionArrays,
+	TArray<FKAggregateGeom>& OutAggregateCollisions,
+	TArray<int32>& OutNumColliders)
+{
+	const int32 NumSplitGroups = FMath::Min(InSplitGroupNames.Num(), InPositionArrays.Num());
+	OutAggregateCollisions.Empty();
+	OutAggregateCollisions.SetNum(NumSplitGroups);
+	OutNumColliders.Empty();
+	OutNumColliders.SetNumZeroed(NumSplitGroups);
+
+	// The kdops' brushes need a UModel, so only their planes are computed in parallel
+	TArray<TArray<FPlane>> KDopPlanes;
+	KDopPlanes.SetNum(NumSplitGroups);
+
+	const bool bSingleThread = CVarHoudiniEngineParallelSimpleColliders.GetValueOnAnyThread() == 0;
+	ParallelFor(NumSplitGroups, [&](int32 Idx)
 	{
-		// We need to see what type of collision the user wants
-		// by default, a kdop26 will be created
-		uint32 NumDirections = 26;
-		const FVector* Directions = KDopDir26;
-		if (SplitGroupName.Contains("kdop10X"))
-		{
-			NumDirections = 10;
-			Directions = KDopDir10X;
-		}
-		else if (SplitGroupName.Contains("kdop10Y"))
+		const FString& SplitGroupName = InSplitGroupNames[Idx];
+		if (IsKDopSplitGroup(SplitGroupName))
 		{
-			NumDirections = 10;
-			Directions = KDopDir10Y;
+			TArray<FVector> DirArray;
+			GetKDopDirectionsForSplitGroup(SplitGroupName, DirArray);
+			CalcKDopPlanes(InPositionArrays[Idx], DirArray, KDopPlanes[Idx]);
 		}
-		else if (SplitGroupName.Contains("kdop10Z"))
-		{
-			NumDirections = 10;
-			Directions = KDopDir10Z;
-		}
-		else if (SplitGroupName.Contains("kdop18"))
+		else
 		{
-			NumDirections = 18;
-			Directions = KDopDir18;
+			OutNumColliders[Idx] = GenerateSimpleCollisionForSplitGroup(SplitGroupName, InPositionArrays[Idx], OutAggregateCollisions[Idx]);
 		}
+	}, bSingleThread);
 
-		// Converting the directions to a TArray
-		TArray<FVector> DirArray;
-		DirArray.SetNum(NumDirections);
-		for (uint32 DirectionIndex = 0; DirectionIndex < NumDirections; DirectionIndex++)
-		{
-			DirArray[DirectionIndex] = Directions[DirectionIndex];
-		}
+	// Build the kdops on the game thread
+	for (int32 Idx = 0; Idx < NumSplitGroups; Idx++)
+	{
+		if (IsKDopSplitGroup(InSplitGroupNames[Idx]))
+			OutNumColliders[Idx] = GenerateKDopFromPlanes(KDopPlanes[Idx], OutAggregateCollisions[Idx]);
+	}
+}
+
+bool
+FHoudiniMeshTranslator::IsKDopSplitGroup(const FString& InSplitGroupName)
+{
+	return !InSplitGroupName.Contains("Box") && !InSplitGroupName.Contains("Sphere") && !InSplitGroupName.Contains("Capsule");
+}
 
-		NewColliders = FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(VertexArray, DirArray, AggCollisions);
+void
+FHoudiniMeshTranslator::GetKDopDirectionsForSplitGroup(const FString& InSplitGroupName, TArray<FVector>& OutDirs)
+{
+	// by default, a kdop26 will be created
+	uint32 NumDirections = 26;
+	const FVector* Directions = KDopDir26;
+	if (InSplitGroupName.Contains("kdop10X"))
+	{
+		NumDirections = 10;
+		Directions = KDopDir10X;
+	}
+	else if (InSplitGroupName.Contains("kdop10Y"))
+	{
+		NumDirections = 10;
+		Directions = KDopDir10Y;
+	}
+	else if (InSplitGroupName.Contains("kdop10Z"))
+	{
+		NumDirections = 10;
+		Directions = KDopDir10Z;
+	}
+	else if (InSplitGroupName.Contains("kdop18"))
+	{
+		NumDirections = 18;
+		Directions = KDopDir18;
 	}
 
-	return (NewColliders > 0);
+	// Converting the directions to a TArray
+	OutDirs.SetNum(NumDirections);
+	for (uint32 DirectionIndex = 0; DirectionIndex < NumDirections; DirectionIndex++)
+	{
+		OutDirs[DirectionIndex] = Directions[DirectionIndex];
+	}
 }
 
 int32
@@ -6752,6 +6894,15 @@ FHoudiniMeshTranslator::CalcBoundingSphyl(const TArray<FVector>& PositionArray,
 
 int32
 FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(const TArray<FVector>& InPositionArray, const TArray<FVector> &Dirs, FKAggregateGeom& OutAggregateCollisions)
+{
+	TArray<FPlane> Planes;
+	CalcKDopPlanes(InPositionArray, Dirs, Planes);
+
+	return GenerateKDopFromPlanes(Planes, OutAggregateCollisions);
+}
+
+void
+FHoudiniMeshTranslator::CalcKDopPlanes(const TArray<FVector>& InPositionArray, const TArray<FVector>& Dirs, TArray<FPlane>& OutPlanes)
 {
 	//
 	// Code simplified and adapted to work with a simple vector array from GeomFitUtils.cpp
@@ -6767,10 +6918,6 @@ FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(const TArray<FVector>& InP
 	for (int32 n = 0; n < maxDist.Num(); n++)
 		maxDist[n] = -my_flt_max;
 
-	// Construct temporary UModel for kdop creation. We keep no refs to it, so it can be GC'd.
-	auto TempModel = NewObject<UModel>();
-	TempModel->Initialize(nullptr, 1);
-
 	// For each vertex, project along each kdop direction, to find the max in that direction.
 	for (int32 i = 0; i < InPositionArray.Num(); i++)
 	{
@@ -6788,32 +6935,45 @@ FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(const TArray<FVector>& InP
 		maxDist[i] += MinSize;
 	}
 
-	// Now we have the planes of the kdop, we work out the face polygons.
-	TArray<FPlane> planes;
+	// Now we have the planes of the kdop
+	OutPlanes.Reset(kCount);
 	for (int32 i = 0; i < kCount; i++)
-		planes.Add(FPlane(Dirs[i], maxDist[i]));
+		OutPlanes.Add(FPlane(Dirs[i], maxDist[i]));
+}
+
+int32
+FHoudiniMeshTranslator::GenerateKDopFromPlanes(const TArray<FPlane>& InPlanes, FKAggregateGeom& OutAggregateCollisions)
+{
+	//
+	// Code simplified and adapted to work with a simple vector array from GeomFitUtils.cpp
+	//
 
-	for (int32 i = 0; i < planes.Num(); i++)
+	// Construct temporary UModel for kdop creation. We keep no refs to it, so it can be GC'd.
+	auto TempModel = NewObject<UModel>();
+	TempModel->Initialize(nullptr, 1);
+
+	// Now we have the planes of the kdop, we work out the face polygons.
+	for (int32 i = 0; i < InPlanes.Num(); i++)
 	{
 		FPoly*	Polygon = new(TempModel->Polys->Element) FPoly();
 		FVector Base, AxisX, AxisY;
 
 		Polygon->Init();
-		Polygon->Normal = planes[i];
+		Polygon->Normal = InPlanes[i];
 		Polygon->Normal.FindBestAxisVectors(AxisX, AxisY);
 
-		Base = planes[i] * planes[i].W;
+		Base = InPlanes[i] * InPlanes[i].W;
 
 		new(Polygon->Vertices) FVector(Base + AxisX * HALF_WORLD_MAX + AxisY * HALF_WORLD_MAX);
 		new(Polygon->Vertices) FVector(Base + AxisX * HALF_WORLD_MAX - AxisY * HALF_WORLD_MAX);
 		new(Polygon->Vertices) FVector(Base - AxisX * HALF_WORLD_MAX - AxisY * HALF_WORLD_MAX);
 		new(Polygon->Vertices) FVector(Base - AxisX * HALF_WORLD_MAX + AxisY * HALF_WORLD_MAX);
 
-		for (int32 j = 0; j < planes.Num(); j++)
+		for (int32 j = 0; j < InPlanes.Num(); j++)
 		{
 			if (i != j)
 			{
-				if (!Polygon->Split(-FVector(planes[j]), planes[j] * planes[j].W))
+				if (!Polygon->Split(-FVector(InPlanes[j]), InPlanes[j] * InPlanes[j].W))
 				{
 					Polygon->Vertices.Empty();
 					break;
@@ -176,6 +176,34 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		void CopyAttributesFromHGPOForSplit(
 			const FHoudiniOutputObjectIdentifier& InOutputObjectIdentifier, TMap<FString, FString>& OutAttributes, TMap<FString, FString>& OutTokens);
 
+		//-----------------------------------------------------------------------------------------------------------------------------
+		// COLLISIONS
+		//-----------------------------------------------------------------------------------------------------------------------------
+
+		// Extracts the unique, valid vertex indices of a split group (in order of first use) and their positions
+		static void GetSplitGroupUniquePositions(
+			const TArray<int32>& InSplitVertexList,
+			const TArray<float>& InPartPositions,
+			TArray<int32>& OutUniqueVertexIndices,
+			TArray<FVector>& OutPositions);
+
+		// Generates the simple collider matching the split group's name (Box, Sphere, Capsule or kdop)
+		static int32 GenerateSimpleCollisionForSplitGroup(
+			const FString& InSplitGroupName, const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
+
+		// Generates the simple colliders for multiple split groups, fitting them in parallel.
+		// Produces the same colliders as calling GenerateSimpleCollisionForSplitGroup() for each group.
+		static void GenerateSimpleCollisionsForSplitGroups(
+			const TArray<FString>& InSplitGroupNames,
+			const TArray<TArray<FVector>>& InPositionArrays,
+			TArray<FKAggregateGeom>& OutAggregateCollisions,
+			TArray<int32>& OutNumColliders);
+
+		// Returns true if the split group's simple collider is a kdop
+		static bool IsKDopSplitGroup(const FString& InSplitGroupName);
+		// Gets the kdop directions matching the split group's name (kdop26 by default)
+		static void GetKDopDirectionsForSplitGroup(const FString& InSplitGroupName, TArray<FVector>& OutDirs);
+
 		//-----------------------------------------------------------------------------------------------------------------------------
 		// ACCESSORS
 		//-----------------------------------------------------------------------------------------------------------------------------
@@ -286,6 +314,11 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		bool AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
 		// Create simple colliders for a split and add to the aggregate
 		bool AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
+		// Generates the colliders queued during the split loop and adds them to AllAggregateCollisions, in queue order.
+		// The simple colliders are fitted in parallel.
+		// Returns the identifiers of the meshes whose convex collider could not be created.
+		TSet<FHoudiniOutputObjectIdentifier> GenerateQueuedCollisions();
+
 		
 		// Helper functions to generate the simple colliders and add them to the aggregate
 		static int32 GenerateBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
@@ -294,6 +327,10 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		static int32 GenerateSphylAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
 		static int32 GenerateOrientedSphylAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
 		static int32 GenerateKDopAsSimpleCollision(const TArray<FVector>& InPositionArray, const TArray<FVector> &Dirs, FKAggregateGeom& OutAggregateCollisions);
+		// The kdop generation is split in two: computing the planes is thread safe,
+		// but building the convex from the planes requires a temporary UModel and must run on the game thread.
+		static void CalcKDopPlanes(const TArray<FVector>& InPositionArray, const TArray<FVector>& Dirs, TArray<FPlane>& OutPlanes);
+		static int32 GenerateKDopFromPlanes(const TArray<FPlane>& InPlanes, FKAggregateGeom& OutAggregateCollisions);
 
 		// Helper functions for the simple colliders generation
 		static void CalcBoundingBox(const TArray<FVector>& PositionArray, FVector& Center, FVector& Extents, FVector& LimitVec);
@@ -375,6 +412,16 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// The generated simple/UCX colliders
 		TMap <FHoudiniOutputObjectIdentifier, FKAggregateGeom> AllAggregateCollisions;
 
+		// Simple/UCX colliders found during the split loop, generated by GenerateQueuedCollisions()
+		struct FQueuedCollision
+		{
+			FString SplitGroupName;
+			int32 SplitId;
+			FHoudiniOutputObjectIdentifier Identifier;
+			bool bIsConvex;
+		};
+		TArray<FQueuedCollision> QueuedCollisions;
+
 		// Names of the groups used for splitting the geometry
 		TArray<FString> AllSplitGroups;
 
@@ -58,12 +58,26 @@
 #include "Modules/ModuleManager.h"
 #include "WorldBrowserModule.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/UObjectIterator.h"
 #include "InstancedFoliageActor.h"
 #include "GeometryCollection/GeometryCollectionActor.h"
 #include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionObject.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineBatchStaticMeshBuilds(
+	TEXT("HoudiniEngine.BatchStaticMeshBuilds"),
+	1,
+	TEXT("Controls whether the static meshes created by a cook are built together and concurrently once all mesh outputs are processed.\n")
+	TEXT("0: Disabled, each static mesh is built as soon as it is created\n")
+	TEXT("1: Enabled (default)\n")
+);
+
+TArray<TWeakObjectPtr<UStaticMesh>> FHoudiniOutputTranslator::StaticMeshBuildBatch;
+bool FHoudiniOutputTranslator::bStaticMeshBuildBatchOpen = false;
+
 // 
 bool
 FHoudiniOutputTranslator::UpdateOutputs(
@@ -268,6 +282,9 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	// (this can easily happen when using packed prims)
 	TMap<FString, UMaterialInterface*> AllOutputMaterials;
 
+	// Queue the static meshes created by the mesh outputs, so they can all be built at once before processing instancers
+	FHoudiniOutputTranslator::BeginStaticMeshBuildBatch();
+
 	TArray<UPackage*> CreatedPackages;
 	for (int32 OutputIdx = 0; OutputIdx < NumOutputs; OutputIdx++)
 	{
@@ -453,6 +470,9 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		}
 	}
 
+	// Build all the static meshes created by this cook
+	FHoudiniOutputTranslator::BuildStaticMeshBatch();
+
 	bool HasGeometryCollection = false;
 	
 	// Now that all meshes have been created, process the instancers
@@ -657,6 +677,7 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 
 	bool bFoundProxies = false;
 	TArray<UHoudiniOutput*> InstancerOutputs;
+	FHoudiniOutputTranslator::BeginStaticMeshBuildBatch();
 	for (auto& CurOutput : HAC->Outputs)
 	{
 		const EHoudiniOutputType OutputType = CurOutput->GetType();
@@ -691,6 +712,8 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 		}
 	}
 
+	FHoudiniOutputTranslator::BuildStaticMeshBatch();
+
 	// Rebuild instancers if we built any static meshes from proxies
 	if (bFoundProxies)
 	{
@@ -2398,4 +2421,90 @@ FHoudiniOutputTranslator::GetCustomPartNameFromAttribute(const HAPI_NodeId & Nod
 	return true;
 }
 
+void
+FHoudiniOutputTranslator::BeginStaticMeshBuildBatch()
+{
+	if (CVarHoudiniEngineBatchStaticMeshBuilds.GetValueOnGameThread() <= 0)
+		return;
+
+	bStaticMeshBuildBatchOpen = true;
+}
+
+bool
+FHoudiniOutputTranslator::IsStaticMeshBuildBatchOpen()
+{
+	return bStaticMeshBuildBatchOpen;
+}
+
+void
+FHoudiniOutputTranslator::AddStaticMeshToBuildBatch(UStaticMesh* InStaticMesh)
+{
+	if (!IsValid(InStaticMesh))
+		return;
+
+	StaticMeshBuildBatch.AddUnique(InStaticMesh);
+}
+
+void
+FHoudiniOutputTranslator::BuildStaticMeshBatch()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniOutputTranslator::BuildStaticMeshBatch"));
+
+	bStaticMeshBuildBatchOpen = false;
+
+	TArray<UStaticMesh*> StaticMeshes;
+	StaticMeshes.Reserve(StaticMeshBuildBatch.Num());
+	for (TWeakObjectPtr<UStaticMesh>& StaticMeshPtr : StaticMeshBuildBatch)
+	{
+		UStaticMesh* StaticMesh = StaticMeshPtr.Get();
+		if (IsValid(StaticMesh))
+			StaticMeshes.Add(StaticMesh);
+	}
+	StaticMeshBuildBatch.Empty();
+
+	if (StaticMeshes.Num() <= 0)
+		return;
+
+	FString Notification = FString::Printf(TEXT("Building %d static meshes..."), StaticMeshes.Num());
+	FHoudiniEngine::Get().UpdateTaskSlateNotification(FText::FromString(Notification));
+
+	// BatchBuild builds the render data of all the meshes in parallel on the task graph.
+	// The meshes are built together, so only the time of the whole batch is meaningful.
+	const double BuildStart = FPlatformTime::Seconds();
+	TArray<FText> SMBuildErrors;
+	UStaticMesh::BatchBuild(StaticMeshes, true, nullptr, &SMBuildErrors);
+	const double BuildTime = FPlatformTime::Seconds() - BuildStart;
+
+	// Commit the new collision to the components using the meshes in a single pass over the components.
+	// This replaces RefreshCollisionChange, but without CreateNavCollision as it is already called by
+	// UStaticMesh::PostBuildInternal as part of the build.
+	TSet<UStaticMesh*> BuiltStaticMeshes(StaticMeshes);
+	for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
+	{
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
+		if (!IsValid(StaticMeshComponent) || !BuiltStaticMeshes.Contains(StaticMeshComponent->GetStaticMesh()))
+			continue;
+
+		// The component might have been registered before its mesh was built
+		StaticMeshComponent->UpdateBounds();
+
+		// it needs to recreate IF it already has been created
+		if (StaticMeshComponent->IsPhysicsStateCreated())
+			StaticMeshComponent->RecreatePhysicsState();
+	}
+
+	for (UStaticMesh* StaticMesh : StaticMeshes)
+	{
+		StaticMesh->GetOnMeshChanged().Broadcast();
+
+		UPackage* MeshPackage = StaticMesh->GetOutermost();
+		if (IsValid(MeshPackage))
+			MeshPackage->MarkPackageDirty();
+	}
+
+	FEditorSupportDelegates::RedrawAllViewports.Broadcast();
+
+	HOUDINI_LOG_MESSAGE(TEXT("Built %d static meshes in %f seconds."), StaticMeshes.Num(), BuildTime);
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
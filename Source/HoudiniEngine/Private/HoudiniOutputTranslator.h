@@ -32,6 +32,7 @@
 
 class UHoudiniOutput;
 class UHoudiniAssetComponent;
+class UStaticMesh;
 
 struct FHoudiniObjectInfo;
 struct FHoudiniGeoInfo;
@@ -103,4 +104,18 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 	static void ClearOutput(UHoudiniOutput* Output);
 
 	static bool GetCustomPartNameFromAttribute(const HAPI_NodeId & NodeId, const HAPI_PartId & PartId, FString & OutCustomPartName);
+
+	// Static mesh build batch:
+	// While a batch is open, the mesh translator queues the static meshes it creates instead of building them one by one.
+	// BuildStaticMeshBatch() then builds all of them concurrently and refreshes their components in a single pass.
+	static void BeginStaticMeshBuildBatch();
+	static bool IsStaticMeshBuildBatchOpen();
+	static void AddStaticMeshToBuildBatch(UStaticMesh* InStaticMesh);
+	static void BuildStaticMeshBatch();
+
+protected:
+
+	// Static meshes waiting to be built by the current batch
+	static TArray<TWeakObjectPtr<UStaticMesh>> StaticMeshBuildBatch;
+	static bool bStaticMeshBuildBatchOpen;
 };
\ No newline at end of file
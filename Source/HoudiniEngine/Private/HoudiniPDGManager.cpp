@@ -34,6 +34,7 @@
 #include "HoudiniAsset.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniDetailsRefreshCoordinator.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniAssetComponent.h"
@@ -52,6 +53,37 @@ HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+// Number of imports that can be sent to a commandlet before it replies: one being imported, and one queued so the
+// commandlet doesn't wait for the next dispatch. The other work result objects stay in ToLoad until a commandlet
+// is available.
+static const int32 HoudiniBGEOCommandletMaxPendingImports = 2;
+
+FHoudiniBGEOCommandletImport::FHoudiniBGEOCommandletImport()
+	: TOPNodeId(-1)
+	, WorkItemId(-1)
+{
+}
+
+FHoudiniBGEOCommandletImport::FHoudiniBGEOCommandletImport(const int32& InTOPNodeId, const int32& InWorkItemId, const FString& InName)
+	: TOPNodeId(InTOPNodeId)
+	, WorkItemId(InWorkItemId)
+	, Name(InName)
+{
+}
+
+bool
+FHoudiniBGEOCommandletImport::operator==(const FHoudiniBGEOCommandletImport& InOther) const
+{
+	return TOPNodeId == InOther.TOPNodeId && WorkItemId == InOther.WorkItemId && Name == InOther.Name;
+}
+
+FHoudiniBGEOCommandletWorker::FHoudiniBGEOCommandletWorker()
+	: ProcessId(0)
+	, LastActivityTime(0.0)
+	, bCrashed(false)
+{
+}
+
 FHoudiniPDGManager::FHoudiniPDGManager()
 {
 }
@@ -1338,7 +1370,8 @@ FHoudiniPDGManager::RefreshPDGAssetLinkUI(UHoudiniPDGAssetLink* InAssetLink)
 	AActor* ActorOwner = HAC->GetOwner();
 	if (ActorOwner != nullptr && ActorOwner->IsSelected())
 	{
-		FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+		// The PDG rows aren't part of the component's signature, always rebuild them (once per frame)
+		FHoudiniDetailsRefreshCoordinator::RequestRefresh(HAC, true);
 	}
 }
 
@@ -1398,22 +1431,8 @@ FHoudiniPDGManager::CreateOrRelinkWorkItem(
 		// link all the IDs are INDEX_NONE and so we re-use any stale entries in array index order (should be reliable
 		// if work items generate in the same order. In the future we might have to consider adding support for a
 		// custom ID attribute for more stable re-linking of work items).
-		Index = InTOPNode->ArrayIndexOfFirstInvalidWorkResult();
-		if (Index == INDEX_NONE)
-		{
-			// If we couldn't find a stale entry to re-use, create a new one
-			FTOPWorkResult LocalWorkResult;
-			LocalWorkResult.WorkItemID = InWorkItemID;
-			LocalWorkResult.WorkItemIndex = WorkItemInfo.index;
-			Index = InTOPNode->WorkResult.Add(LocalWorkResult);
-		}
-		else
-		{
-			// We found a stale entry, re-use it
-			FTOPWorkResult& ReUsedWorkResult = InTOPNode->WorkResult[Index];
-			ReUsedWorkResult.WorkItemID = InWorkItemID;
-			ReUsedWorkResult.WorkItemIndex = WorkItemInfo.index;
-		}
+		// If we couldn't find a stale entry to re-use, a new one is created.
+		Index = InTOPNode->AddOrReuseWorkResult(InWorkItemID, WorkItemInfo.index);
 	}
 
 	return Index;
@@ -1637,9 +1656,10 @@ FHoudiniPDGManager::SyncAndPruneWorkItems(UTOPNode* InTOPNode)
 			HOUDINI_PDG_WARNING(
 				TEXT("Pruning a FTOPWorkResult entry from TOP Node %d, WorkItemID %d, WorkItemIndex %d, Array Index %d"),
 				InTOPNode->NodeId, WorkResult.WorkItemID, WorkResult.WorkItemIndex, Index);
+			const int32 WorkItemID = WorkResult.WorkItemID;
 			WorkResult.ClearAndDestroyResultObjects(HoudiniComponentGuid);
-			InTOPNode->WorkResult.RemoveAt(Index);
-			InTOPNode->OnWorkItemRemoved(WorkResult.WorkItemID);
+			InTOPNode->RemoveWorkResultAt(Index);
+			InTOPNode->OnWorkItemRemoved(WorkItemID);
 			NumRemoved++;
 		}
 	}
@@ -1741,6 +1761,15 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 						FTOPWorkResultObject& CurrentWorkResultObj = CurrentWorkResult.ResultObjects[WorkResultObjectArrayIndex];
 						if (CurrentWorkResultObj.State == EPDGWorkResultState::ToLoad)
 						{
+							// Dispatch to the least busy commandlet. If they are all busy, try again on the next tick.
+							FHoudiniBGEOCommandletWorker* CommandletWorker = nullptr;
+							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
+							{
+								CommandletWorker = FindBGEOCommandletWorkerForImport();
+								if (!CommandletWorker)
+									continue;
+							}
+
 							CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
 
 							// Load this WRObj
@@ -1751,7 +1780,7 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 							// CurrentWorkResult.WorkItemIndex is not necessarily unique)
 							PackageParams.PDGWorkResultArrayIndex = WorkResultArrayIndex;
 
-							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
+							if (CommandletWorker)
 							{
 								BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
 									CurrentWorkResultObj.FilePath,
@@ -1761,7 +1790,12 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 									CurrentWorkResult.WorkItemID,
 									StaticMeshGenerationProperties,
 									MeshBuildSettings
-								), BGEOCommandletAddress);
+								), CommandletWorker->Address);
+
+								if (CommandletWorker->PendingImports.Num() <= 0)
+									CommandletWorker->LastActivityTime = FPlatformTime::Seconds();
+								CommandletWorker->PendingImports.Add(FHoudiniBGEOCommandletImport(
+									CurrentTOPNode->NodeId, CurrentWorkResult.WorkItemID, CurrentWorkResultObj.Name));
 							}
 							else
 							{
@@ -1829,14 +1863,19 @@ void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_DISPLAY(TEXT("Received Discover from %s"), *InContext->GetSender().ToString());
-	// Ignore any discover acks received if we already have a valid local address
-	// for the commandlet
-	if (BGEOCommandletAddress.IsValid())
+	if (!InMessage.CommandletGuid.IsValid())
 		return;
 
-	if (BGEOCommandletProcHandle.IsValid() && InMessage.CommandletGuid.IsValid() && BGEOCommandletGuid == InMessage.CommandletGuid)
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		BGEOCommandletAddress = InContext->GetSender();
+		// Ignore any discover acks received if we already have a valid local address
+		// for the commandlet
+		if (Worker.Guid != InMessage.CommandletGuid || Worker.Address.IsValid())
+			continue;
+
+		if (Worker.ProcHandle.IsValid() && !Worker.bCrashed)
+			Worker.Address = InContext->GetSender();
+		break;
 	}
 }
 
@@ -1845,6 +1884,19 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Received BGEO import result message"));
+
+	// The commandlet that sent the result can receive another import
+	const FHoudiniBGEOCommandletImport Import(InMessage.TOPNodeId, InMessage.WorkItemId, InMessage.Name);
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Address == InContext->GetSender())
+		{
+			Worker.PendingImports.RemoveSingle(Import);
+			Worker.LastActivityTime = FPlatformTime::Seconds();
+			break;
+		}
+	}
+
 	if (InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success || InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_PartialSuccess)
 	{
 		FHoudiniPackageParams PackageParams;
@@ -2085,7 +2137,6 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 {
 	if (!BGEOCommandletEndpoint.IsValid())
 	{
-		BGEOCommandletAddress.Invalidate();
 		BGEOCommandletEndpoint = FMessageEndpoint::Builder(TEXT("Houdini BGEO Commandlet"))
 			.Handling<FHoudiniPDGImportBGEOResultMessage>(this, &FHoudiniPDGManager::HandleImportBGEOResultMessage)
 			.Handling<FHoudiniPDGImportBGEODiscoverMessage>(this, &FHoudiniPDGManager::HandleImportBGEODiscoverMessage)
@@ -2100,101 +2151,225 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 		BGEOCommandletEndpoint->Subscribe<FHoudiniPDGImportBGEODiscoverMessage>();
 	}
 
-	if (!BGEOCommandletProcHandle.IsValid() || !FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	int32 NumProcesses = 1;
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (IsValid(HoudiniRuntimeSettings))
+		NumProcesses = FMath::Max(HoudiniRuntimeSettings->PDGAsyncCommandletImportProcesses, 1);
+
+	// Remove the commandlets that are not running anymore, their imports are sent to the other commandlets
+	for (int32 WorkerIdx = BGEOCommandletWorkers.Num() - 1; WorkerIdx >= 0; --WorkerIdx)
 	{
-		// Start the bgeo commandlet
-		static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
-		BGEOCommandletGuid = FGuid::NewGuid();
-		BGEOCommandletAddress.Invalidate();
+		FHoudiniBGEOCommandletWorker& Worker = BGEOCommandletWorkers[WorkerIdx];
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			continue;
 
-		// Get the absolute path to the project file, if known, otherwise get
-		// the project name. For the path: quote it for the command line.
-		IFileManager& FileManager = IFileManager::Get();
-		FString ProjectPathOrName = FApp::GetProjectName();
-		if (FPaths::IsProjectFilePathSet())
+		RequeueBGEOCommandletImports(Worker);
+		if (Worker.ProcHandle.IsValid())
+			FPlatformProcess::CloseProc(Worker.ProcHandle);
+		BGEOCommandletWorkers.RemoveAt(WorkerIdx);
+	}
+
+	// Start the missing commandlets
+	bool bSuccess = true;
+	while (BGEOCommandletWorkers.Num() < NumProcesses)
+	{
+		FHoudiniBGEOCommandletWorker NewWorker;
+		if (!StartBGEOCommandletWorker(NewWorker))
 		{
-			const FString ProjectPath = FPaths::GetProjectFilePath();
-			if (!ProjectPath.IsEmpty())
-			{
-				ProjectPathOrName = FString::Printf(
-                    TEXT("\"%s\""),
-                    *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
-                );
-			}
+			bSuccess = false;
+			break;
 		}
 
-		if (ProjectPathOrName.IsEmpty())
-			return false;
+		BGEOCommandletWorkers.Add(NewWorker);
+	}
 
-		// Get the executable path for the app/editor
-		FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
-		if (!ExePath.IsEmpty())
-			ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+	return bSuccess && BGEOCommandletWorkers.Num() > 0;
+}
 
-		if (ExePath.IsEmpty())
-			return false;
-		
-		const FString CommandLineParameters = FString::Printf(
-			TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
-			*ProjectPathOrName,
-			*BGEOCommandletName,
-			*BGEOCommandletGuid.ToString(),
-			*BGEOCommandletEndpoint->GetAddress().ToString(),
-			FPlatformProcess::GetCurrentProcessId());
-
-		BGEOCommandletProcHandle = FPlatformProcess::CreateProc(
-			*ExePath,
-			*CommandLineParameters,
-			false,
-			true,
-			false,
-			&BGEOCommandletProcessId,
-			0,
-			NULL,
-			NULL);
-		if (!BGEOCommandletProcHandle.IsValid())
+bool FHoudiniPDGManager::StartBGEOCommandletWorker(FHoudiniBGEOCommandletWorker& InWorker)
+{
+	if (!BGEOCommandletEndpoint.IsValid())
+		return false;
+
+	// Start the bgeo commandlet
+	static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
+	InWorker.Guid = FGuid::NewGuid();
+	InWorker.Address.Invalidate();
+	InWorker.bCrashed = false;
+
+	// Get the absolute path to the project file, if known, otherwise get
+	// the project name. For the path: quote it for the command line.
+	IFileManager& FileManager = IFileManager::Get();
+	FString ProjectPathOrName = FApp::GetProjectName();
+	if (FPaths::IsProjectFilePathSet())
+	{
+		const FString ProjectPath = FPaths::GetProjectFilePath();
+		if (!ProjectPath.IsEmpty())
 		{
-			return false;
+			ProjectPathOrName = FString::Printf(
+                TEXT("\"%s\""),
+                *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
+            );
 		}
 	}
 
-	return true;
+	if (ProjectPathOrName.IsEmpty())
+		return false;
+
+	// Get the executable path for the app/editor
+	FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
+	if (!ExePath.IsEmpty())
+		ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+
+	if (ExePath.IsEmpty())
+		return false;
+	
+	const FString CommandLineParameters = FString::Printf(
+		TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
+		*ProjectPathOrName,
+		*BGEOCommandletName,
+		*InWorker.Guid.ToString(),
+		*BGEOCommandletEndpoint->GetAddress().ToString(),
+		FPlatformProcess::GetCurrentProcessId());
+
+	InWorker.ProcHandle = FPlatformProcess::CreateProc(
+		*ExePath,
+		*CommandLineParameters,
+		false,
+		true,
+		false,
+		&InWorker.ProcessId,
+		0,
+		NULL,
+		NULL);
+
+	return InWorker.ProcHandle.IsValid();
 }
 
 void FHoudiniPDGManager::StopBGEOCommandletAndEndpoint()
 {
 	BGEOCommandletEndpoint.Reset();
-	BGEOCommandletAddress.Invalidate();
-	BGEOCommandletGuid.Invalidate();
 
-	if (BGEOCommandletProcHandle.IsValid() && FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		FPlatformProcess::TerminateProc(BGEOCommandletProcHandle, true);
-		if (BGEOCommandletProcHandle.IsValid())
+		// The imports that were not completed will be loaded without the commandlet
+		RequeueBGEOCommandletImports(Worker);
+
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
 		{
-			FPlatformProcess::WaitForProc(BGEOCommandletProcHandle);
-			FPlatformProcess::CloseProc(BGEOCommandletProcHandle);
+			FPlatformProcess::TerminateProc(Worker.ProcHandle, true);
+			if (Worker.ProcHandle.IsValid())
+			{
+				FPlatformProcess::WaitForProc(Worker.ProcHandle);
+				FPlatformProcess::CloseProc(Worker.ProcHandle);
+			}
 		}
 	}
+	BGEOCommandletWorkers.Empty();
 }
 
 EHoudiniBGEOCommandletStatus FHoudiniPDGManager::UpdateAndGetBGEOCommandletStatus()
 {
-	if (BGEOCommandletProcHandle.IsValid())
+	bool bAnyConnected = false;
+	bool bAnyRunning = false;
+	bool bAnyCrashed = false;
+
+	float ImportTimeout = 0.0f;
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (IsValid(HoudiniRuntimeSettings))
+		ImportTimeout = HoudiniRuntimeSettings->PDGAsyncCommandletImportTimeout;
+
+	const double Now = FPlatformTime::Seconds();
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		if (!FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
-		else if (BGEOCommandletAddress.IsValid())
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+		if (!Worker.ProcHandle.IsValid())
+			continue;
+
+		bool bStopped = !Worker.bCrashed && !FPlatformProcess::IsProcRunning(Worker.ProcHandle);
+		if (!Worker.bCrashed && !bStopped && ImportTimeout > 0.0f && Worker.PendingImports.Num() > 0
+			&& Now - Worker.LastActivityTime > ImportTimeout)
+		{
+			// The commandlet is hung: stop it, its imports are failed and sent again below
+			HOUDINI_LOG_WARNING(
+				TEXT("BGEO commandlet %s did not reply for %.0f seconds, stopping it and importing its %d pending work result objects again."),
+				*Worker.Guid.ToString(), Now - Worker.LastActivityTime, Worker.PendingImports.Num());
+			FPlatformProcess::TerminateProc(Worker.ProcHandle, true);
+			bStopped = true;
+		}
+
+		if (bStopped)
+		{
+			// Send its imports to the other commandlets
+			Worker.bCrashed = true;
+			Worker.Address.Invalidate();
+			RequeueBGEOCommandletImports(Worker);
+		}
+
+		if (Worker.bCrashed)
+			bAnyCrashed = true;
+		else if (Worker.Address.IsValid())
+			bAnyConnected = true;
 		else
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+			bAnyRunning = true;
 	}
+
+	if (bAnyConnected)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+	else if (bAnyRunning)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+	else if (bAnyCrashed)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
 	else
 		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 
 	return BGEOCommandletStatus;
 }
 
+FHoudiniBGEOCommandletWorker* FHoudiniPDGManager::FindBGEOCommandletWorkerForImport()
+{
+	FHoudiniBGEOCommandletWorker* LeastBusyWorker = nullptr;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.bCrashed || !Worker.Address.IsValid())
+			continue;
+
+		if (Worker.PendingImports.Num() >= HoudiniBGEOCommandletMaxPendingImports)
+			continue;
+
+		if (!LeastBusyWorker || Worker.PendingImports.Num() < LeastBusyWorker->PendingImports.Num())
+			LeastBusyWorker = &Worker;
+	}
+
+	return LeastBusyWorker;
+}
+
+void FHoudiniPDGManager::RequeueBGEOCommandletImports(FHoudiniBGEOCommandletWorker& InWorker)
+{
+	for (const FHoudiniBGEOCommandletImport& Import : InWorker.PendingImports)
+	{
+		UHoudiniPDGAssetLink* AssetLink = nullptr;
+		UTOPNetwork* TOPNetwork = nullptr;
+		UTOPNode* TOPNode = nullptr;
+		if (!GetTOPAssetLinkNetworkAndNode(Import.TOPNodeId, AssetLink, TOPNetwork, TOPNode) || !IsValid(TOPNode))
+			continue;
+
+		const int32 WorkResultArrayIndex = TOPNode->ArrayIndexOfWorkResultByID(Import.WorkItemId);
+		FTOPWorkResult* WorkResult = WorkResultArrayIndex != INDEX_NONE ? TOPNode->GetWorkResultByArrayIndex(WorkResultArrayIndex) : nullptr;
+		if (!WorkResult)
+			continue;
+
+		FTOPWorkResultObject* WorkResultObject = WorkResult->ResultObjects.FindByPredicate(
+			[&Import](const FTOPWorkResultObject& InWorkResultObject)
+			{
+				return InWorkResultObject.Name == Import.Name;
+			}
+		);
+		if (WorkResultObject && WorkResultObject->State == EPDGWorkResultState::Loading)
+			WorkResultObject->State = EPDGWorkResultState::ToLoad;
+	}
+
+	InWorker.PendingImports.Empty();
+}
 
 bool
 FHoudiniPDGManager::IsPDGAsset(const HAPI_NodeId& InAssetId)
@@ -55,6 +55,39 @@ enum class HOUDINIENGINE_API EHoudiniBGEOCommandletStatus : uint8
 	Crashed
 };
 
+// A work result object sent to a BGEO commandlet for import
+struct HOUDINIENGINE_API FHoudiniBGEOCommandletImport
+{
+	FHoudiniBGEOCommandletImport();
+	FHoudiniBGEOCommandletImport(const int32& InTOPNodeId, const int32& InWorkItemId, const FString& InName);
+
+	bool operator==(const FHoudiniBGEOCommandletImport& InOther) const;
+
+	int32 TOPNodeId;
+	int32 WorkItemId;
+	// Name of the work result object
+	FString Name;
+};
+
+// One of the BGEO commandlet processes used to import work item results
+struct HOUDINIENGINE_API FHoudiniBGEOCommandletWorker
+{
+	FHoudiniBGEOCommandletWorker();
+
+	FProcHandle ProcHandle;
+	uint32 ProcessId;
+	FGuid Guid;
+	// Set when the commandlet replied to the discover message
+	FMessageAddress Address;
+	// Imports sent to the commandlet that haven't received a result yet
+	TArray<FHoudiniBGEOCommandletImport> PendingImports;
+	// Time of the last result received, or of the last import sent while the commandlet was idle.
+	// Used to detect a commandlet that hangs on its pending imports.
+	double LastActivityTime;
+	// The process stopped running
+	bool bCrashed;
+};
+
 struct HOUDINIENGINE_API FHoudiniPDGManager
 {
 
@@ -153,12 +186,14 @@ public:
 		const struct FHoudiniPDGImportBGEOResultMessage& InMessage, 
 		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
 
-	// Create the bgeo commandlet endpoint and start the commandlet (if not already running).
+	// Create the bgeo commandlet endpoint and start the commandlets (if not already running).
+	// The number of commandlets is set by PDGAsyncCommandletImportProcesses in the runtime settings.
 	bool CreateBGEOCommandletAndEndpoint();
 
 	void StopBGEOCommandletAndEndpoint();
 
-	// Updates and returns the BGEO commandlet status
+	// Updates and returns the BGEO commandlet status: Connected if any commandlet is connected, Running if any is
+	// starting, and Crashed if all the commandlets that were started have stopped
 	EHoudiniBGEOCommandletStatus UpdateAndGetBGEOCommandletStatus();
 
 private:
@@ -194,6 +229,15 @@ private:
 
 	void NotifyTOPNodeCookCancelledWorkItem(UHoudiniPDGAssetLink* InPDGAssetLink, UTOPNode* InTOPNode, const int32& InWorkItemID);
 
+	// Starts the process of a BGEO commandlet
+	bool StartBGEOCommandletWorker(FHoudiniBGEOCommandletWorker& InWorker);
+
+	// Returns the connected commandlet with the fewest pending imports, or null if they are all busy
+	FHoudiniBGEOCommandletWorker* FindBGEOCommandletWorkerForImport();
+
+	// Sets the pending imports of a commandlet back to ToLoad, so they can be sent to another one
+	void RequeueBGEOCommandletImports(FHoudiniBGEOCommandletWorker& InWorker);
+
 private:
 
 	TArray<HAPI_StringHandle> PDGContextNames;
@@ -206,10 +250,8 @@ private:
 	int32 MaxNumberOPDGContexts = 200;
 
 	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> BGEOCommandletEndpoint;
-	FMessageAddress BGEOCommandletAddress;
-	FProcHandle BGEOCommandletProcHandle;
-	FGuid BGEOCommandletGuid;
-	uint32 BGEOCommandletProcessId;
+	// The pool of commandlets, imports are dispatched to the least busy one
+	TArray<FHoudiniBGEOCommandletWorker> BGEOCommandletWorkers;
 	// Keep track of the BGEO commandlet status
 	EHoudiniBGEOCommandletStatus BGEOCommandletStatus;
 };
@@ -0,0 +1,151 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPackageNameIndex.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+TMap<FName, TSet<FName>> FHoudiniPackageNameIndex::PackageNamesPerDirectory;
+FDelegateHandle FHoudiniPackageNameIndex::OnAssetAddedHandle;
+FDelegateHandle FHoudiniPackageNameIndex::OnAssetRemovedHandle;
+FDelegateHandle FHoudiniPackageNameIndex::OnAssetRenamedHandle;
+
+bool
+FHoudiniPackageNameIndex::IsPackageNameUsed(const FString& InPackageName)
+{
+	// Packages that only exist in memory
+	if (FindPackage(nullptr, *InPackageName) != nullptr)
+		return true;
+
+	TSet<FName>* DirectoryIndex = FindOrBuildDirectoryIndex(FPackageName::GetLongPackagePath(InPackageName));
+	if (!DirectoryIndex)
+	{
+		// The asset registry is still discovering assets, check the file instead
+		return FPackageName::DoesPackageExist(InPackageName);
+	}
+
+	return DirectoryIndex->Contains(FName(*FPackageName::GetShortName(InPackageName)));
+}
+
+void
+FHoudiniPackageNameIndex::AddPackageName(const FString& InPackageName)
+{
+	// Only indexed directories need to be kept current
+	TSet<FName>* DirectoryIndex = PackageNamesPerDirectory.Find(FName(*FPackageName::GetLongPackagePath(InPackageName)));
+	if (DirectoryIndex)
+		DirectoryIndex->Add(FName(*FPackageName::GetShortName(InPackageName)));
+}
+
+void
+FHoudiniPackageNameIndex::Shutdown()
+{
+	PackageNamesPerDirectory.Empty();
+
+	if (!FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+		return;
+
+	IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+	if (OnAssetAddedHandle.IsValid())
+		AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+	if (OnAssetRemovedHandle.IsValid())
+		AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+	if (OnAssetRenamedHandle.IsValid())
+		AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+
+	OnAssetAddedHandle.Reset();
+	OnAssetRemovedHandle.Reset();
+	OnAssetRenamedHandle.Reset();
+}
+
+TSet<FName>*
+FHoudiniPackageNameIndex::FindOrBuildDirectoryIndex(const FString& InPackagePath)
+{
+	const FName PackagePath(*InPackagePath);
+	TSet<FName>* DirectoryIndex = PackageNamesPerDirectory.Find(PackagePath);
+	if (DirectoryIndex)
+		return DirectoryIndex;
+
+	IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+	if (AssetRegistry.IsLoadingAssets())
+		return nullptr;
+
+	BindAssetRegistryEvents();
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPackageNameIndex::FindOrBuildDirectoryIndex);
+
+	// Index the packages on disk (and the ones in memory the registry knows about)
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByPath(PackagePath, Assets, false, true);
+
+	DirectoryIndex = &PackageNamesPerDirectory.Add(PackagePath);
+	DirectoryIndex->Reserve(Assets.Num());
+	for (const FAssetData& Asset : Assets)
+		DirectoryIndex->Add(FName(*FPackageName::GetShortName(Asset.PackageName)));
+
+	return DirectoryIndex;
+}
+
+void
+FHoudiniPackageNameIndex::BindAssetRegistryEvents()
+{
+	if (OnAssetAddedHandle.IsValid())
+		return;
+
+	IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&FHoudiniPackageNameIndex::OnAssetAdded);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FHoudiniPackageNameIndex::OnAssetRemoved);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FHoudiniPackageNameIndex::OnAssetRenamed);
+}
+
+void
+FHoudiniPackageNameIndex::OnAssetAdded(const FAssetData& InAssetData)
+{
+	TSet<FName>* DirectoryIndex = PackageNamesPerDirectory.Find(InAssetData.PackagePath);
+	if (DirectoryIndex)
+		DirectoryIndex->Add(FName(*FPackageName::GetShortName(InAssetData.PackageName)));
+}
+
+void
+FHoudiniPackageNameIndex::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	// The package could hold other assets, only forget it if it doesn't exist anymore.
+	// A package that is still in memory is found by IsPackageNameUsed() anyway.
+	TSet<FName>* DirectoryIndex = PackageNamesPerDirectory.Find(InAssetData.PackagePath);
+	if (DirectoryIndex && !FPackageName::DoesPackageExist(InAssetData.PackageName.ToString()))
+		DirectoryIndex->Remove(FName(*FPackageName::GetShortName(InAssetData.PackageName)));
+}
+
+void
+FHoudiniPackageNameIndex::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	// The old package is left in the index: the name stays unavailable until the directory is re-indexed,
+	// which is safe as it only means that another name is picked.
+	OnAssetAdded(InAssetData);
+}
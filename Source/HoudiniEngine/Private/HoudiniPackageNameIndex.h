@@ -0,0 +1,71 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+
+/**
+ * Index of the package names used in the directories we create packages in.
+ * Each directory is indexed once from the asset registry, and then kept current with the packages we create and the
+ * registry's asset events, so checking if a package name is free doesn't need to load the package from disk.
+ */
+struct HOUDINIENGINE_API FHoudiniPackageNameIndex
+{
+	public:
+
+		// Returns true if a package with this (sanitized, long) name exists in memory or on disk
+		static bool IsPackageNameUsed(const FString& InPackageName);
+
+		// Records a package that has just been created
+		static void AddPackageName(const FString& InPackageName);
+
+		// Forgets all the indexed directories and unbinds from the asset registry
+		static void Shutdown();
+
+	protected:
+
+		// Returns the index of a package's directory, building it if needed.
+		// Returns null if the asset registry can't be used yet.
+		static TSet<FName>* FindOrBuildDirectoryIndex(const FString& InPackagePath);
+
+		static void BindAssetRegistryEvents();
+
+		static void OnAssetAdded(const FAssetData& InAssetData);
+		static void OnAssetRemoved(const FAssetData& InAssetData);
+		static void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+
+	protected:
+
+		// Package names (without path) per indexed directory
+		static TMap<FName, TSet<FName>> PackageNamesPerDirectory;
+
+		static FDelegateHandle OnAssetAddedHandle;
+		static FDelegateHandle OnAssetRemovedHandle;
+		static FDelegateHandle OnAssetRenamedHandle;
+};
@@ -29,6 +29,7 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniPackageNameIndex.h"
 #include "HoudiniStaticMesh.h"
 #include "HoudiniStringResolver.h"
 
@@ -314,14 +315,8 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		// If we are set to create new assets, check if a package named similarly already exists
 		if (ReplaceMode == EPackageReplaceMode::CreateNewAssets)
 		{
-			UPackage* FoundPackage = FindPackage(nullptr, *FinalPackageName);
-			if (FoundPackage == nullptr)
-			{
-				// Package might not be in memory, check if it exists on disk
-				FoundPackage = LoadPackage(nullptr, *FinalPackageName, LOAD_Verify | LOAD_NoWarn);
-			}
-			
-			if (IsValid(FoundPackage))
+			// Look the name up in memory and in the directory's name index, rather than loading the package from disk
+			if (FHoudiniPackageNameIndex::IsPackageNameUsed(FinalPackageName))
 			{
 				// we need to generate a new name for it
 				CurrentGuid = FGuid::NewGuid();
@@ -334,6 +329,8 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		NewPackage = CreatePackage(*FinalPackageName);
 		if (IsValid(NewPackage))
 		{
+			FHoudiniPackageNameIndex::AddPackageName(FinalPackageName);
+
 			// Record bake counter / temp GUID in package metadata
 			UMetaData* MetaData = NewPackage->GetMetaData();
 			if (IsValid(MetaData))
@@ -0,0 +1,478 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniSessionStarter.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+#include "HAPI/HAPI_Version.h"
+
+#include "Async/Async.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+// Number of ports, after the session's port, that the standby sessions cycle through
+static const int32 HoudiniStandbyServerPortCount = 16;
+
+// HAPI's connection error is shared by all the sessions being created, this serializes the
+// session creations so each one reads back its own error, whichever thread it runs on.
+static FCriticalSection HoudiniConnectionErrorLock;
+
+FHoudiniSessionStartOptions::FHoudiniSessionStartOptions()
+	: SessionType(EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe)
+	, bStartAutomaticServer(true)
+	, AutomaticServerTimeout(HAPI_UNREAL_SESSION_SERVER_TIMEOUT)
+	, ServerPipeName(HAPI_UNREAL_SESSION_SERVER_PIPENAME)
+	, ServerPort(HAPI_UNREAL_SESSION_SERVER_PORT)
+	, ServerHost(HAPI_UNREAL_SESSION_SERVER_HOST)
+	, bIsStandby(false)
+	, CookingThreadStackSize(-1)
+{
+}
+
+FHoudiniSessionStartOptions
+FHoudiniSessionStartOptions::FromSettings(const UHoudiniRuntimeSettings* InSettings)
+{
+	FHoudiniSessionStartOptions Options;
+	if (!InSettings)
+		return Options;
+
+	Options.SessionType = InSettings->SessionType;
+	Options.bStartAutomaticServer = InSettings->bStartAutomaticServer;
+	Options.AutomaticServerTimeout = InSettings->AutomaticServerTimeout;
+	Options.ServerPipeName = InSettings->ServerPipeName;
+	Options.ServerPort = InSettings->ServerPort;
+	Options.ServerHost = InSettings->ServerHost;
+
+	Options.CookingThreadStackSize = InSettings->CookingThreadStackSize;
+	Options.HoudiniEnvironmentFiles = InSettings->HoudiniEnvironmentFiles;
+	Options.OtlSearchPath = InSettings->OtlSearchPath;
+	Options.DsoSearchPath = InSettings->DsoSearchPath;
+	Options.ImageDsoSearchPath = InSettings->ImageDsoSearchPath;
+	Options.AudioDsoSearchPath = InSettings->AudioDsoSearchPath;
+
+	return Options;
+}
+
+FHoudiniSessionStartOptions
+FHoudiniSessionStartOptions::MakeStandbyOptions(const int32& InStandbyIndex) const
+{
+	// Use a different pipe/port for each standby so we never connect to the server used by the current session,
+	// which may itself be a previous standby. The pipe name also includes the process id for concurrent editors.
+	const int32 StandbyIndex = FMath::Max(0, InStandbyIndex);
+	FHoudiniSessionStartOptions StandbyOptions = *this;
+	StandbyOptions.bIsStandby = true;
+	StandbyOptions.bStartAutomaticServer = true;
+	StandbyOptions.ServerPipeName = FString::Printf(
+		TEXT("%s_standby_%u_%d"), *ServerPipeName, FPlatformProcess::GetCurrentProcessId(), StandbyIndex);
+	StandbyOptions.ServerPort = ServerPort + 1 + (StandbyIndex % HoudiniStandbyServerPortCount);
+
+	return StandbyOptions;
+}
+
+bool
+FHoudiniSessionStartOptions::SupportsBackgroundStart() const
+{
+	return SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_Socket
+		|| SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe;
+}
+
+FHoudiniSessionStarter::FHoudiniSessionStarter()
+	: State(EHoudiniSessionStartState::Idle)
+	, bSessionSync(false)
+	, LicenseType(HAPI_LICENSE_NONE)
+	, StartTime(0.0)
+	, EndTime(0.0)
+{
+	Session.type = HAPI_SESSION_MAX;
+	Session.id = -1;
+}
+
+FHoudiniSessionStarter::~FHoudiniSessionStarter()
+{
+	Reset();
+}
+
+bool
+FHoudiniSessionStarter::Start(const FHoudiniSessionStartOptions& InOptions)
+{
+	if (State != EHoudiniSessionStartState::Idle)
+		return false;
+
+	if (!InOptions.SupportsBackgroundStart())
+	{
+		HOUDINI_LOG_ERROR(TEXT("Only socket and named pipe Houdini Engine sessions can be started in the background."));
+		return false;
+	}
+
+	Options = InOptions;
+	Session.type = HAPI_SESSION_MAX;
+	Session.id = -1;
+	bSessionSync = false;
+	LicenseType = HAPI_LICENSE_NONE;
+	Error.Empty();
+	StartTime = FPlatformTime::Seconds();
+	EndTime = 0.0;
+
+	State = EHoudiniSessionStartState::Starting;
+	Task = Async(EAsyncExecution::Thread, [this]() { Run(); });
+
+	return true;
+}
+
+void
+FHoudiniSessionStarter::Run()
+{
+	HAPI_Result SessionResult = CreateSession(Options, &Session, bSessionSync, &Error);
+	if (SessionResult != HAPI_RESULT_SUCCESS)
+	{
+		if (Error.IsEmpty())
+			Error = FString::Printf(TEXT("Failed to connect to the server (%s)"), *FHoudiniEngineUtils::GetErrorDescription(SessionResult));
+
+		Session.type = HAPI_SESSION_MAX;
+		Session.id = -1;
+		EndTime = FPlatformTime::Seconds();
+		State = EHoudiniSessionStartState::Failed;
+		return;
+	}
+
+	if (!InitializeSession(Options, &Session, Error))
+	{
+		CloseSession();
+		EndTime = FPlatformTime::Seconds();
+		State = EHoudiniSessionStartState::Failed;
+		return;
+	}
+
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetSessionEnvInt(&Session, HAPI_SESSIONENVINT_LICENSE, (int32 *)&LicenseType))
+		LicenseType = HAPI_LICENSE_NONE;
+
+	EndTime = FPlatformTime::Seconds();
+	State = EHoudiniSessionStartState::Ready;
+}
+
+EHoudiniSessionStartState
+FHoudiniSessionStarter::Wait()
+{
+	if (Task.IsValid())
+		Task.Wait();
+
+	return State;
+}
+
+bool
+FHoudiniSessionStarter::IsReadySessionValid() const
+{
+	if (State != EHoudiniSessionStartState::Ready)
+		return false;
+
+	return HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&Session);
+}
+
+bool
+FHoudiniSessionStarter::TakeSession(HAPI_Session& OutSession, bool& bOutSessionSync, HAPI_License& OutLicenseType)
+{
+	if (State != EHoudiniSessionStartState::Ready)
+		return false;
+
+	// The background thread is done, release the task
+	if (Task.IsValid())
+		Task.Wait();
+	Task = TFuture<void>();
+
+	OutSession = Session;
+	bOutSessionSync = bSessionSync;
+	OutLicenseType = LicenseType;
+
+	Session.type = HAPI_SESSION_MAX;
+	Session.id = -1;
+	State = EHoudiniSessionStartState::Idle;
+
+	return true;
+}
+
+void
+FHoudiniSessionStarter::Reset()
+{
+	if (Task.IsValid())
+		Task.Wait();
+	Task = TFuture<void>();
+
+	if (State == EHoudiniSessionStartState::Ready)
+		CloseSession();
+
+	State = EHoudiniSessionStartState::Idle;
+}
+
+void
+FHoudiniSessionStarter::CloseSession()
+{
+	if (Session.type == HAPI_SESSION_MAX)
+		return;
+
+	if (FHoudiniApi::IsHAPIInitialized() && HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&Session))
+	{
+		FHoudiniApi::Cleanup(&Session);
+		FHoudiniApi::CloseSession(&Session);
+	}
+
+	Session.type = HAPI_SESSION_MAX;
+	Session.id = -1;
+}
+
+double
+FHoudiniSessionStarter::GetStartDuration() const
+{
+	if (State == EHoudiniSessionStartState::Idle)
+		return 0.0;
+
+	if (State == EHoudiniSessionStartState::Starting)
+		return FPlatformTime::Seconds() - StartTime;
+
+	return EndTime - StartTime;
+}
+
+HAPI_Result
+FHoudiniSessionStarter::CreateSession(
+	const FHoudiniSessionStartOptions& InOptions, HAPI_Session* OutSession, bool& bOutSessionSync, FString* OutConnectionError)
+{
+	FScopeLock ScopeLock(&HoudiniConnectionErrorLock);
+
+	HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
+
+	HAPI_ThriftServerOptions ServerOptions;
+	FMemory::Memzero< HAPI_ThriftServerOptions >(ServerOptions);
+	ServerOptions.autoClose = true;
+	ServerOptions.timeoutMs = InOptions.AutomaticServerTimeout;
+
+	// Unless we automatically start the server,
+	// consider we're in SessionSync mode
+	bOutSessionSync = !InOptions.bIsStandby;
+
+	// Clear the connection error before starting a new session
+	if (InOptions.SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_None)
+		FHoudiniApi::ClearConnectionError();
+
+	switch (InOptions.SessionType)
+	{
+		case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
+		{
+			// Try to connect to an existing socket session first
+			if (!InOptions.bIsStandby)
+			{
+				SessionResult = FHoudiniApi::CreateThriftSocketSession(
+					OutSession, TCHAR_TO_UTF8(*InOptions.ServerHost), InOptions.ServerPort);
+			}
+
+			// Start a session and try to connect to it if we failed
+			if (InOptions.bStartAutomaticServer && SessionResult != HAPI_RESULT_SUCCESS)
+			{
+				HAPI_Result ServerResult = FHoudiniApi::StartThriftSocketServer(
+					&ServerOptions, InOptions.ServerPort, nullptr);
+
+				// We've started the server manually, disable session sync
+				bOutSessionSync = false;
+
+				// Standby sessions must not connect to a server they didn't start
+				if (InOptions.bIsStandby && ServerResult != HAPI_RESULT_SUCCESS)
+					SessionResult = ServerResult;
+				else
+					SessionResult = FHoudiniApi::CreateThriftSocketSession(
+						OutSession, TCHAR_TO_UTF8(*InOptions.ServerHost), InOptions.ServerPort);
+			}
+		}
+		break;
+
+		case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
+		{
+			// Try to connect to an existing pipe session first
+			if (!InOptions.bIsStandby)
+			{
+				SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+					OutSession, TCHAR_TO_UTF8(*InOptions.ServerPipeName));
+			}
+
+			// Start a session and try to connect to it if we failed
+			if (InOptions.bStartAutomaticServer && SessionResult != HAPI_RESULT_SUCCESS)
+			{
+				HAPI_Result ServerResult = FHoudiniApi::StartThriftNamedPipeServer(
+					&ServerOptions, TCHAR_TO_UTF8(*InOptions.ServerPipeName), nullptr);
+
+				// We've started the server manually, disable session sync
+				bOutSessionSync = false;
+
+				// Standby sessions must not connect to a server they didn't start
+				if (InOptions.bIsStandby && ServerResult != HAPI_RESULT_SUCCESS)
+					SessionResult = ServerResult;
+				else
+					SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+						OutSession, TCHAR_TO_UTF8(*InOptions.ServerPipeName));
+			}
+		}
+		break;
+
+		case EHoudiniRuntimeSettingsSessionType::HRSST_None:
+			// Disable session sync
+			bOutSessionSync = false;
+			break;
+
+		case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
+			// As of Unreal 4.19, InProcess sessions are not supported anymore
+			SessionResult = FHoudiniApi::CreateInProcessSession(OutSession);
+			// Disable session sync
+			bOutSessionSync = false;
+			break;
+
+		default:
+			HOUDINI_LOG_ERROR(TEXT("Unsupported Houdini Engine session type"));
+			// Disable session sync
+			bOutSessionSync = false;
+			break;
+	}
+
+	if (SessionResult != HAPI_RESULT_SUCCESS)
+	{
+		bOutSessionSync = false;
+
+		if (OutConnectionError && InOptions.SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_None)
+			*OutConnectionError = FHoudiniEngineUtils::GetConnectionError();
+	}
+
+	return SessionResult;
+}
+
+bool
+FHoudiniSessionStarter::InitializeSession(const FHoudiniSessionStartOptions& InOptions, const HAPI_Session* InSession, FString& OutError)
+{
+	// We need to make sure HAPI version is correct.
+	int32 RunningEngineMajor = 0;
+	int32 RunningEngineMinor = 0;
+	int32 RunningEngineApi = 0;
+
+	// Retrieve version numbers for running Houdini Engine.
+	FHoudiniApi::GetEnvInt(HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR, &RunningEngineMajor);
+	FHoudiniApi::GetEnvInt(HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR, &RunningEngineMinor);
+	FHoudiniApi::GetEnvInt(HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API, &RunningEngineApi);
+
+	// Compare defined and running versions.
+	if (RunningEngineMajor != HAPI_VERSION_HOUDINI_ENGINE_MAJOR
+		|| RunningEngineMinor != HAPI_VERSION_HOUDINI_ENGINE_MINOR)
+	{
+		// Major or minor HAPI version differs, stop here
+		HOUDINI_LOG_ERROR(
+			TEXT("Starting up the Houdini Engine module failed: built and running versions do not match."));
+		HOUDINI_LOG_ERROR(
+			TEXT("Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d"),
+			HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
+			RunningEngineMajor, RunningEngineMinor, RunningEngineApi);
+
+		OutError = TEXT("Built and running Houdini Engine versions do not match");
+		return false;
+	}
+	else if (RunningEngineApi != HAPI_VERSION_HOUDINI_ENGINE_API)
+	{
+		// Major/minor HAPIversions match, but only the API version differs,
+		// Allow the user to continue but warn him of possible instabilities
+		HOUDINI_LOG_WARNING(
+			TEXT("Starting up the Houdini Engine module: built and running versions do not match."));
+		HOUDINI_LOG_WARNING(
+			TEXT("Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d"),
+			HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
+			RunningEngineMajor, RunningEngineMinor, RunningEngineApi);
+		HOUDINI_LOG_WARNING(
+			TEXT("This could cause instabilities and crashes when using the Houdini Engine plugin"));
+	}
+
+	// Default CookOptions
+	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+
+	bool bUseCookingThread = true;
+	HAPI_Result Result = FHoudiniApi::Initialize(
+		InSession,
+		&CookOptions,
+		bUseCookingThread,
+		InOptions.CookingThreadStackSize,
+		TCHAR_TO_UTF8(*InOptions.HoudiniEnvironmentFiles),
+		TCHAR_TO_UTF8(*InOptions.OtlSearchPath),
+		TCHAR_TO_UTF8(*InOptions.DsoSearchPath),
+		TCHAR_TO_UTF8(*InOptions.ImageDsoSearchPath),
+		TCHAR_TO_UTF8(*InOptions.AudioDsoSearchPath));
+
+	if (Result == HAPI_RESULT_SUCCESS)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Successfully intialized the Houdini Engine module."));
+	}
+	else if (Result == HAPI_RESULT_ALREADY_INITIALIZED)
+	{
+		// Reused session? just notify the user
+		HOUDINI_LOG_MESSAGE(TEXT("Successfully intialized the Houdini Engine module - HAPI was already initialzed."));
+	}
+	else
+	{
+		OutError = FString::Printf(
+			TEXT("Houdini Engine API initialization failed: %s"),
+			*FHoudiniEngineUtils::GetErrorDescription(Result));
+		HOUDINI_LOG_ERROR(TEXT("%s"), *OutError);
+
+		return false;
+	}
+
+	// Let HAPI know we are running inside UE4
+	FHoudiniApi::SetServerEnvString(InSession, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
+
+	return true;
+}
+
+void
+FHoudiniSessionStarter::PrepareServerEnvironment(const FString& InLibHAPILocation)
+{
+	// Set the HAPI_CLIENT_NAME environment variable to "unreal"
+	// We need to do this before starting HARS.
+	FPlatformMisc::SetEnvironmentVar(TEXT("HAPI_CLIENT_NAME"), TEXT("unreal"));
+
+	// Modify our PATH so that HARC will find HARS.exe
+	const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
+
+	FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
+
+	FString ServerPath =
+#if PLATFORM_MAC
+		// On Mac our binaries are split between two folders
+		InLibHAPILocation + TEXT("/../Resources/bin") + PathDelimiter +
+#endif
+		InLibHAPILocation + PathDelimiter;
+
+	// Don't grow the PATH every time a session is started
+	if (OrigPathVar.StartsWith(ServerPath))
+		return;
+
+	FString ModifiedPath = ServerPath + OrigPathVar;
+	FPlatformMisc::SetEnvironmentVar(TEXT("PATH"), *ModifiedPath);
+}
@@ -0,0 +1,159 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Templates/Atomic.h"
+
+enum class EHoudiniSessionStartState : uint8
+{
+	Idle,		// No session is being started
+	Starting,	// The server is launching and the session is connecting/initializing in the background
+	Ready,		// The session is started and initialized, waiting to be adopted by the engine
+	Failed		// The session could not be started
+};
+
+// Snapshot of the settings used to start and initialize a session, so they can be used off the game thread
+struct HOUDINIENGINE_API FHoudiniSessionStartOptions
+{
+	FHoudiniSessionStartOptions();
+
+	// Reads the options from the runtime settings
+	static FHoudiniSessionStartOptions FromSettings(const UHoudiniRuntimeSettings* InSettings);
+
+	// Options for a standby session: same settings, but always started on its own server.
+	// Each standby index gets its own pipe name and port, so a standby never uses the server of the session it replaces.
+	FHoudiniSessionStartOptions MakeStandbyOptions(const int32& InStandbyIndex) const;
+
+	// Only socket and named pipe sessions can be started in the background or on standby
+	bool SupportsBackgroundStart() const;
+
+	EHoudiniRuntimeSettingsSessionType SessionType;
+	bool bStartAutomaticServer;
+	float AutomaticServerTimeout;
+	FString ServerPipeName;
+	int32 ServerPort;
+	FString ServerHost;
+
+	// Standby sessions always launch a fresh server and never connect to an existing one,
+	// so they can't be Session Sync ones and survive a crash of the current session's server
+	bool bIsStandby;
+
+	// HAPI initialization
+	int32 CookingThreadStackSize;
+	FString HoudiniEnvironmentFiles;
+	FString OtlSearchPath;
+	FString DsoSearchPath;
+	FString ImageDsoSearchPath;
+	FString AudioDsoSearchPath;
+};
+
+/**
+ * Starts and initializes a Houdini Engine session on a background thread.
+ * Launching the automatic server and initializing HAPI can take up to the AutomaticServerTimeout,
+ * the engine polls the state from the game thread and adopts the session once it is ready.
+ * The session is closed if it is never taken.
+ */
+class HOUDINIENGINE_API FHoudiniSessionStarter
+{
+	public:
+
+		FHoudiniSessionStarter();
+		~FHoudiniSessionStarter();
+
+		// Starts creating the session in the background, returns false if a start is already in progress or pending
+		bool Start(const FHoudiniSessionStartOptions& InOptions);
+
+		EHoudiniSessionStartState GetState() const { return State; };
+		bool IsStarting() const { return State == EHoudiniSessionStartState::Starting; };
+		bool IsReady() const { return State == EHoudiniSessionStartState::Ready; };
+
+		// Blocks until the background start is finished, returns the resulting state
+		EHoudiniSessionStartState Wait();
+
+		// Returns true if the session is ready and its server still responds
+		bool IsReadySessionValid() const;
+
+		// Transfers the ready session to the caller, the starter goes back to Idle
+		bool TakeSession(HAPI_Session& OutSession, bool& bOutSessionSync, HAPI_License& OutLicenseType);
+
+		// Waits for the background start, closes the session if it was not taken and goes back to Idle
+		void Reset();
+
+		const FHoudiniSessionStartOptions& GetOptions() const { return Options; };
+
+		// Only valid once the start has failed
+		const FString& GetError() const { return Error; };
+
+		// Time spent starting the session, or since the start if it is still in progress
+		double GetStartDuration() const;
+
+		//-----------------------------------------------------------------------------------------------------------------------------
+		// Blocking helpers, also used by the synchronous session start.
+		// They only touch the given session so they can be called from any thread.
+		//-----------------------------------------------------------------------------------------------------------------------------
+
+		// Connects to an existing server, or launches the automatic server if allowed and connects to it.
+		// Standby sessions skip the existing server and fail if their own server can't be launched.
+		// bOutSessionSync is set to true if we connected to a server we didn't start.
+		// The HAPI connection error is global, so it is read here and returned in OutConnectionError on failure.
+		static HAPI_Result CreateSession(
+			const FHoudiniSessionStartOptions& InOptions, HAPI_Session* OutSession, bool& bOutSessionSync, FString* OutConnectionError = nullptr);
+
+		// Checks the running HAPI version and initializes HAPI for the given session
+		static bool InitializeSession(const FHoudiniSessionStartOptions& InOptions, const HAPI_Session* InSession, FString& OutError);
+
+		// Sets the environment HARS needs, must be called on the game thread before starting a server
+		static void PrepareServerEnvironment(const FString& InLibHAPILocation);
+
+	private:
+
+		// Runs on the background thread
+		void Run();
+
+		// Closes the session if it was started but not taken
+		void CloseSession();
+
+		FHoudiniSessionStartOptions Options;
+
+		TAtomic<EHoudiniSessionStartState> State;
+
+		TFuture<void> Task;
+
+		// Only accessed by the background thread while Starting
+		HAPI_Session Session;
+		bool bSessionSync;
+		HAPI_License LicenseType;
+		FString Error;
+
+		double StartTime;
+		double EndTime;
+};
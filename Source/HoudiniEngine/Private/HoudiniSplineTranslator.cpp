@@ -36,6 +36,7 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniInputNodePool.h"
 #include "Components/SplineComponent.h"
 
 #include "EditorViewportClient.h"
@@ -44,6 +45,13 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HAPI/HAPI.h"
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLegacyCurveFloatUploadThreshold(
+	TEXT("HoudiniEngine.LegacyCurveFloatUploadThreshold"),
+	1000,
+	TEXT("Number of points from which legacy spline inputs are sent to Houdini as float data on an input curve node instead of a curve::1.0 coords string.\n")
+	TEXT("0: Disabled, always use the coords string\n")
+);
+
 void
 FHoudiniSplineTranslator::ExtractStringPositions(const FString& Positions, TArray<FVector>& OutPositions)
 {
@@ -316,6 +324,7 @@ FHoudiniSplineTranslator::UpdateHoudiniCurve(UHoudiniSplineComponent* HoudiniSpl
 				Transform.SetLocation(CurveInputPoints[Idx]);
 				HoudiniSplineComponent->CurvePoints[Idx] = Transform;
 			}
+			HoudiniSplineComponent->MarkCurvePointsChanged();
 		}
 	}
 
@@ -419,6 +428,7 @@ bool FHoudiniSplineTranslator::UpdateHoudiniCurveLegacy(UHoudiniSplineComponent*
 			Transform.SetLocation(CurvePoints[Idx]);
 			HoudiniSplineComponent->CurvePoints[Idx] = Transform;
 		}
+		HoudiniSplineComponent->MarkCurvePointsChanged();
 	}
 
 	// Update the display point on the curve
@@ -601,7 +611,7 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 		CurveNodeId = NodeId;
 
 		// We have now created a valid new input node, delete the previous one
-		if (PreviousInputNodeId >= 0)
+		if (PreviousInputNodeId >= 0 && !FHoudiniInputNodePool::ReleaseNode(PreviousInputNodeId))
 		{
 			// Get the parent OBJ node ID before deleting!
 			HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
@@ -632,15 +642,7 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
         &InputCurveInfo), false);
 
 	TArray<float> CurvePositions;
-	CurvePositions.SetNum(NumberOfCVs * 3);
-
-	for (int32 i = 0; i < Positions->Num(); i++)
-	{
-		CurvePositions[i*3 + 0] = (*Positions)[i].X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		// Swap Y/Z
-		CurvePositions[i*3 + 1] = (*Positions)[i].Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		CurvePositions[i*3 + 2] = (*Positions)[i].Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
+	FHoudiniSplineTranslator::CreatePositionsFloatData(*Positions, CurvePositions);
 
 	TArray<float> CurveRotations;
 	TArray<float> CurveScales;
@@ -650,7 +652,7 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 	
 	if (bAddRotations)
 	{
-		CurveRotations.SetNum(NumberOfCVs * 4);
+		CurveRotations.SetNumUninitialized(NumberOfCVs * 4);
 		for (int32 Idx = 0; Idx < Rotations->Num(); Idx++)
 		{
 			// Get current quaternion
@@ -665,7 +667,7 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 
 	if (bAddScales3d)
 	{
-		CurveScales.SetNum(NumberOfCVs * 3);
+		CurveScales.SetNumUninitialized(NumberOfCVs * 3);
 		for (int32 Idx = 0; Idx < Scales3d->Num(); Idx++)
 		{
 			// Get current scale
@@ -739,7 +741,7 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 		CurveNodeId = NodeId;
 
 		// We have now created a valid new input node, delete the previous one
-		if (PreviousInputNodeId >= 0)
+		if (PreviousInputNodeId >= 0 && !FHoudiniInputNodePool::ReleaseNode(PreviousInputNodeId))
 		{
 			// Get the parent OBJ node ID before deleting!
 			HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
@@ -1440,10 +1442,19 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 	return true;
 }
 
+bool
+FHoudiniSplineTranslator::ShouldUploadLegacyCurveAsFloatData(const int32& InNumPoints)
+{
+	const int32 Threshold = CVarHoudiniEngineLegacyCurveFloatUploadThreshold.GetValueOnAnyThread();
+	return Threshold > 0 && InNumPoints >= Threshold;
+}
+
 void
 FHoudiniSplineTranslator::CreatePositionsString(const TArray<FVector>& InPositions, FString& OutPositionString)
 {
+	// Reserve for the usual "x.xxxxxx, y.yyyyyy, z.zzzzzz " formatting to avoid reallocating on every point
 	OutPositionString = TEXT("");
+	OutPositionString.Reserve(InPositions.Num() * 40);
 	for (int32 Idx = 0; Idx < InPositions.Num(); ++Idx)
 	{
 		FVector Position = InPositions[Idx];	
@@ -1454,6 +1465,20 @@ FHoudiniSplineTranslator::CreatePositionsString(const TArray<FVector>& InPositio
 	}
 }
 
+void
+FHoudiniSplineTranslator::CreatePositionsFloatData(const TArray<FVector>& InPositions, TArray<float>& OutPositions)
+{
+	OutPositions.SetNumUninitialized(InPositions.Num() * 3);
+	for (int32 Idx = 0; Idx < InPositions.Num(); ++Idx)
+	{
+		// Convert to meters and swap Y/Z
+		const FVector& Position = InPositions[Idx];
+		OutPositions[Idx * 3 + 0] = Position.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[Idx * 3 + 1] = Position.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[Idx * 3 + 2] = Position.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+	}
+}
+
 bool
 FHoudiniSplineTranslator::HapiCreateCurveInputNode(HAPI_NodeId& OutCurveNodeId, const FString& InputNodeName, const bool InIsLegacyCurve)
 {
@@ -1486,8 +1511,8 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNode(HAPI_NodeId& OutCurveNodeId,
 	}
 	else
 	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputCurveNode(
-			FHoudiniEngine::Get().GetSession(), &NewNodeId, TCHAR_TO_UTF8(*InputNodeName)), false);
+		if (!FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Curve, InputNodeName, NewNodeId))
+			return false;
 
 		OutCurveNodeId = NewNodeId;
 
@@ -1538,6 +1563,7 @@ FHoudiniSplineTranslator::CreateHoudiniSplineComponentFromHoudiniEditableNode(co
 
 	// Delete the curve points so that UpdateHoudiniCurves initializes them from HAPI
 	HoudiniSplineComponent->CurvePoints.Empty();
+	HoudiniSplineComponent->MarkCurvePointsChanged();
 	HoudiniSplineComponent->DisplayPoints.Empty();
 	UpdateHoudiniCurve(HoudiniSplineComponent);
 
@@ -1760,6 +1786,7 @@ FHoudiniSplineTranslator::UpdateOutputHoudiniSplineComponent(const TArray<FVecto
 		NewPoint.SetLocation(CurvePoints[Idx]);
 		EditedHoudiniSplineComponent->CurvePoints.Add(NewPoint);
 	}
+	EditedHoudiniSplineComponent->MarkCurvePointsChanged();
 
 	return true;
 }
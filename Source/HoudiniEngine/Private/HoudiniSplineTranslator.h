@@ -99,6 +99,10 @@ struct HOUDINIENGINE_API FHoudiniSplineTranslator
 		const FTransform& ParentTransform = FTransform::Identity);
 
 	
+	// Indicates if a legacy curve with that many points should rather be uploaded as float data on an input curve node,
+	// since encoding large curves in the curve::1.0 coords string is slow.
+	static bool ShouldUploadLegacyCurveAsFloatData(const int32& InNumPoints);
+
 	// Create a default curve node.
 	static bool HapiCreateCurveInputNode(
 		HAPI_NodeId& OutCurveNodeId, const FString& InputNodeName, const bool InIsLegacyCurve);
@@ -115,6 +119,7 @@ struct HOUDINIENGINE_API FHoudiniSplineTranslator
 	static void ConvertQuaternionRotationToVectorData(const TArray<float>& InRawData, TArray<TArray<FVector>>& OutVectorData, const TArray<int32>& CurveCounts);
 
 	static void CreatePositionsString(const TArray<FVector>& InPositions, FString& OutPositionString);
+	static void CreatePositionsFloatData(const TArray<FVector>& InPositions, TArray<float>& OutPositions);
 
 	static bool CreateOutputSplinesFromHoudiniGeoPartObject(
 		const FHoudiniGeoPartObject& InHGPO,
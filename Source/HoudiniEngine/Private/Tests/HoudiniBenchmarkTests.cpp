@@ -0,0 +1,1055 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniMockApi.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "../HoudiniEngine.h"
+#include "../HoudiniEnginePrivatePCH.h"
+#include "../HoudiniEngineUtils.h"
+#include "../HoudiniOutputTranslator.h"
+#include "../HoudiniMeshTranslator.h"
+#include "../HoudiniLandscapeTranslator.h"
+#include "../HoudiniInstanceTranslator.h"
+#include "../HoudiniMaterialTranslator.h"
+#include "../HoudiniParameterTranslator.h"
+#include "../HoudiniPackageParams.h"
+#include "../HoudiniGeometryCollectionTranslator.h"
+#include "../HoudiniDetailsRefreshCoordinator.h"
+
+#include "HoudiniParameter.h"
+#include "HoudiniParameterFloat.h"
+#include "HoudiniParameterString.h"
+#include "HoudiniPDGAssetLink.h"
+#include "HoudiniStaticMesh.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+// The benchmarks replace the HAPI geometry and parameter functions with a mock while they run,
+// they should not be run while assets are cooking in a live session.
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineBenchmarkRegressionTolerance(
+	TEXT("HoudiniEngine.BenchmarkRegressionTolerance"),
+	0.25f,
+	TEXT("Relative slowdown allowed before a Houdini Engine benchmark is reported as a regression.\n")
+	TEXT("0.25: a run can be up to 25% slower than its baseline (default)\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineBenchmarkUpdateBaselines(
+	TEXT("HoudiniEngine.BenchmarkUpdateBaselines"),
+	0,
+	TEXT("Stores the timings of the Houdini Engine benchmarks as the new baselines.\n")
+	TEXT("0: Only compare the timings to the stored baselines (default)\n")
+	TEXT("1: Replace the stored baselines with the new timings\n")
+);
+
+static const TCHAR* HoudiniBenchmarkBaselineSection = TEXT("Baselines");
+
+static FString
+HoudiniBenchmarkGetBaselinesFile()
+{
+	return FPaths::Combine(FPaths::AutomationDir(), TEXT("HoudiniEngine"), TEXT("BenchmarkBaselines.ini"));
+}
+
+// Times a benchmark, keeping the best of a few runs to reduce the noise on build machines
+static bool
+HoudiniBenchmarkRun(TFunctionRef<bool()> InBenchmark, const int32& InRuns, double& OutSeconds)
+{
+	OutSeconds = MAX_dbl;
+	for (int32 Run = 0; Run < InRuns; Run++)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		if (!InBenchmark())
+			return false;
+
+		OutSeconds = FMath::Min(OutSeconds, FPlatformTime::Seconds() - StartTime);
+	}
+
+	return true;
+}
+
+// Compares a timing to its stored baseline, and updates the baseline if it is missing or requested
+static bool
+HoudiniBenchmarkCheckBaseline(FAutomationTestBase& InTest, const FString& InName, const double& InSeconds)
+{
+	const FString BaselinesFile = HoudiniBenchmarkGetBaselinesFile();
+	FConfigFile Baselines;
+	Baselines.Read(BaselinesFile);
+
+	const FString Platform = FString(FPlatformProperties::IniPlatformName());
+	const FString Key = Platform + TEXT(".") + InName;
+
+	bool bSuccess = true;
+	bool bStoreTiming = CVarHoudiniEngineBenchmarkUpdateBaselines.GetValueOnAnyThread() != 0;
+
+	FString BaselineString;
+	if (!Baselines.GetString(HoudiniBenchmarkBaselineSection, *Key, BaselineString))
+	{
+		InTest.AddInfo(FString::Printf(TEXT("%s: %.2fms, no baseline found, storing it in %s."), *InName, InSeconds * 1000.0, *BaselinesFile));
+		bStoreTiming = true;
+	}
+	else
+	{
+		const double Baseline = FCString::Atod(*BaselineString);
+		const double Tolerance = FMath::Max(0.0f, CVarHoudiniEngineBenchmarkRegressionTolerance.GetValueOnAnyThread());
+		const double Ratio = Baseline > 0.0 ? InSeconds / Baseline : 1.0;
+		if (Ratio > 1.0 + Tolerance)
+		{
+			InTest.AddError(FString::Printf(TEXT("%s: %.2fms, regressed by %.0f%% compared to its baseline (%.2fms)."),
+				*InName, InSeconds * 1000.0, (Ratio - 1.0) * 100.0, Baseline * 1000.0));
+			bSuccess = false;
+		}
+		else
+		{
+			InTest.AddInfo(FString::Printf(TEXT("%s: %.2fms, baseline %.2fms (%+.0f%%)."),
+				*InName, InSeconds * 1000.0, Baseline * 1000.0, (Ratio - 1.0) * 100.0));
+		}
+	}
+
+	if (bStoreTiming)
+	{
+		Baselines.SetString(HoudiniBenchmarkBaselineSection, *Key, *FString::Printf(TEXT("%f"), InSeconds));
+		Baselines.Write(BaselinesFile);
+	}
+
+	return bSuccess;
+}
+
+static FHoudiniPackageParams
+HoudiniBenchmarkGetPackageParams(const FString& InObjectName)
+{
+	FHoudiniPackageParams PackageParams;
+	PackageParams.PackageMode = EPackageMode::CookToTemp;
+	PackageParams.ReplaceMode = EPackageReplaceMode::ReplaceExistingAssets;
+	PackageParams.TempCookFolder = TEXT("/Game/HoudiniEngine/Temp/Benchmarks");
+	PackageParams.HoudiniAssetName = TEXT("Benchmark");
+	PackageParams.ObjectName = InObjectName;
+	PackageParams.ComponentGUID = FGuid::NewGuid();
+	return PackageParams;
+}
+
+// Fills a HGPO from a mock part, like the output translator does after a cook
+static FHoudiniGeoPartObject
+HoudiniBenchmarkGetHGPO(FHoudiniMockApi& InMock, const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const EHoudiniPartType& InType)
+{
+	FHoudiniGeoPartObject HGPO;
+	HGPO.AssetId = InGeoId;
+	HGPO.ObjectId = InGeoId;
+	HGPO.GeoId = InGeoId;
+	HGPO.PartId = InPartId;
+	HGPO.Type = InType;
+	HGPO.bHasGeoChanged = true;
+	HGPO.bHasPartChanged = true;
+
+	FHoudiniMockPart* Part = InMock.FindPart(InGeoId, InPartId);
+	if (Part)
+	{
+		HGPO.PartName = *InMock.FindString(Part->Info.nameSH);
+		FHoudiniOutputTranslator::CachePartInfo(Part->Info, HGPO.PartInfo);
+		if (InType == EHoudiniPartType::Volume)
+			FHoudiniOutputTranslator::CacheVolumeInfo(Part->VolumeInfo, HGPO.VolumeInfo);
+	}
+
+	return HGPO;
+}
+
+// A triangulated grid with point normals, colors and vertex uvs
+static FHoudiniMockPart&
+HoudiniBenchmarkAddGridMesh(FHoudiniMockApi& InMock, const HAPI_NodeId& InGeoId, const int32& InResolution)
+{
+	FHoudiniMockPart& Part = InMock.AddPart(InGeoId, 0, TEXT("grid"), HAPI_PARTTYPE_MESH);
+
+	const int32 RowSize = InResolution + 1;
+	const int32 NumPoints = RowSize * RowSize;
+	TArray<float> Positions;
+	TArray<float> Normals;
+	TArray<float> Colors;
+	Positions.SetNumUninitialized(NumPoints * 3);
+	Normals.SetNumUninitialized(NumPoints * 3);
+	Colors.SetNumUninitialized(NumPoints * 3);
+	for (int32 Y = 0; Y < RowSize; Y++)
+	{
+		for (int32 X = 0; X < RowSize; X++)
+		{
+			const int32 Idx = (Y * RowSize + X) * 3;
+			Positions[Idx + 0] = X * 0.1f;
+			Positions[Idx + 1] = FMath::Sin(X * 0.05f) * FMath::Cos(Y * 0.05f);
+			Positions[Idx + 2] = Y * 0.1f;
+
+			Normals[Idx + 0] = 0.0f;
+			Normals[Idx + 1] = 1.0f;
+			Normals[Idx + 2] = 0.0f;
+
+			Colors[Idx + 0] = (float)X / RowSize;
+			Colors[Idx + 1] = (float)Y / RowSize;
+			Colors[Idx + 2] = 0.5f;
+		}
+	}
+
+	const int32 NumTriangles = InResolution * InResolution * 2;
+	Part.FaceCounts.Init(3, NumTriangles);
+	Part.VertexList.SetNumUninitialized(NumTriangles * 3);
+	TArray<float> UVs;
+	UVs.SetNumUninitialized(NumTriangles * 3 * 3);
+	int32 VertexIdx = 0;
+	for (int32 Y = 0; Y < InResolution; Y++)
+	{
+		for (int32 X = 0; X < InResolution; X++)
+		{
+			const int32 Corners[4] = { Y * RowSize + X, Y * RowSize + X + 1, (Y + 1) * RowSize + X, (Y + 1) * RowSize + X + 1 };
+			const int32 Triangles[6] = { Corners[0], Corners[2], Corners[1], Corners[1], Corners[2], Corners[3] };
+			for (const int32& PointIdx : Triangles)
+			{
+				Part.VertexList[VertexIdx] = PointIdx;
+				UVs[VertexIdx * 3 + 0] = (float)(PointIdx % RowSize) / InResolution;
+				UVs[VertexIdx * 3 + 1] = (float)(PointIdx / RowSize) / InResolution;
+				UVs[VertexIdx * 3 + 2] = 0.0f;
+				VertexIdx++;
+			}
+		}
+	}
+
+	InMock.AddFloatAttribute(Part, TEXT(HAPI_UNREAL_ATTRIB_POSITION), HAPI_ATTROWNER_POINT, 3, Positions);
+	InMock.AddFloatAttribute(Part, TEXT(HAPI_UNREAL_ATTRIB_NORMAL), HAPI_ATTROWNER_POINT, 3, Normals);
+	InMock.AddFloatAttribute(Part, TEXT(HAPI_UNREAL_ATTRIB_COLOR), HAPI_ATTROWNER_POINT, 3, Colors);
+	InMock.AddFloatAttribute(Part, TEXT(HAPI_UNREAL_ATTRIB_UV), HAPI_ATTROWNER_VERTEX, 3, UVs);
+	InMock.FinalizePart(Part);
+
+	return Part;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreMockApiPlayback, "Houdini.Core.MockApi.Playback", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreMockApiPlayback::RunTest(const FString & Parameters)
+{
+	// Build a small part, and round trip it through a recording file
+	FHoudiniMockApi SourceMock;
+	const HAPI_NodeId GeoId = 1;
+	FHoudiniMockPart& SourcePart = HoudiniBenchmarkAddGridMesh(SourceMock, GeoId, 4);
+
+	TArray<FString> Names;
+	for (int32 Idx = 0; Idx < SourcePart.FaceCounts.Num(); Idx++)
+		Names.Add(FString::Printf(TEXT("prim_%d"), Idx % 3));
+	SourceMock.AddStringAttribute(SourcePart, TEXT("unreal_output_name"), HAPI_ATTROWNER_PRIM, Names);
+
+	TArray<int32> Membership;
+	for (int32 Idx = 0; Idx < SourcePart.FaceCounts.Num(); Idx++)
+		Membership.Add(Idx % 2);
+	SourceMock.AddGroup(GeoId, 0, HAPI_GROUPTYPE_PRIM, TEXT("collision_geo"), Membership);
+	SourceMock.FinalizePart(SourcePart);
+
+	const FString RecordingFile = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("HoudiniEngine"), TEXT("MockApiPlayback.hmock"));
+	TestTrue(TEXT("Saved the recording"), SourceMock.SaveToFile(RecordingFile));
+
+	FHoudiniMockApi Mock;
+	if (!TestTrue(TEXT("Loaded the recording"), Mock.LoadFromFile(RecordingFile)))
+		return false;
+
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	// Read the data back through the same helpers the translators use
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	TArray<float> Positions;
+	TestTrue(TEXT("Read P"), FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+		GeoId, 0, HAPI_UNREAL_ATTRIB_POSITION, AttributeInfo, Positions, 3, HAPI_ATTROWNER_POINT));
+	TestTrue(TEXT("P values"), Positions == SourcePart.Attributes[HAPI_ATTROWNER_POINT].FindChecked(TEXT(HAPI_UNREAL_ATTRIB_POSITION)).FloatData);
+
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	TArray<FString> ReadNames;
+	TestTrue(TEXT("Read the string attribute"), FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+		GeoId, 0, "unreal_output_name", AttributeInfo, ReadNames, 1, HAPI_ATTROWNER_PRIM));
+	TestTrue(TEXT("String values"), ReadNames == Names);
+
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	TArray<float> Missing;
+	TestFalse(TEXT("Missing attributes are not found"), FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+		GeoId, 0, "missing", AttributeInfo, Missing, 1, HAPI_ATTROWNER_POINT));
+
+	TArray<FString> GroupNames;
+	TestTrue(TEXT("Read the group names"), FHoudiniEngineUtils::HapiGetGroupNames(GeoId, 0, HAPI_GROUPTYPE_PRIM, false, GroupNames));
+	TestEqual(TEXT("Group names"), GroupNames.Num(), 1);
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	TestTrue(TEXT("Read the part info"), HAPI_RESULT_SUCCESS == FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), GeoId, 0, &PartInfo));
+	TestEqual(TEXT("Face count"), PartInfo.faceCount, SourcePart.FaceCounts.Num());
+	TestEqual(TEXT("Prim attribute count"), PartInfo.attributeCounts[HAPI_ATTROWNER_PRIM], 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreMeshBenchmark, "Houdini.Core.Benchmark.Mesh", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreMeshBenchmark::RunTest(const FString & Parameters)
+{
+	FHoudiniMockApi Mock;
+	const HAPI_NodeId GeoId = 1;
+	const int32 Resolution = 500;
+	HoudiniBenchmarkAddGridMesh(Mock, GeoId, Resolution);
+	const FHoudiniGeoPartObject HGPO = HoudiniBenchmarkGetHGPO(Mock, GeoId, 0, EHoudiniPartType::Mesh);
+
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	const FHoudiniStaticMeshGenerationProperties GenerationProperties;
+	const FMeshBuildSettings BuildSettings;
+
+	const TPair<EHoudiniStaticMeshMethod, FString> Methods[] = {
+		TPair<EHoudiniStaticMeshMethod, FString>(EHoudiniStaticMeshMethod::FMeshDescription, TEXT("MeshDescription")),
+		TPair<EHoudiniStaticMeshMethod, FString>(EHoudiniStaticMeshMethod::UHoudiniStaticMesh, TEXT("HoudiniStaticMesh")) };
+
+	bool bSuccess = true;
+	for (const auto& Method : Methods)
+	{
+		const FHoudiniPackageParams PackageParams = HoudiniBenchmarkGetPackageParams(TEXT("BenchmarkMesh_") + Method.Value);
+
+		int32 NumOutputs = 0;
+		double Seconds = 0.0;
+		const bool bRan = HoudiniBenchmarkRun([&]()
+		{
+			TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> InputObjects;
+			TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> OutputObjects;
+			TMap<FString, UMaterialInterface*> AssignmentMaterials;
+			TMap<FString, UMaterialInterface*> ReplacementMaterials;
+			TMap<FString, UMaterialInterface*> AllOutputMaterials;
+			if (!FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
+				HGPO, PackageParams, InputObjects, OutputObjects, AssignmentMaterials, ReplacementMaterials, AllOutputMaterials,
+				nullptr, true, Method.Key, GenerationProperties, BuildSettings))
+				return false;
+
+			NumOutputs = OutputObjects.Num();
+			return true;
+		}, 3, Seconds);
+
+		if (!TestTrue(FString::Printf(TEXT("Created the %s mesh"), *Method.Value), bRan && NumOutputs > 0))
+		{
+			bSuccess = false;
+			continue;
+		}
+
+		bSuccess &= HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("Mesh.%s.%dx%d"), *Method.Value, Resolution, Resolution), Seconds);
+	}
+
+	return bSuccess;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreLandscapeBenchmark, "Houdini.Core.Benchmark.Landscape", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreLandscapeBenchmark::RunTest(const FString & Parameters)
+{
+	FHoudiniMockApi Mock;
+	const HAPI_NodeId GeoId = 1;
+	const int32 Size = 2049;
+
+	TArray<float> Heights;
+	Heights.SetNumUninitialized(Size * Size);
+	for (int32 Y = 0; Y < Size; Y++)
+	{
+		for (int32 X = 0; X < Size; X++)
+			Heights[Y * Size + X] = FMath::Sin(X * 0.01f) * FMath::Cos(Y * 0.013f) * 50.0f + X * 0.01f;
+	}
+
+	HAPI_Transform Transform;
+	FMemory::Memzero(Transform);
+	Transform.rotationQuaternion[3] = 1.0f;
+	Transform.scale[0] = Transform.scale[1] = Size * 0.5f;
+	Transform.scale[2] = 1.0f;
+	Transform.rstOrder = HAPI_SRT;
+
+	FHoudiniMockPart& Part = Mock.AddPart(GeoId, 0, TEXT("height"), HAPI_PARTTYPE_VOLUME);
+	Mock.SetHeightfield(Part, TEXT("height"), Size, Size, Heights, Transform);
+	Mock.FinalizePart(Part);
+
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	const FHoudiniGeoPartObject HGPO = HoudiniBenchmarkGetHGPO(Mock, GeoId, 0, EHoudiniPartType::Volume);
+
+	// Reading the heightfield and converting it to landscape height data.
+	// Creating the landscape actor itself needs a world and is not covered here.
+	int32 NumHeights = 0;
+	double Seconds = 0.0;
+	const bool bRan = HoudiniBenchmarkRun([&]()
+	{
+		TArray<float> FloatValues;
+		float FloatMin = 0.0f;
+		float FloatMax = 0.0f;
+		if (!FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(&HGPO, FloatValues, FloatMin, FloatMax))
+			return false;
+
+		int32 UnrealSizeX = -1;
+		int32 UnrealSizeY = -1;
+		int32 NumSectionsPerComponent = -1;
+		int32 NumQuadsPerSection = -1;
+		if (!FHoudiniLandscapeTranslator::CalcLandscapeSizeFromHeightfieldSize(
+			HGPO.VolumeInfo.XLength, HGPO.VolumeInfo.YLength, UnrealSizeX, UnrealSizeY, NumSectionsPerComponent, NumQuadsPerSection))
+			return false;
+
+		TArray<uint16> IntHeightData;
+		FTransform LandscapeTransform;
+		if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+			FloatValues, HGPO.VolumeInfo, UnrealSizeX, UnrealSizeY, FloatMin, FloatMax, IntHeightData, LandscapeTransform))
+			return false;
+
+		NumHeights = IntHeightData.Num();
+		return true;
+	}, 3, Seconds);
+
+	if (!TestTrue(TEXT("Converted the heightfield"), bRan && NumHeights > 0))
+		return false;
+
+	return HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("Landscape.%dx%d"), Size, Size), Seconds);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreInstancerBenchmark, "Houdini.Core.Benchmark.Instancer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreInstancerBenchmark::RunTest(const FString & Parameters)
+{
+	FHoudiniMockApi Mock;
+	const HAPI_NodeId GeoId = 1;
+	const int32 NumPoints = 200000;
+
+	// A point cloud instancing a few engine meshes through unreal_instance
+	const FString InstancedMeshes[] = {
+		TEXT("/Engine/BasicShapes/Cube.Cube"),
+		TEXT("/Engine/BasicShapes/Sphere.Sphere"),
+		TEXT("/Engine/BasicShapes/Cylinder.Cylinder"),
+		TEXT("/Engine/BasicShapes/Cone.Cone") };
+
+	TArray<float> Positions;
+	TArray<FString> Instances;
+	Positions.SetNumUninitialized(NumPoints * 3);
+	Instances.SetNum(NumPoints);
+	FRandomStream RandomStream(1234);
+	for (int32 Idx = 0; Idx < NumPoints; Idx++)
+	{
+		Positions[Idx * 3 + 0] = RandomStream.FRandRange(-1000.0f, 1000.0f);
+		Positions[Idx * 3 + 1] = RandomStream.FRandRange(0.0f, 100.0f);
+		Positions[Idx * 3 + 2] = RandomStream.FRandRange(-1000.0f, 1000.0f);
+		Instances[Idx] = InstancedMeshes[Idx % UE_ARRAY_COUNT(InstancedMeshes)];
+	}
+
+	FHoudiniMockPart& Part = Mock.AddPart(GeoId, 0, TEXT("points"), HAPI_PARTTYPE_MESH);
+	Mock.AddFloatAttribute(Part, TEXT(HAPI_UNREAL_ATTRIB_POSITION), HAPI_ATTROWNER_POINT, 3, Positions);
+	Mock.AddStringAttribute(Part, TEXT(HAPI_UNREAL_ATTRIB_INSTANCE_OVERRIDE), HAPI_ATTROWNER_POINT, Instances);
+	Mock.FinalizePart(Part);
+
+	FHoudiniGeoPartObject HGPO = HoudiniBenchmarkGetHGPO(Mock, GeoId, 0, EHoudiniPartType::Instancer);
+	HGPO.InstancerType = EHoudiniInstancerType::AttributeInstancer;
+
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	int32 NumInstancedObjects = 0;
+	double Seconds = 0.0;
+	const bool bRan = HoudiniBenchmarkRun([&]()
+	{
+		TArray<UObject*> InstancedObjects;
+		TArray<TArray<FTransform>> InstancedTransforms;
+		TArray<TArray<int32>> InstancedIndices;
+		FString SplitAttributeName;
+		TArray<FString> SplitAttributeValues;
+		TMap<FString, FHoudiniInstancedOutputPerSplitAttributes> PerSplitAttributes;
+		if (!FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
+			HGPO, InstancedObjects, InstancedTransforms, InstancedIndices, SplitAttributeName, SplitAttributeValues, PerSplitAttributes))
+			return false;
+
+		NumInstancedObjects = InstancedObjects.Num();
+		return true;
+	}, 3, Seconds);
+
+	if (!TestTrue(TEXT("Extracted the instances"), bRan && NumInstancedObjects == UE_ARRAY_COUNT(InstancedMeshes)))
+		return false;
+
+	return HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("Instancer.%d"), NumPoints), Seconds);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreMaterialBenchmark, "Houdini.Core.Benchmark.Material", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreMaterialBenchmark::RunTest(const FString & Parameters)
+{
+	FHoudiniMockApi Mock;
+	const HAPI_NodeId GeoId = 1;
+	const int32 Resolution = 200;
+	const int32 NumParameters = 32;
+
+	// Per-face material instances, each with a set of per-face parameters
+	const FString SourceMaterials[] = {
+		TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"),
+		TEXT("/Engine/EngineMaterials/DefaultMaterial.DefaultMaterial"),
+		TEXT("/Engine/EngineMaterials/WorldGridMaterial.WorldGridMaterial") };
+
+	FHoudiniMockPart& Part = HoudiniBenchmarkAddGridMesh(Mock, GeoId, Resolution);
+	const int32 NumFaces = Part.FaceCounts.Num();
+
+	TArray<FString> FaceMaterials;
+	FaceMaterials.SetNum(NumFaces);
+	for (int32 Idx = 0; Idx < NumFaces; Idx++)
+		FaceMaterials[Idx] = SourceMaterials[(Idx / 64) % UE_ARRAY_COUNT(SourceMaterials)];
+	Mock.AddStringAttribute(Part, TEXT(HAPI_UNREAL_ATTRIB_MATERIAL_INSTANCE), HAPI_ATTROWNER_PRIM, FaceMaterials);
+
+	for (int32 ParamIdx = 0; ParamIdx < NumParameters; ParamIdx++)
+	{
+		TArray<float> Values;
+		Values.SetNumUninitialized(NumFaces);
+		for (int32 Idx = 0; Idx < NumFaces; Idx++)
+			Values[Idx] = ParamIdx + Idx * 0.001f;
+
+		Mock.AddFloatAttribute(Part, FString::Printf(TEXT("%sparam%d"), TEXT(HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX), ParamIdx), HAPI_ATTROWNER_PRIM, 1, Values);
+	}
+	Mock.FinalizePart(Part);
+
+	const FHoudiniGeoPartObject HGPO = HoudiniBenchmarkGetHGPO(Mock, GeoId, 0, EHoudiniPartType::Mesh);
+	const FHoudiniPackageParams PackageParams = HoudiniBenchmarkGetPackageParams(TEXT("BenchmarkMaterial"));
+
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	int32 NumMaterials = 0;
+	double Seconds = 0.0;
+	const bool bRan = HoudiniBenchmarkRun([&]()
+	{
+		// Read the per-face overrides, then create/update the instances
+		HAPI_AttributeInfo AttributeInfo;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+		TArray<FString> Materials;
+		if (!FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+			HGPO.GeoId, HGPO.PartId, HAPI_UNREAL_ATTRIB_MATERIAL_INSTANCE, AttributeInfo, Materials, 1, HAPI_ATTROWNER_PRIM))
+			return false;
+
+		TArray<UPackage*> Packages;
+		TMap<FString, UMaterialInterface*> InputMaterials;
+		TMap<FString, UMaterialInterface*> OutputMaterials;
+		if (!FHoudiniMaterialTranslator::SortUniqueFaceMaterialOverridesAndCreateMaterialInstances(
+			Materials, HGPO, PackageParams, Packages, InputMaterials, OutputMaterials, true))
+			return false;
+
+		NumMaterials = OutputMaterials.Num();
+		return true;
+	}, 3, Seconds);
+
+	if (!TestTrue(TEXT("Created the material instances"), bRan && NumMaterials > 0))
+		return false;
+
+	return HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("Material.%dFaces.%dParameters"), NumFaces, NumParameters), Seconds);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreParameterBenchmark, "Houdini.Core.Benchmark.Parameters", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreParameterBenchmark::RunTest(const FString & Parameters)
+{
+	FHoudiniMockApi Mock;
+	const HAPI_NodeId AssetId = 1;
+	const int32 NumFolderLists = 10;
+	const int32 NumFolders = 10;
+	const int32 NumParmsPerFolder = 20;
+
+	// An asset with a deep tabbed interface
+	FHoudiniMockNode& Node = Mock.AddNode(AssetId, TEXT("benchmark_asset"));
+	for (int32 ListIdx = 0; ListIdx < NumFolderLists; ListIdx++)
+	{
+		const HAPI_ParmId ListId = Mock.AddFolderListParm(Node, FString::Printf(TEXT("folderlist%d"), ListIdx));
+		for (int32 FolderIdx = 0; FolderIdx < NumFolders; FolderIdx++)
+		{
+			const HAPI_ParmId FolderId = Mock.AddFolderParm(Node, FString::Printf(TEXT("folder%d_%d"), ListIdx, FolderIdx), ListId);
+			for (int32 ParmIdx = 0; ParmIdx < NumParmsPerFolder; ParmIdx++)
+			{
+				const FString Name = FString::Printf(TEXT("parm%d_%d_%d"), ListIdx, FolderIdx, ParmIdx);
+				switch (ParmIdx % 4)
+				{
+					case 0: Mock.AddFloatParm(Node, Name, { 1.0f, 2.0f, 3.0f }, FolderId); break;
+					case 1: Mock.AddIntParm(Node, Name, { ParmIdx }, FolderId); break;
+					case 2: Mock.AddStringParm(Node, Name, { Name }, FolderId); break;
+					default: Mock.AddToggleParm(Node, Name, ParmIdx % 2 == 0, FolderId); break;
+				}
+			}
+		}
+	}
+
+	const int32 NumParms = Node.Parms.Num();
+
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	int32 NumBuiltParms = 0;
+	double Seconds = 0.0;
+	const bool bRan = HoudiniBenchmarkRun([&]()
+	{
+		TArray<UHoudiniParameter*> CurrentParameters;
+		TArray<UHoudiniParameter*> NewParameters;
+		if (!FHoudiniParameterTranslator::BuildAllParameters(
+			AssetId, GetTransientPackage(), CurrentParameters, NewParameters, true, true, nullptr, FString()))
+			return false;
+
+		NumBuiltParms = NewParameters.Num();
+		return true;
+	}, 3, Seconds);
+
+	if (!TestTrue(TEXT("Built the parameters"), bRan && NumBuiltParms == NumParms))
+		return false;
+
+	return HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("Parameters.%d"), NumParms), Seconds);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreGeometryCollectionBenchmark, "Houdini.Core.Benchmark.GeometryCollection", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreGeometryCollectionBenchmark::RunTest(const FString & Parameters)
+{
+	typedef FHoudiniGeometryCollectionTranslator::FHoudiniGeometryCollectionFragment FFragment;
+
+	// A synthetic fractured asset: many small pieces sharing a mesh, scattered with different transforms
+	FHoudiniMockApi Mock;
+	const HAPI_NodeId GeoId = 1;
+	const int32 Resolution = 10;
+	const int32 NumPieces = 2000;
+	HoudiniBenchmarkAddGridMesh(Mock, GeoId, Resolution);
+	const FHoudiniGeoPartObject HGPO = HoudiniBenchmarkGetHGPO(Mock, GeoId, 0, EHoudiniPartType::Mesh);
+
+	UStaticMesh* PieceMesh = nullptr;
+	{
+		FHoudiniScopedMockApi ScopedMock(Mock);
+		if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+			return false;
+
+		TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> InputObjects;
+		TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> OutputObjects;
+		TMap<FString, UMaterialInterface*> AssignmentMaterials;
+		TMap<FString, UMaterialInterface*> ReplacementMaterials;
+		TMap<FString, UMaterialInterface*> AllOutputMaterials;
+		FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
+			HGPO, HoudiniBenchmarkGetPackageParams(TEXT("BenchmarkGeometryCollectionPiece")), InputObjects, OutputObjects,
+			AssignmentMaterials, ReplacementMaterials, AllOutputMaterials, nullptr, true, EHoudiniStaticMeshMethod::FMeshDescription,
+			FHoudiniStaticMeshGenerationProperties(), FMeshBuildSettings());
+
+		for (const auto& Entry : OutputObjects)
+		{
+			PieceMesh = Cast<UStaticMesh>(Entry.Value.OutputObject);
+			if (PieceMesh)
+				break;
+		}
+	}
+
+	if (!TestTrue(TEXT("Created the piece mesh"), IsValid(PieceMesh) && PieceMesh->GetRenderData() != nullptr))
+		return false;
+
+	const TArray<UMaterialInterface*> Materials = { nullptr };
+	TArray<FTransform> Transforms;
+	Transforms.SetNum(NumPieces);
+	for (int32 Idx = 0; Idx < NumPieces; Idx++)
+		Transforms[Idx] = FTransform(FRotator(Idx * 7.0f, Idx * 13.0f, 0.0f), FVector(Idx % 20, (Idx / 20) % 20, Idx / 400) * 100.0f);
+
+	// Previous behaviour: each piece is converted and appended on its own, reindexing the materials every time
+	int32 NumSerialTransforms = 0;
+	double SerialSeconds = 0.0;
+	const bool bRanSerial = HoudiniBenchmarkRun([&]()
+	{
+		UGeometryCollection* GeometryCollection = NewObject<UGeometryCollection>(GetTransientPackage());
+		for (int32 Idx = 0; Idx < NumPieces; Idx++)
+		{
+			TArray<FFragment> Fragments;
+			Fragments.SetNum(1);
+			if (!FHoudiniGeometryCollectionTranslator::BuildGeometryCollectionFragment(PieceMesh, Materials, Transforms[Idx], Fragments[0]))
+				return false;
+			FHoudiniGeometryCollectionTranslator::AppendGeometryCollectionFragments(Fragments, GeometryCollection, true);
+		}
+
+		NumSerialTransforms = GeometryCollection->GetGeometryCollection()->NumElements(FGeometryCollection::TransformGroup);
+		return true;
+	}, 1, SerialSeconds);
+
+	// Pieces converted in parallel, appended in one operation
+	int32 NumBulkTransforms = 0;
+	double BulkSeconds = 0.0;
+	const bool bRanBulk = HoudiniBenchmarkRun([&]()
+	{
+		UGeometryCollection* GeometryCollection = NewObject<UGeometryCollection>(GetTransientPackage());
+		TArray<FFragment> Fragments;
+		TArray<bool> FragmentBuilt;
+		Fragments.SetNum(NumPieces);
+		FragmentBuilt.SetNumZeroed(NumPieces);
+		ParallelFor(NumPieces, [&](int32 Idx)
+		{
+			FragmentBuilt[Idx] = FHoudiniGeometryCollectionTranslator::BuildGeometryCollectionFragment(PieceMesh, Materials, Transforms[Idx], Fragments[Idx]);
+		});
+
+		if (FragmentBuilt.Contains(false))
+			return false;
+
+		FHoudiniGeometryCollectionTranslator::AppendGeometryCollectionFragments(Fragments, GeometryCollection, true);
+		NumBulkTransforms = GeometryCollection->GetGeometryCollection()->NumElements(FGeometryCollection::TransformGroup);
+		return true;
+	}, 3, BulkSeconds);
+
+	if (!TestTrue(TEXT("Appended the pieces one by one"), bRanSerial && NumSerialTransforms == NumPieces))
+		return false;
+	if (!TestTrue(TEXT("Appended the pieces in bulk"), bRanBulk && NumBulkTransforms == NumPieces))
+		return false;
+
+	AddInfo(FString::Printf(TEXT("%d pieces: one by one %.2fms, bulk %.2fms (x%.1f)"),
+		NumPieces, SerialSeconds * 1000.0, BulkSeconds * 1000.0, BulkSeconds > 0.0 ? SerialSeconds / BulkSeconds : 0.0));
+
+	return HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("GeometryCollection.%dPieces"), NumPieces), BulkSeconds);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCorePDGWorkItemsBenchmark, "Houdini.Core.Benchmark.PDGWorkItems", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCorePDGWorkItemsBenchmark::RunTest(const FString & Parameters)
+{
+	// Replays a synthetic PDG event stream on a TOP node, the way FHoudiniPDGManager handles it:
+	// work items are added, looked up on every state change, some are removed and the node is then
+	// "reloaded" (the IDs are transient) before the work items are relinked with new IDs.
+	const int32 NumWorkItems = 100000;
+	const int32 NumStateEvents = 4;
+
+	// Work item IDs aren't contiguous in a real session
+	TArray<int32> WorkItemIDs;
+	WorkItemIDs.SetNum(NumWorkItems);
+	for (int32 Idx = 0; Idx < NumWorkItems; Idx++)
+		WorkItemIDs[Idx] = 1000 + Idx * 3;
+
+	FRandomStream Random(42);
+	TArray<int32> EventOrder;
+	EventOrder.SetNum(NumWorkItems * NumStateEvents);
+	for (int32 Idx = 0; Idx < EventOrder.Num(); Idx++)
+		EventOrder[Idx] = Random.RandHelper(NumWorkItems);
+
+	UTOPNode* TOPNode = NewObject<UTOPNode>(GetTransientPackage());
+	FString Error;
+	double Seconds = 0.0;
+	const bool bRan = HoudiniBenchmarkRun([&]()
+	{
+		TOPNode->EmptyWorkResults();
+
+		// Work items are generated
+		for (int32 Idx = 0; Idx < NumWorkItems; Idx++)
+		{
+			if (TOPNode->ArrayIndexOfWorkResultByID(WorkItemIDs[Idx]) != INDEX_NONE)
+			{
+				Error = FString::Printf(TEXT("Work item %d was found before it was added."), WorkItemIDs[Idx]);
+				return false;
+			}
+
+			const int32 ArrayIndex = TOPNode->AddOrReuseWorkResult(WorkItemIDs[Idx], Idx);
+			if (ArrayIndex != Idx)
+			{
+				Error = FString::Printf(TEXT("Work item %d was added at index %d, expected %d."), WorkItemIDs[Idx], ArrayIndex, Idx);
+				return false;
+			}
+		}
+
+		// State changes (waiting, scheduled, cooking, cooked) look the work items up by ID
+		for (const int32& Idx : EventOrder)
+		{
+			const FTOPWorkResult* Result = TOPNode->GetWorkResultByID(WorkItemIDs[Idx]);
+			if (!Result || Result->WorkItemIndex != Idx)
+			{
+				Error = FString::Printf(TEXT("Work item %d lookup failed."), WorkItemIDs[Idx]);
+				return false;
+			}
+		}
+
+		// Every tenth work item is removed, as the prune pass does
+		for (int32 ArrayIndex = NumWorkItems - 1; ArrayIndex >= 0; ArrayIndex--)
+		{
+			if (TOPNode->WorkResult[ArrayIndex].WorkItemIndex % 10 == 0)
+				TOPNode->RemoveWorkResultAt(ArrayIndex);
+		}
+
+		const int32 NumRemaining = NumWorkItems - (NumWorkItems + 9) / 10;
+		for (int32 Idx = 0; Idx < NumWorkItems; Idx++)
+		{
+			const int32 ArrayIndex = TOPNode->ArrayIndexOfWorkResultByID(WorkItemIDs[Idx]);
+			const int32 ExpectedIndex = Idx % 10 == 0 ? INDEX_NONE : Idx - (Idx / 10) - 1;
+			if (ArrayIndex != ExpectedIndex)
+			{
+				Error = FString::Printf(TEXT("Work item %d is at index %d after the removals, expected %d."), WorkItemIDs[Idx], ArrayIndex, ExpectedIndex);
+				return false;
+			}
+		}
+
+		// Reload: the IDs are lost and the entries are relinked in array order with new IDs
+		for (FTOPWorkResult& Result : TOPNode->WorkResult)
+			Result.WorkItemID = INDEX_NONE;
+		TOPNode->RebuildWorkResultIndex();
+
+		for (int32 Idx = 0; Idx < NumWorkItems; Idx++)
+		{
+			const int32 NewWorkItemID = WorkItemIDs[Idx] + 1;
+			const int32 ArrayIndex = TOPNode->AddOrReuseWorkResult(NewWorkItemID, Idx);
+			if (ArrayIndex != Idx || TOPNode->ArrayIndexOfWorkResultByID(NewWorkItemID) != Idx)
+			{
+				Error = FString::Printf(TEXT("Work item %d was relinked at index %d, expected %d."), NewWorkItemID, ArrayIndex, Idx);
+				return false;
+			}
+		}
+
+		if (TOPNode->WorkResult.Num() != NumWorkItems || TOPNode->ArrayIndexOfFirstInvalidWorkResult() != INDEX_NONE)
+		{
+			Error = FString::Printf(TEXT("%d entries after relinking %d work items (%d were left after the removals)."),
+				TOPNode->WorkResult.Num(), NumWorkItems, NumRemaining);
+			return false;
+		}
+
+		return true;
+	}, 3, Seconds);
+
+	if (!TestTrue(TEXT("Replayed the work item events"), bRan))
+	{
+		AddError(Error);
+		return false;
+	}
+
+	return HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("PDGWorkItems.%d"), NumWorkItems), Seconds);
+}
+
+// Builds a proxy mesh grid with normals, tangents and two UV layers
+static UHoudiniStaticMesh*
+HoudiniBenchmarkCreateProxyMeshGrid(const int32& InResolution)
+{
+	const int32 NumVertices = (InResolution + 1) * (InResolution + 1);
+	const int32 NumTriangles = InResolution * InResolution * 2;
+	const int32 NumUVLayers = 2;
+
+	UHoudiniStaticMesh* Mesh = NewObject<UHoudiniStaticMesh>(GetTransientPackage());
+	Mesh->Initialize(NumVertices, NumTriangles, NumUVLayers, 0, true, true, true, false);
+
+	for (int32 Y = 0; Y <= InResolution; Y++)
+	{
+		for (int32 X = 0; X <= InResolution; X++)
+			Mesh->SetVertexPosition(Y * (InResolution + 1) + X, FVector(X * 10.0f, Y * 10.0f, FMath::Sin(X * 0.1f) * FMath::Cos(Y * 0.1f) * 50.0f));
+	}
+
+	int32 TriangleIndex = 0;
+	for (int32 Y = 0; Y < InResolution; Y++)
+	{
+		for (int32 X = 0; X < InResolution; X++)
+		{
+			const int32 V0 = Y * (InResolution + 1) + X;
+			const int32 V1 = V0 + 1;
+			const int32 V2 = V0 + InResolution + 1;
+			const int32 V3 = V2 + 1;
+			Mesh->SetTriangleVertexIndices(TriangleIndex++, FIntVector(V0, V2, V1));
+			Mesh->SetTriangleVertexIndices(TriangleIndex++, FIntVector(V1, V2, V3));
+		}
+	}
+
+	Mesh->CalculateTangents(true);
+
+	const TArray<FVector>& Positions = Mesh->GetVertexPositions();
+	const TArray<FIntVector>& Triangles = Mesh->GetTriangleIndices();
+	for (int32 Triangle = 0; Triangle < NumTriangles; Triangle++)
+	{
+		for (uint8 Corner = 0; Corner < 3; Corner++)
+		{
+			const FVector& Position = Positions[Triangles[Triangle][Corner]];
+			Mesh->SetTriangleVertexUV(Triangle, Corner, 0, FVector2D(Position.X, Position.Y) / (InResolution * 10.0f));
+			Mesh->SetTriangleVertexUV(Triangle, Corner, 1, FVector2D(Position.Y, Position.X) / (InResolution * 10.0f));
+			Mesh->SetTriangleVertexColor(Triangle, Corner, FColor::White);
+		}
+	}
+
+	Mesh->Optimize();
+	return Mesh;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreProxyMeshPackingBenchmark, "Houdini.Core.Benchmark.ProxyMeshPacking", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreProxyMeshPackingBenchmark::RunTest(const FString & Parameters)
+{
+	// Compares the memory, package size and load time of a large proxy mesh with full precision and packed vertex data
+	const int32 Resolution = 512;
+
+	struct FProxyMeshStats
+	{
+		SIZE_T MemoryBytes = 0;
+		int32 SerializedBytes = 0;
+		double LoadSeconds = 0.0;
+	};
+
+	auto MeasureProxyMesh = [&](UHoudiniStaticMesh* InMesh, FProxyMeshStats& OutStats)
+	{
+		OutStats.MemoryBytes = InMesh->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		FObjectAndNameAsStringProxyArchive WriterProxy(Writer, false);
+		InMesh->Serialize(WriterProxy);
+		OutStats.SerializedBytes = Bytes.Num();
+
+		UHoudiniStaticMesh* LoadedMesh = nullptr;
+		const bool bLoaded = HoudiniBenchmarkRun([&]()
+		{
+			LoadedMesh = NewObject<UHoudiniStaticMesh>(GetTransientPackage());
+			FMemoryReader Reader(Bytes);
+			FObjectAndNameAsStringProxyArchive ReaderProxy(Reader, false);
+			LoadedMesh->Serialize(ReaderProxy);
+			return !ReaderProxy.IsError();
+		}, 3, OutStats.LoadSeconds);
+
+		return bLoaded && LoadedMesh
+			&& LoadedMesh->HasPackedVertexData() == InMesh->HasPackedVertexData()
+			&& LoadedMesh->IsValid(true)
+			&& LoadedMesh->GetVertexInstancePackedTangentZ() == InMesh->GetVertexInstancePackedTangentZ()
+			&& LoadedMesh->GetVertexInstancePackedUVs().Num() == InMesh->GetVertexInstancePackedUVs().Num();
+	};
+
+	UHoudiniStaticMesh* Mesh = HoudiniBenchmarkCreateProxyMeshGrid(Resolution);
+	if (!TestTrue(TEXT("Created the proxy mesh"), IsValid(Mesh) && Mesh->IsValid()))
+		return false;
+
+	FProxyMeshStats FullStats;
+	if (!TestTrue(TEXT("Saved and loaded the full precision proxy mesh"), MeasureProxyMesh(Mesh, FullStats)))
+		return false;
+
+	// Keep a few vertex instances to check the packing
+	const int32 NumChecked = 1024;
+	TArray<FVector> Normals(Mesh->GetVertexInstanceNormals().GetData(), NumChecked);
+	TArray<FVector2D> UVs(Mesh->GetVertexInstanceUVs().GetData(), NumChecked);
+
+	Mesh->PackVertexData();
+	if (!TestTrue(TEXT("Packed the proxy mesh"), Mesh->HasPackedVertexData() && Mesh->IsValid()))
+		return false;
+
+	for (int32 Idx = 0; Idx < NumChecked; Idx++)
+	{
+		if (!Normals[Idx].Equals(Mesh->GetVertexInstancePackedTangentZ()[Idx].ToFVector(), 1.0f / 64.0f)
+			|| !UVs[Idx].Equals(FVector2D(Mesh->GetVertexInstancePackedUVs()[Idx]), 1.0f / 512.0f))
+		{
+			AddError(FString::Printf(TEXT("Vertex instance %d was not packed correctly."), Idx));
+			return false;
+		}
+	}
+
+	FProxyMeshStats PackedStats;
+	if (!TestTrue(TEXT("Saved and loaded the packed proxy mesh"), MeasureProxyMesh(Mesh, PackedStats)))
+		return false;
+
+	AddInfo(FString::Printf(TEXT("%d triangles, full precision: %.1fMB in memory, %.1fMB serialized, loaded in %.2fms"),
+		Mesh->GetNumTriangles(), FullStats.MemoryBytes / (1024.0 * 1024.0), FullStats.SerializedBytes / (1024.0 * 1024.0), FullStats.LoadSeconds * 1000.0));
+	AddInfo(FString::Printf(TEXT("%d triangles, packed: %.1fMB in memory (%.0f%%), %.1fMB serialized (%.0f%%), loaded in %.2fms (%.0f%%)"),
+		Mesh->GetNumTriangles(),
+		PackedStats.MemoryBytes / (1024.0 * 1024.0), FullStats.MemoryBytes > 0 ? 100.0 * PackedStats.MemoryBytes / FullStats.MemoryBytes : 0.0,
+		PackedStats.SerializedBytes / (1024.0 * 1024.0), FullStats.SerializedBytes > 0 ? 100.0 * PackedStats.SerializedBytes / FullStats.SerializedBytes : 0.0,
+		PackedStats.LoadSeconds * 1000.0, FullStats.LoadSeconds > 0.0 ? 100.0 * PackedStats.LoadSeconds / FullStats.LoadSeconds : 0.0));
+
+	TestTrue(TEXT("The packed proxy mesh uses less memory"), PackedStats.MemoryBytes < FullStats.MemoryBytes);
+	TestTrue(TEXT("The packed proxy mesh is smaller when serialized"), PackedStats.SerializedBytes < FullStats.SerializedBytes);
+
+	return HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("ProxyMeshPacking.Load.%dx%d"), Resolution, Resolution), PackedStats.LoadSeconds);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreDetailsRefreshBenchmark, "Houdini.Core.Benchmark.DetailsRefresh", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreDetailsRefreshBenchmark::RunTest(const FString & Parameters)
+{
+	FHoudiniMockApi Mock;
+	const HAPI_NodeId AssetId = 1;
+	const int32 NumParms = 2000;
+
+	FHoudiniMockNode& Node = Mock.AddNode(AssetId, TEXT("benchmark_asset"));
+	for (int32 ParmIdx = 0; ParmIdx < NumParms; ParmIdx++)
+	{
+		const FString Name = FString::Printf(TEXT("parm%d"), ParmIdx);
+		switch (ParmIdx % 4)
+		{
+			case 0: Mock.AddFloatParm(Node, Name, { 1.0f, 2.0f, 3.0f }); break;
+			case 1: Mock.AddIntParm(Node, Name, { ParmIdx }); break;
+			case 2: Mock.AddStringParm(Node, Name, { Name }); break;
+			default: Mock.AddToggleParm(Node, Name, ParmIdx % 2 == 0); break;
+		}
+	}
+
+	TArray<UHoudiniParameter*> NewParameters;
+	{
+		FHoudiniScopedMockApi ScopedMock(Mock);
+		if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+			return false;
+
+		TArray<UHoudiniParameter*> CurrentParameters;
+		if (!TestTrue(TEXT("Built the parameters"), FHoudiniParameterTranslator::BuildAllParameters(
+			AssetId, GetTransientPackage(), CurrentParameters, NewParameters, true, true, nullptr, FString())))
+			return false;
+	}
+
+	UHoudiniParameterFloat* FloatParm = nullptr;
+	UHoudiniParameterString* StringParm = nullptr;
+	for (UHoudiniParameter* Parm : NewParameters)
+	{
+		if (!FloatParm)
+			FloatParm = Cast<UHoudiniParameterFloat>(Parm);
+		if (!StringParm)
+			StringParm = Cast<UHoudiniParameterString>(Parm);
+	}
+
+	if (!TestTrue(TEXT("Found a float and a string parameter"), FloatParm && StringParm))
+		return false;
+
+	// The numeric widgets read their values every frame, changing them must not require a rebuild
+	FloatParm->SetValueAt(5.0f, 0);
+	const uint32 ModifiedSignature = FHoudiniDetailsRefreshCoordinator::ComputeParametersSignature(NewParameters);
+	FloatParm->SetValueAt(6.0f, 0);
+	TestEqual(TEXT("Changing a float value keeps the signature"), FHoudiniDetailsRefreshCoordinator::ComputeParametersSignature(NewParameters), ModifiedSignature);
+
+	StringParm->SetValueAt(TEXT("modified"), 0);
+	TestNotEqual(TEXT("Changing a string value changes the signature"), FHoudiniDetailsRefreshCoordinator::ComputeParametersSignature(NewParameters), ModifiedSignature);
+
+	const uint32 StringSignature = FHoudiniDetailsRefreshCoordinator::ComputeParametersSignature(NewParameters);
+	FloatParm->SetParameterLabel(TEXT("Modified Label"));
+	TestNotEqual(TEXT("Changing a label changes the signature"), FHoudiniDetailsRefreshCoordinator::ComputeParametersSignature(NewParameters), StringSignature);
+
+	// The signature is computed for every refresh request, it must stay far below the cost of a details rebuild
+	double Seconds = 0.0;
+	const bool bRan = HoudiniBenchmarkRun([&]()
+	{
+		FHoudiniDetailsRefreshCoordinator::ComputeParametersSignature(NewParameters);
+		return true;
+	}, 5, Seconds);
+
+	if (!TestTrue(TEXT("Computed the signature"), bRan))
+		return false;
+
+	return HoudiniBenchmarkCheckBaseline(*this, FString::Printf(TEXT("DetailsRefresh.Signature.%d"), NumParms), Seconds);
+}
+
+#endif
@@ -1,5 +1,30 @@
 ﻿#include "../HoudiniEngine.h"
+#include "../HoudiniEnginePrivatePCH.h"
+#include "../HoudiniAssetLibraryRegistry.h"
+#include "../HoudiniEngineUtils.h"
+#include "../HoudiniSplineTranslator.h"
+#include "../HoudiniMeshTranslator.h"
+#include "../HoudiniSessionStarter.h"
+#include "../HoudiniInputNodePool.h"
+#include "../UnrealLandscapeTranslator.h"
+#include "../UnrealMeshTranslator.h"
+#include "HoudiniMockSessionServer.h"
+#include "HoudiniMockApi.h"
+#include "HoudiniApi.h"
+#include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniGenericAttribute.h"
+#include "HoudiniOutput.h"
+#include "HoudiniSplineComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Landscape.h"
+#include "LandscapeComponent.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PhysicsEngine/AggregateGeom.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -10,4 +35,933 @@ bool HoudiniCoreTest::RunTest(const FString & Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreCurvePositionsBenchmark, "Houdini.Core.Benchmark.CurvePositions", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreCurvePositionsBenchmark::RunTest(const FString & Parameters)
+{
+	// Compare the legacy coords string encoding of a large curve with the float data used by input curve nodes
+	const int32 NumPoints = 50000;
+	TArray<FVector> Positions;
+	Positions.SetNumUninitialized(NumPoints);
+	for (int32 Idx = 0; Idx < NumPoints; Idx++)
+		Positions[Idx] = FVector(Idx * 10.0f, FMath::Sin(Idx * 0.01f) * 500.0f, Idx * 0.5f);
+
+	double StartTime = FPlatformTime::Seconds();
+	FString PositionString;
+	FHoudiniSplineTranslator::CreatePositionsString(Positions, PositionString);
+	const double StringTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	TArray<float> PositionFloats;
+	FHoudiniSplineTranslator::CreatePositionsFloatData(Positions, PositionFloats);
+	const double FloatTime = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%d curve points: coords string %.2fms (%d chars), float data %.2fms (%d floats)"),
+		NumPoints, StringTime * 1000.0, PositionString.Len(), FloatTime * 1000.0, PositionFloats.Num()));
+
+	// Both encodings must describe the same points
+	TArray<FVector> StringPositions;
+	FHoudiniSplineTranslator::ExtractStringPositions(PositionString, StringPositions);
+	TestEqual(TEXT("Number of points in the coords string"), StringPositions.Num(), NumPoints);
+	TestEqual(TEXT("Number of floats"), PositionFloats.Num(), NumPoints * 3);
+	if (StringPositions.Num() != NumPoints || PositionFloats.Num() != NumPoints * 3)
+		return false;
+
+	for (int32 Idx = 0; Idx < NumPoints; Idx++)
+	{
+		const FVector FloatPosition(
+			PositionFloats[Idx * 3 + 0], PositionFloats[Idx * 3 + 2], PositionFloats[Idx * 3 + 1]);
+		if (!StringPositions[Idx].Equals(FloatPosition * HAPI_UNREAL_SCALE_FACTOR_POSITION, 0.1f))
+		{
+			AddError(FString::Printf(TEXT("Point %d differs between the coords string and the float data"), Idx));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreColliderUniquePositions, "Houdini.Core.Colliders.UniquePositions", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreColliderUniquePositions::RunTest(const FString & Parameters)
+{
+	// A split group's vertex list, with shared vertices and out of range indices
+	const int32 NumPoints = 500;
+	TArray<float> PartPositions;
+	PartPositions.SetNumUninitialized(NumPoints * 3);
+	for (int32 Idx = 0; Idx < PartPositions.Num(); Idx++)
+		PartPositions[Idx] = Idx * 0.25f;
+
+	FRandomStream RandomStream(1234);
+	TArray<int32> SplitVertexList;
+	for (int32 Idx = 0; Idx < 3000; Idx++)
+		SplitVertexList.Add(RandomStream.RandRange(-10, NumPoints * 3 + 10));
+
+	// Reference results, using the previous AddUnique() extraction
+	TArray<int32> ExpectedIndices;
+	for (const int32& Index : SplitVertexList)
+	{
+		if (PartPositions.IsValidIndex(Index))
+			ExpectedIndices.AddUnique(Index);
+	}
+
+	TArray<int32> UniqueIndices;
+	TArray<FVector> Positions;
+	FHoudiniMeshTranslator::GetSplitGroupUniquePositions(SplitVertexList, PartPositions, UniqueIndices, Positions);
+
+	TestEqual(TEXT("Unique vertex indices"), UniqueIndices, ExpectedIndices);
+	TestEqual(TEXT("Number of positions"), Positions.Num(), ExpectedIndices.Num());
+	if (Positions.Num() != ExpectedIndices.Num())
+		return false;
+
+	for (int32 Idx = 0; Idx < ExpectedIndices.Num(); Idx++)
+	{
+		const int32 VertexIndex = ExpectedIndices[Idx];
+		FVector Expected = FVector::ZeroVector;
+		if (PartPositions.IsValidIndex(VertexIndex * 3 + 2))
+		{
+			Expected = FVector(
+				PartPositions[VertexIndex * 3 + 0], PartPositions[VertexIndex * 3 + 2], PartPositions[VertexIndex * 3 + 1]) * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		}
+
+		if (!Positions[Idx].Equals(Expected))
+		{
+			AddError(FString::Printf(TEXT("Position %d differs from the reference extraction"), Idx));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreColliderBatch, "Houdini.Core.Colliders.SimpleColliderBatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreColliderBatch::RunTest(const FString & Parameters)
+{
+	// One split group per simple collider type
+	TArray<FString> SplitGroupNames;
+	SplitGroupNames.Add(TEXT("collision_geo_simple_box"));
+	SplitGroupNames.Add(TEXT("collision_geo_simple_sphere"));
+	SplitGroupNames.Add(TEXT("collision_geo_simple_capsule"));
+	SplitGroupNames.Add(TEXT("collision_geo_simple_kdop10X"));
+	SplitGroupNames.Add(TEXT("collision_geo_simple_kdop18"));
+	SplitGroupNames.Add(TEXT("collision_geo_simple_kdop26"));
+
+	FRandomStream RandomStream(5678);
+	TArray<TArray<FVector>> PositionArrays;
+	PositionArrays.SetNum(SplitGroupNames.Num());
+	for (int32 GroupIdx = 0; GroupIdx < SplitGroupNames.Num(); GroupIdx++)
+	{
+		const FVector Offset(GroupIdx * 500.0f, 0.0f, 0.0f);
+		for (int32 Idx = 0; Idx < 2000; Idx++)
+			PositionArrays[GroupIdx].Add(Offset + FVector(RandomStream.FRandRange(-50.0f, 50.0f), RandomStream.FRandRange(-20.0f, 20.0f), RandomStream.FRandRange(-100.0f, 100.0f)));
+	}
+
+	TArray<FKAggregateGeom> BatchAggregates;
+	TArray<int32> BatchColliderCounts;
+	FHoudiniMeshTranslator::GenerateSimpleCollisionsForSplitGroups(SplitGroupNames, PositionArrays, BatchAggregates, BatchColliderCounts);
+
+	TestEqual(TEXT("Number of aggregates"), BatchAggregates.Num(), SplitGroupNames.Num());
+	if (BatchAggregates.Num() != SplitGroupNames.Num() || BatchColliderCounts.Num() != SplitGroupNames.Num())
+		return false;
+
+	// The batch must produce the same colliders as fitting each split group on its own
+	for (int32 GroupIdx = 0; GroupIdx < SplitGroupNames.Num(); GroupIdx++)
+	{
+		FKAggregateGeom Expected;
+		const int32 ExpectedCount = FHoudiniMeshTranslator::GenerateSimpleCollisionForSplitGroup(SplitGroupNames[GroupIdx], PositionArrays[GroupIdx], Expected);
+		const FKAggregateGeom& Actual = BatchAggregates[GroupIdx];
+
+		const FString& Name = SplitGroupNames[GroupIdx];
+		TestEqual(FString::Printf(TEXT("%s: number of colliders"), *Name), BatchColliderCounts[GroupIdx], ExpectedCount);
+		TestEqual(FString::Printf(TEXT("%s: box elems"), *Name), Actual.BoxElems.Num(), Expected.BoxElems.Num());
+		TestEqual(FString::Printf(TEXT("%s: sphere elems"), *Name), Actual.SphereElems.Num(), Expected.SphereElems.Num());
+		TestEqual(FString::Printf(TEXT("%s: sphyl elems"), *Name), Actual.SphylElems.Num(), Expected.SphylElems.Num());
+		TestEqual(FString::Printf(TEXT("%s: convex elems"), *Name), Actual.ConvexElems.Num(), Expected.ConvexElems.Num());
+
+		for (int32 Idx = 0; Idx < FMath::Min(Actual.BoxElems.Num(), Expected.BoxElems.Num()); Idx++)
+		{
+			TestTrue(FString::Printf(TEXT("%s: box center"), *Name), Actual.BoxElems[Idx].Center.Equals(Expected.BoxElems[Idx].Center));
+			TestEqual(FString::Printf(TEXT("%s: box size"), *Name), FVector(Actual.BoxElems[Idx].X, Actual.BoxElems[Idx].Y, Actual.BoxElems[Idx].Z), FVector(Expected.BoxElems[Idx].X, Expected.BoxElems[Idx].Y, Expected.BoxElems[Idx].Z));
+		}
+
+		for (int32 Idx = 0; Idx < FMath::Min(Actual.SphereElems.Num(), Expected.SphereElems.Num()); Idx++)
+		{
+			TestTrue(FString::Printf(TEXT("%s: sphere center"), *Name), Actual.SphereElems[Idx].Center.Equals(Expected.SphereElems[Idx].Center));
+			TestEqual(FString::Printf(TEXT("%s: sphere radius"), *Name), Actual.SphereElems[Idx].Radius, Expected.SphereElems[Idx].Radius);
+		}
+
+		for (int32 Idx = 0; Idx < FMath::Min(Actual.SphylElems.Num(), Expected.SphylElems.Num()); Idx++)
+		{
+			TestTrue(FString::Printf(TEXT("%s: capsule center"), *Name), Actual.SphylElems[Idx].Center.Equals(Expected.SphylElems[Idx].Center));
+			TestEqual(FString::Printf(TEXT("%s: capsule radius"), *Name), Actual.SphylElems[Idx].Radius, Expected.SphylElems[Idx].Radius);
+			TestEqual(FString::Printf(TEXT("%s: capsule length"), *Name), Actual.SphylElems[Idx].Length, Expected.SphylElems[Idx].Length);
+		}
+
+		for (int32 Idx = 0; Idx < FMath::Min(Actual.ConvexElems.Num(), Expected.ConvexElems.Num()); Idx++)
+		{
+			TestEqual(FString::Printf(TEXT("%s: kdop vertices"), *Name), Actual.ConvexElems[Idx].VertexData.Num(), Expected.ConvexElems[Idx].VertexData.Num());
+			TestTrue(FString::Printf(TEXT("%s: kdop bounds"), *Name), Actual.ConvexElems[Idx].ElemBox.Min.Equals(Expected.ConvexElems[Idx].ElemBox.Min) && Actual.ConvexElems[Idx].ElemBox.Max.Equals(Expected.ConvexElems[Idx].ElemBox.Max));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreCachedAssetBounds, "Houdini.Core.Bounds.CachedAssetBounds", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreCachedAssetBounds::RunTest(const FString & Parameters)
+{
+	UHoudiniAssetComponent* HAC = NewObject<UHoudiniAssetComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+	if (!IsValid(HAC))
+		return false;
+
+	// A curve output with a few houdini splines
+	UHoudiniOutput* CurveOutput = NewObject<UHoudiniOutput>(HAC, NAME_None, RF_Transient);
+	FHoudiniGeoPartObject CurveHGPO;
+	CurveHGPO.Type = EHoudiniPartType::Curve;
+	CurveOutput->AddNewHGPO(CurveHGPO);
+	CurveOutput->UpdateOutputType();
+	HAC->GetOutputs().Add(CurveOutput);
+
+	FRandomStream RandomStream(4321);
+	TArray<UHoudiniSplineComponent*> Splines;
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> OutputObjects;
+	for (int32 SplineIdx = 0; SplineIdx < 4; SplineIdx++)
+	{
+		UHoudiniSplineComponent* Spline = NewObject<UHoudiniSplineComponent>(HAC, NAME_None, RF_Transient);
+		Spline->ResetCurvePoints();
+		for (int32 PointIdx = 0; PointIdx < 16; PointIdx++)
+			Spline->AppendPoint(FTransform(RandomStream.GetUnitVector() * RandomStream.FRandRange(0.0f, 1000.0f)));
+
+		FHoudiniOutputObject OutputObject;
+		OutputObject.OutputComponent = Spline;
+		OutputObjects.Add(FHoudiniOutputObjectIdentifier(0, 0, SplineIdx, TEXT("")), OutputObject);
+		Splines.Add(Spline);
+	}
+	CurveOutput->SetOutputObjects(OutputObjects);
+
+	// Descendant static mesh components, one of them attached below another
+	UStaticMeshComponent* ChildSMC = NewObject<UStaticMeshComponent>(HAC, NAME_None, RF_Transient);
+	ChildSMC->SetRelativeLocation(FVector(-2000.0f, 0.0f, 0.0f));
+	ChildSMC->AttachToComponent(HAC, FAttachmentTransformRules::KeepRelativeTransform);
+	UStaticMeshComponent* GrandChildSMC = NewObject<UStaticMeshComponent>(HAC, NAME_None, RF_Transient);
+	GrandChildSMC->SetRelativeLocation(FVector(0.0f, 3000.0f, 0.0f));
+	GrandChildSMC->AttachToComponent(ChildSMC, FAttachmentTransformRules::KeepRelativeTransform);
+
+	auto TestBounds = [this, HAC](const TCHAR* InStep)
+	{
+		const FBox Cached = HAC->GetAssetBounds(nullptr, false);
+		const FBox Expected = HAC->ComputeAssetBounds(nullptr, false);
+		TestTrue(FString::Printf(TEXT("%s: cached bounds match the full recomputation (%s / %s)"), InStep, *Cached.ToString(), *Expected.ToString()),
+			Cached.Min.Equals(Expected.Min) && Cached.Max.Equals(Expected.Max) && Cached.IsValid == Expected.IsValid);
+	};
+
+	TestBounds(TEXT("Initial"));
+	// Query twice so the second query uses the caches
+	TestBounds(TEXT("Cached"));
+
+	Splines[0]->EditPointAtindex(FTransform(FVector(5000.0f, 0.0f, 0.0f)), 3);
+	TestBounds(TEXT("Edited point"));
+
+	Splines[1]->RemovePointAtIndex(0);
+	Splines[1]->InsertPointAtIndex(FTransform(FVector(0.0f, 0.0f, -4000.0f)), 0);
+	TestBounds(TEXT("Removed and inserted points"));
+
+	Splines[2]->CurvePoints[5].SetLocation(FVector(0.0f, -6000.0f, 0.0f));
+	Splines[2]->MarkCurvePointsChanged();
+	TestBounds(TEXT("Direct point modification"));
+
+	Splines[3]->CurvePoints.Add(FTransform(FVector(7000.0f, 7000.0f, 0.0f)));
+	TestBounds(TEXT("Direct point append"));
+
+	HAC->SetWorldLocation(FVector(100.0f, 200.0f, 300.0f));
+	TestBounds(TEXT("Moved component"));
+
+	UStaticMeshComponent* NewSMC = NewObject<UStaticMeshComponent>(HAC, NAME_None, RF_Transient);
+	NewSMC->SetRelativeLocation(FVector(0.0f, 0.0f, 8000.0f));
+	NewSMC->AttachToComponent(HAC, FAttachmentTransformRules::KeepRelativeTransform);
+	TestBounds(TEXT("Attached child"));
+
+	// Attaching below an existing child doesn't notify the asset component
+	UStaticMeshComponent* NewGrandChildSMC = NewObject<UStaticMeshComponent>(HAC, NAME_None, RF_Transient);
+	NewGrandChildSMC->SetRelativeLocation(FVector(0.0f, -9000.0f, 0.0f));
+	NewGrandChildSMC->AttachToComponent(ChildSMC, FAttachmentTransformRules::KeepRelativeTransform);
+	TestBounds(TEXT("Attached grandchild"));
+
+	GrandChildSMC->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+	TestBounds(TEXT("Detached grandchild"));
+
+	NewSMC->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+	TestBounds(TEXT("Detached child"));
+
+	CurveOutput->Clear();
+	TestBounds(TEXT("Cleared output"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreSessionBackgroundStart, "Houdini.Core.Session.BackgroundStart", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreSessionBackgroundStart::RunTest(const FString & Parameters)
+{
+	FHoudiniMockSessionServer MockServer;
+	FHoudiniScopedMockSessionServer ScopedServer(MockServer);
+	if (!TestTrue(TEXT("Mock session server installed"), ScopedServer.IsInstalled()))
+		return false;
+
+	FHoudiniSessionStartOptions Options;
+	Options.SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe;
+	Options.ServerPipeName = TEXT("hapi_mock_background_start");
+	Options.bStartAutomaticServer = true;
+
+	// Slow server launch, the start must not block
+	MockServer.SetStartupDelay(0.2f);
+
+	FHoudiniSessionStarter Starter;
+	TestEqual(TEXT("Initial state"), Starter.GetState(), EHoudiniSessionStartState::Idle);
+	TestTrue(TEXT("Start"), Starter.Start(Options));
+	TestEqual(TEXT("State after start"), Starter.GetState(), EHoudiniSessionStartState::Starting);
+	TestFalse(TEXT("Second start while starting"), Starter.Start(Options));
+
+	HAPI_Session Session;
+	bool bSessionSync = true;
+	HAPI_License LicenseType = HAPI_LICENSE_NONE;
+	TestFalse(TEXT("Take while starting"), Starter.TakeSession(Session, bSessionSync, LicenseType));
+
+	TestEqual(TEXT("State once started"), Starter.Wait(), EHoudiniSessionStartState::Ready);
+	TestTrue(TEXT("Start duration includes the server launch"), Starter.GetStartDuration() >= 0.15);
+	TestTrue(TEXT("Ready session valid"), Starter.IsReadySessionValid());
+	TestFalse(TEXT("Start while a session is ready"), Starter.Start(Options));
+
+	TestTrue(TEXT("Take ready session"), Starter.TakeSession(Session, bSessionSync, LicenseType));
+	TestEqual(TEXT("State after take"), Starter.GetState(), EHoudiniSessionStartState::Idle);
+	TestEqual(TEXT("Taken session valid"), FHoudiniApi::IsSessionValid(&Session), HAPI_RESULT_SUCCESS);
+	TestEqual(TEXT("Taken session initialized"), FHoudiniApi::IsInitialized(&Session), HAPI_RESULT_SUCCESS);
+	TestFalse(TEXT("No session sync on a server we started"), bSessionSync);
+	TestEqual(TEXT("License type"), LicenseType, HAPI_LICENSE_HOUDINI_ENGINE);
+	TestEqual(TEXT("Servers started"), MockServer.GetStartedServerCount(), 1);
+
+	// A taken session is owned by the caller, resetting the starter must not close it
+	Starter.Reset();
+	TestEqual(TEXT("Taken session still valid after reset"), FHoudiniApi::IsSessionValid(&Session), HAPI_RESULT_SUCCESS);
+
+	// Connecting to a server started by the user enables session sync, without launching a server
+	FHoudiniSessionStartOptions SyncOptions = Options;
+	SyncOptions.ServerPipeName = TEXT("hapi_mock_session_sync");
+	MockServer.AddRunningServer(FHoudiniMockSessionServer::GetPipeServerName(SyncOptions.ServerPipeName));
+
+	HAPI_Session SyncSession;
+	TestTrue(TEXT("Start session sync"), Starter.Start(SyncOptions));
+	TestEqual(TEXT("Session sync state once started"), Starter.Wait(), EHoudiniSessionStartState::Ready);
+	TestTrue(TEXT("Take session sync"), Starter.TakeSession(SyncSession, bSessionSync, LicenseType));
+	TestTrue(TEXT("Session sync enabled"), bSessionSync);
+	TestEqual(TEXT("No server started for session sync"), MockServer.GetStartedServerCount(), 1);
+
+	// Socket sessions
+	FHoudiniSessionStartOptions SocketOptions = Options;
+	SocketOptions.SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_Socket;
+	SocketOptions.ServerPort = 19090;
+
+	HAPI_Session SocketSession;
+	TestTrue(TEXT("Start socket session"), Starter.Start(SocketOptions));
+	TestEqual(TEXT("Socket state once started"), Starter.Wait(), EHoudiniSessionStartState::Ready);
+	TestTrue(TEXT("Take socket session"), Starter.TakeSession(SocketSession, bSessionSync, LicenseType));
+	TestTrue(TEXT("Socket server running"), MockServer.IsServerRunning(FHoudiniMockSessionServer::GetSocketServerName(19090)));
+
+	// Sessions that can't be started in the background
+	FHoudiniSessionStartOptions InProcessOptions = Options;
+	InProcessOptions.SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_InProcess;
+	TestFalse(TEXT("In-process sessions are not started in the background"), Starter.Start(InProcessOptions));
+	TestEqual(TEXT("State after unsupported start"), Starter.GetState(), EHoudiniSessionStartState::Idle);
+
+	FHoudiniApi::CloseSession(&Session);
+	FHoudiniApi::CloseSession(&SyncSession);
+	FHoudiniApi::CloseSession(&SocketSession);
+	TestEqual(TEXT("All sessions closed"), MockServer.GetOpenSessionCount(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreSessionBackgroundStartFailures, "Houdini.Core.Session.BackgroundStartFailures", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreSessionBackgroundStartFailures::RunTest(const FString & Parameters)
+{
+	FHoudiniMockSessionServer MockServer;
+	FHoudiniScopedMockSessionServer ScopedServer(MockServer);
+	if (!TestTrue(TEXT("Mock session server installed"), ScopedServer.IsInstalled()))
+		return false;
+
+	FHoudiniSessionStartOptions Options;
+	Options.SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe;
+	Options.ServerPipeName = TEXT("hapi_mock_start_failures");
+
+	FHoudiniSessionStarter Starter;
+
+	// No running server, and we're not allowed to start one
+	Options.bStartAutomaticServer = false;
+	TestTrue(TEXT("Start without server"), Starter.Start(Options));
+	TestEqual(TEXT("No server"), Starter.Wait(), EHoudiniSessionStartState::Failed);
+	TestFalse(TEXT("Connection error reported"), Starter.GetError().IsEmpty());
+	TestFalse(TEXT("Failed session not valid"), Starter.IsReadySessionValid());
+	TestFalse(TEXT("Start while failed"), Starter.Start(Options));
+	Starter.Reset();
+	TestEqual(TEXT("State after reset"), Starter.GetState(), EHoudiniSessionStartState::Idle);
+
+	// The server can't be launched
+	Options.bStartAutomaticServer = true;
+	MockServer.SetCanStartServers(false);
+	TestTrue(TEXT("Start with missing server"), Starter.Start(Options));
+	TestEqual(TEXT("Missing server"), Starter.Wait(), EHoudiniSessionStartState::Failed);
+	TestFalse(TEXT("Launch error reported"), Starter.GetError().IsEmpty());
+	Starter.Reset();
+
+	// HAPI fails to initialize, the session must be closed
+	MockServer.SetCanStartServers(true);
+	MockServer.SetFailInitialize(true);
+	TestTrue(TEXT("Start with failed initialization"), Starter.Start(Options));
+	TestEqual(TEXT("Failed initialization"), Starter.Wait(), EHoudiniSessionStartState::Failed);
+	TestFalse(TEXT("Initialization error reported"), Starter.GetError().IsEmpty());
+	TestEqual(TEXT("Failed session closed"), MockServer.GetOpenSessionCount(), 0);
+	TestEqual(TEXT("Closed sessions after failed initialization"), MockServer.GetClosedSessionCount(), 1);
+	Starter.Reset();
+
+	// A ready session that is never taken is closed on reset
+	MockServer.SetFailInitialize(false);
+	TestTrue(TEXT("Start session"), Starter.Start(Options));
+	TestEqual(TEXT("Session started"), Starter.Wait(), EHoudiniSessionStartState::Ready);
+	TestEqual(TEXT("Open sessions before reset"), MockServer.GetOpenSessionCount(), 1);
+	Starter.Reset();
+	TestEqual(TEXT("Open sessions after reset"), MockServer.GetOpenSessionCount(), 0);
+	TestEqual(TEXT("Closed sessions after reset"), MockServer.GetClosedSessionCount(), 2);
+
+	// A start still in progress is waited for and closed when the starter is reset
+	MockServer.SetStartupDelay(0.1f);
+	TestTrue(TEXT("Start slow session"), Starter.Start(Options));
+	Starter.Reset();
+	TestEqual(TEXT("State after reset while starting"), Starter.GetState(), EHoudiniSessionStartState::Idle);
+	TestEqual(TEXT("Open sessions after reset while starting"), MockServer.GetOpenSessionCount(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreSessionStandby, "Houdini.Core.Session.Standby", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreSessionStandby::RunTest(const FString & Parameters)
+{
+	FHoudiniMockSessionServer MockServer;
+	FHoudiniScopedMockSessionServer ScopedServer(MockServer);
+	if (!TestTrue(TEXT("Mock session server installed"), ScopedServer.IsInstalled()))
+		return false;
+
+	FHoudiniSessionStartOptions Options;
+	Options.SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe;
+	Options.ServerPipeName = TEXT("hapi_mock_standby");
+	Options.bStartAutomaticServer = true;
+
+	const FHoudiniSessionStartOptions StandbyOptions = Options.MakeStandbyOptions(0);
+	TestTrue(TEXT("Standby options flagged"), StandbyOptions.bIsStandby);
+	TestNotEqual(TEXT("Standby uses its own pipe"), StandbyOptions.ServerPipeName, Options.ServerPipeName);
+	TestNotEqual(TEXT("Each standby uses its own pipe"), Options.MakeStandbyOptions(1).ServerPipeName, StandbyOptions.ServerPipeName);
+
+	// Start the main and standby sessions side by side
+	FHoudiniSessionStarter MainStarter;
+	FHoudiniSessionStarter StandbyStarter;
+	TestTrue(TEXT("Start main session"), MainStarter.Start(Options));
+	TestTrue(TEXT("Start standby session"), StandbyStarter.Start(StandbyOptions));
+	TestEqual(TEXT("Main session started"), MainStarter.Wait(), EHoudiniSessionStartState::Ready);
+	TestEqual(TEXT("Standby session started"), StandbyStarter.Wait(), EHoudiniSessionStartState::Ready);
+	TestEqual(TEXT("One server per session"), MockServer.GetStartedServerCount(), 2);
+
+	HAPI_Session MainSession;
+	bool bSessionSync = true;
+	HAPI_License LicenseType = HAPI_LICENSE_NONE;
+	TestTrue(TEXT("Take main session"), MainStarter.TakeSession(MainSession, bSessionSync, LicenseType));
+
+	// Crash the main session's server
+	TestTrue(TEXT("Kill main server"), MockServer.KillServer(FHoudiniMockSessionServer::GetPipeServerName(Options.ServerPipeName)));
+	TestNotEqual(TEXT("Main session lost"), FHoudiniApi::IsSessionValid(&MainSession), HAPI_RESULT_SUCCESS);
+	TestTrue(TEXT("Standby session unaffected"), StandbyStarter.IsReadySessionValid());
+
+	// Swap the standby session in
+	HAPI_Session StandbySession;
+	TestTrue(TEXT("Take standby session"), StandbyStarter.TakeSession(StandbySession, bSessionSync, LicenseType));
+	TestEqual(TEXT("Standby session valid"), FHoudiniApi::IsSessionValid(&StandbySession), HAPI_RESULT_SUCCESS);
+	TestEqual(TEXT("Standby session initialized"), FHoudiniApi::IsInitialized(&StandbySession), HAPI_RESULT_SUCCESS);
+	TestFalse(TEXT("Standby session is never a session sync one"), bSessionSync);
+	TestEqual(TEXT("Standby starter idle after take"), StandbyStarter.GetState(), EHoudiniSessionStartState::Idle);
+
+	// The next standby, started while the swapped in standby is the current session, gets its own server
+	const FHoudiniSessionStartOptions NextStandbyOptions = Options.MakeStandbyOptions(1);
+	TestTrue(TEXT("Start the next standby session"), StandbyStarter.Start(NextStandbyOptions));
+	TestEqual(TEXT("Next standby session started"), StandbyStarter.Wait(), EHoudiniSessionStartState::Ready);
+	TestEqual(TEXT("Next standby launched its own server"), MockServer.GetStartedServerCount(), 3);
+	TestTrue(TEXT("Kill the swapped in standby's server"), MockServer.KillServer(FHoudiniMockSessionServer::GetPipeServerName(StandbyOptions.ServerPipeName)));
+	TestTrue(TEXT("Next standby survives the current server's crash"), StandbyStarter.IsReadySessionValid());
+
+	// A standby session whose server died can't be swapped in
+	TestTrue(TEXT("Kill next standby server"), MockServer.KillServer(FHoudiniMockSessionServer::GetPipeServerName(NextStandbyOptions.ServerPipeName)));
+	TestFalse(TEXT("Dead standby session not valid"), StandbyStarter.IsReadySessionValid());
+	StandbyStarter.Reset();
+	TestEqual(TEXT("Standby starter idle after reset"), StandbyStarter.GetState(), EHoudiniSessionStartState::Idle);
+
+	// A standby session never connects to a server that is already running on its pipe
+	const FHoudiniSessionStartOptions BusyStandbyOptions = Options.MakeStandbyOptions(2);
+	MockServer.AddRunningServer(FHoudiniMockSessionServer::GetPipeServerName(BusyStandbyOptions.ServerPipeName));
+	TestTrue(TEXT("Start standby on a running server"), StandbyStarter.Start(BusyStandbyOptions));
+	TestEqual(TEXT("Standby on a running server failed"), StandbyStarter.Wait(), EHoudiniSessionStartState::Failed);
+	TestEqual(TEXT("No server started for the busy standby"), MockServer.GetStartedServerCount(), 3);
+	StandbyStarter.Reset();
+
+	// Socket standby sessions cycle through the ports after the session's port
+	FHoudiniSessionStartOptions SocketOptions = Options;
+	SocketOptions.SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_Socket;
+	SocketOptions.ServerPort = 19190;
+	TestEqual(TEXT("First socket standby port"), SocketOptions.MakeStandbyOptions(0).ServerPort, 19191);
+	TestEqual(TEXT("Next socket standby port"), SocketOptions.MakeStandbyOptions(1).ServerPort, 19192);
+
+	FHoudiniApi::CloseSession(&MainSession);
+	FHoudiniApi::CloseSession(&StandbySession);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreInputNodePool, "Houdini.Core.Inputs.InputNodePool", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreInputNodePool::RunTest(const FString & Parameters)
+{
+	// The input nodes are created in the mock instead of the session
+	FHoudiniMockApi Mock;
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	IConsoleVariable* PoolSizeCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.InputNodePoolSize"));
+	if (!TestNotNull(TEXT("Pool size CVar"), PoolSizeCVar))
+		return false;
+
+	const int32 PreviousPoolSize = PoolSizeCVar->GetInt();
+	PoolSizeCVar->Set(1, ECVF_SetByCode);
+	FHoudiniInputNodePool::Reset();
+
+	// The first node is created
+	HAPI_NodeId FirstNodeId = -1;
+	TestTrue(TEXT("Acquire a mesh input node"), FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, TEXT("InputA"), FirstNodeId));
+	TestNotNull(TEXT("Mesh input node created"), Mock.FindNode(FirstNodeId));
+	TestEqual(TEXT("Nodes created"), FHoudiniInputNodePool::GetStats().NumCreated, 1);
+	TestTrue(TEXT("Node created by the pool"), FHoudiniInputNodePool::IsPooledNode(FirstNodeId));
+
+	const HAPI_NodeId FirstObjNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(FirstNodeId);
+	TestTrue(TEXT("OBJ node of the pooled node"), FHoudiniInputNodePool::IsPooledNode(FirstObjNodeId));
+
+	// Upload some geometry, it is cleared when the node is released
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	PartInfo.type = HAPI_PARTTYPE_MESH;
+	PartInfo.pointCount = 4;
+	PartInfo.vertexCount = 4;
+	PartInfo.faceCount = 1;
+	TestEqual(TEXT("Set the part info"), FHoudiniApi::SetPartInfo(nullptr, FirstNodeId, 0, &PartInfo), HAPI_RESULT_SUCCESS);
+
+	TestTrue(TEXT("Release the mesh input node"), FHoudiniInputNodePool::ReleaseNode(FirstNodeId));
+	TestNotNull(TEXT("Released node kept"), Mock.FindNode(FirstNodeId));
+	TestEqual(TEXT("Free nodes after release"), FHoudiniInputNodePool::GetStats().NumFree, 1);
+	FHoudiniMockPart* ReleasedPart = Mock.FindPart(FirstNodeId, 0);
+	TestTrue(TEXT("Released node geometry cleared"), ReleasedPart && ReleasedPart->Info.pointCount == 0 && ReleasedPart->Info.faceCount == 0);
+	TestTrue(TEXT("Releasing a free node again"), FHoudiniInputNodePool::ReleaseNode(FirstNodeId));
+	TestEqual(TEXT("Free nodes after a second release"), FHoudiniInputNodePool::GetStats().NumFree, 1);
+
+	// The next input reuses it, renamed
+	HAPI_NodeId SecondNodeId = -1;
+	TestTrue(TEXT("Acquire another mesh input node"), FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, TEXT("InputB"), SecondNodeId));
+	TestEqual(TEXT("Released node reused"), SecondNodeId, FirstNodeId);
+	TestEqual(TEXT("Nodes reused"), FHoudiniInputNodePool::GetStats().NumReused, 1);
+	TestEqual(TEXT("No free nodes left"), FHoudiniInputNodePool::GetStats().NumFree, 0);
+	FHoudiniMockNode* ReusedObjNode = Mock.FindNode(FirstObjNodeId);
+	const FString* ReusedObjName = ReusedObjNode ? Mock.FindString(ReusedObjNode->Info.nameSH) : nullptr;
+	TestTrue(TEXT("Reused node renamed"), ReusedObjName && *ReusedObjName == TEXT("InputB"));
+
+	// Releasing the OBJ node releases the pooled node
+	TestTrue(TEXT("Release the OBJ node"), FHoudiniInputNodePool::ReleaseNode(FirstObjNodeId));
+	TestEqual(TEXT("Free nodes after releasing the OBJ"), FHoudiniInputNodePool::GetStats().NumFree, 1);
+
+	// Nodes released beyond the pool's size are deleted
+	HAPI_NodeId ThirdNodeId = -1;
+	HAPI_NodeId FourthNodeId = -1;
+	TestTrue(TEXT("Acquire a third node"), FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, TEXT("InputC"), ThirdNodeId));
+	TestTrue(TEXT("Acquire a fourth node"), FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, TEXT("InputD"), FourthNodeId));
+	TestEqual(TEXT("Third node reused"), ThirdNodeId, FirstNodeId);
+	TestNotEqual(TEXT("Fourth node created"), FourthNodeId, FirstNodeId);
+	TestTrue(TEXT("Release the third node"), FHoudiniInputNodePool::ReleaseNode(ThirdNodeId));
+	TestTrue(TEXT("Release the fourth node"), FHoudiniInputNodePool::ReleaseNode(FourthNodeId));
+	TestNull(TEXT("Node in excess deleted"), Mock.FindNode(FourthNodeId));
+	TestEqual(TEXT("Nodes deleted"), FHoudiniInputNodePool::GetStats().NumDeleted, 1);
+	TestEqual(TEXT("Free nodes capped by the pool size"), FHoudiniInputNodePool::GetStats().NumFree, 1);
+
+	// A free node deleted by something else is not handed out
+	Mock.DeleteNode(FirstObjNodeId);
+	HAPI_NodeId FifthNodeId = -1;
+	TestTrue(TEXT("Acquire after the free node was deleted"), FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, TEXT("InputE"), FifthNodeId));
+	TestNotEqual(TEXT("Deleted node not reused"), FifthNodeId, FirstNodeId);
+	TestNotNull(TEXT("New node created"), Mock.FindNode(FifthNodeId));
+
+	// Nodes that weren't created by the pool are left to the caller
+	const HAPI_NodeId OtherNodeId = Mock.CreateInputNode(TEXT("Other"));
+	TestFalse(TEXT("Other nodes are not released"), FHoudiniInputNodePool::ReleaseNode(OtherNodeId));
+	TestNotNull(TEXT("Other node kept"), Mock.FindNode(OtherNodeId));
+
+	// The pool forgets the nodes with the session
+	FHoudiniInputNodePool::Reset();
+	TestFalse(TEXT("Nodes forgotten after reset"), FHoudiniInputNodePool::IsPooledNode(FifthNodeId));
+
+	// Without a pool, released nodes are deleted
+	PoolSizeCVar->Set(0, ECVF_SetByCode);
+	HAPI_NodeId UnpooledNodeId = -1;
+	TestTrue(TEXT("Acquire without a pool"), FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, TEXT("InputF"), UnpooledNodeId));
+	TestTrue(TEXT("Release without a pool"), FHoudiniInputNodePool::ReleaseNode(UnpooledNodeId));
+	TestNull(TEXT("Node deleted without a pool"), Mock.FindNode(UnpooledNodeId));
+
+	FHoudiniInputNodePool::Reset();
+	PoolSizeCVar->Set(PreviousPoolSize, ECVF_SetByCode);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreSharedStaticMeshInputNodes, "Houdini.Core.Inputs.SharedStaticMeshInputNodes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreSharedStaticMeshInputNodes::RunTest(const FString & Parameters)
+{
+	// The shared and input nodes are created in the mock instead of the session
+	FHoudiniMockApi Mock;
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	IConsoleVariable* MaxUnusedCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.MaxUnusedSharedStaticMeshInputNodes"));
+	if (!TestNotNull(TEXT("Max unused shared nodes CVar"), MaxUnusedCVar))
+		return false;
+
+	const int32 PreviousMaxUnused = MaxUnusedCVar->GetInt();
+	FUnrealMeshTranslator::ClearSharedStaticMeshInputNodes();
+
+	int32 NumUploads = 0;
+	auto UploadSharedNode = [&Mock, &NumUploads](HAPI_NodeId& OutNodeId)
+	{
+		NumUploads++;
+		OutNodeId = Mock.CreateInputNode(TEXT("shared_Mesh"));
+		return OutNodeId >= 0;
+	};
+
+	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FString FirstKey = FUnrealMeshTranslator::GetSharedStaticMeshInputNodeKey(StaticMesh, false, false, false);
+	TestFalse(TEXT("Shared node key"), FirstKey.IsEmpty());
+	TestEqual(TEXT("Same key for the same content"), FUnrealMeshTranslator::GetSharedStaticMeshInputNodeKey(StaticMesh, false, false, false), FirstKey);
+	TestNotEqual(TEXT("Export options change the key"), FUnrealMeshTranslator::GetSharedStaticMeshInputNodeKey(StaticMesh, true, false, false), FirstKey);
+
+	// The mesh is uploaded once and reused by the following inputs
+	HAPI_NodeId FirstSharedNodeId = -1;
+	TestTrue(TEXT("Create the shared node"), FUnrealMeshTranslator::FindOrCreateSharedStaticMeshNode(FirstKey, UploadSharedNode, FirstSharedNodeId));
+	const HAPI_NodeId UserA = Mock.CreateInputNode(TEXT("InputA"));
+	FUnrealMeshTranslator::AddSharedStaticMeshInputNodeUser(FirstKey, UserA);
+
+	HAPI_NodeId ReusedNodeId = -1;
+	TestTrue(TEXT("Find the shared node"), FUnrealMeshTranslator::FindOrCreateSharedStaticMeshNode(FirstKey, UploadSharedNode, ReusedNodeId));
+	const HAPI_NodeId UserB = Mock.CreateInputNode(TEXT("InputB"));
+	FUnrealMeshTranslator::AddSharedStaticMeshInputNodeUser(FirstKey, UserB);
+	TestEqual(TEXT("Shared node reused"), ReusedNodeId, FirstSharedNodeId);
+	TestEqual(TEXT("Mesh uploaded once"), NumUploads, 1);
+	TestEqual(TEXT("Input A uses the shared node"), FUnrealMeshTranslator::GetSharedStaticMeshNodeForInputNode(UserA), FirstSharedNodeId);
+	TestEqual(TEXT("Input B uses the shared node"), FUnrealMeshTranslator::GetSharedStaticMeshNodeForInputNode(UserB), FirstSharedNodeId);
+
+	// Changing the mesh changes its key, so the next input uploads it again
+	StaticMesh->SetLightMapResolution(StaticMesh->GetLightMapResolution() * 2 + 1);
+	const FString SecondKey = FUnrealMeshTranslator::GetSharedStaticMeshInputNodeKey(StaticMesh, false, false, false);
+	TestNotEqual(TEXT("Mesh change invalidates the key"), SecondKey, FirstKey);
+
+	HAPI_NodeId SecondSharedNodeId = -1;
+	TestTrue(TEXT("Create the shared node for the modified mesh"), FUnrealMeshTranslator::FindOrCreateSharedStaticMeshNode(SecondKey, UploadSharedNode, SecondSharedNodeId));
+	const HAPI_NodeId UserC = Mock.CreateInputNode(TEXT("InputC"));
+	FUnrealMeshTranslator::AddSharedStaticMeshInputNodeUser(SecondKey, UserC);
+	TestNotEqual(TEXT("Modified mesh uses a new shared node"), SecondSharedNodeId, FirstSharedNodeId);
+	TestEqual(TEXT("Modified mesh uploaded"), NumUploads, 2);
+	TestEqual(TEXT("Shared nodes"), FUnrealMeshTranslator::GetNumSharedStaticMeshNodes(), 2);
+
+	// A shared node deleted from the session is uploaded again and forgets its users
+	Mock.DeleteNode(FHoudiniEngineUtils::HapiGetParentNodeId(FirstSharedNodeId));
+	HAPI_NodeId RecreatedNodeId = -1;
+	TestTrue(TEXT("Recreate the deleted shared node"), FUnrealMeshTranslator::FindOrCreateSharedStaticMeshNode(FirstKey, UploadSharedNode, RecreatedNodeId));
+	TestNotEqual(TEXT("Deleted shared node not reused"), RecreatedNodeId, FirstSharedNodeId);
+	TestEqual(TEXT("Deleted shared node uploaded again"), NumUploads, 3);
+	TestEqual(TEXT("Users of the deleted node forgotten"), FUnrealMeshTranslator::GetSharedStaticMeshNodeForInputNode(UserA), -1);
+	const HAPI_NodeId UserD = Mock.CreateInputNode(TEXT("InputD"));
+	FUnrealMeshTranslator::AddSharedStaticMeshInputNodeUser(FirstKey, UserD);
+
+	// Failed uploads are not cached
+	auto FailedUpload = [](HAPI_NodeId& OutNodeId) { return false; };
+	HAPI_NodeId FailedNodeId = -1;
+	TestFalse(TEXT("Failed upload"), FUnrealMeshTranslator::FindOrCreateSharedStaticMeshNode(TEXT("Failed"), FailedUpload, FailedNodeId));
+	TestEqual(TEXT("Failed upload not cached"), FUnrealMeshTranslator::GetNumSharedStaticMeshNodes(), 2);
+
+	// Unused shared nodes beyond the budget are deleted, used ones are kept
+	MaxUnusedCVar->Set(0, ECVF_SetByCode);
+	FUnrealMeshTranslator::ReleaseSharedStaticMeshInputNode(UserC);
+	TestEqual(TEXT("Released input forgotten"), FUnrealMeshTranslator::GetSharedStaticMeshNodeForInputNode(UserC), -1);
+	FUnrealMeshTranslator::EvictUnusedSharedStaticMeshInputNodes();
+	TestNull(TEXT("Unused shared node deleted"), Mock.FindNode(SecondSharedNodeId));
+	TestNotNull(TEXT("Used shared node kept"), Mock.FindNode(RecreatedNodeId));
+	TestEqual(TEXT("Shared nodes after eviction"), FUnrealMeshTranslator::GetNumSharedStaticMeshNodes(), 1);
+
+	// Input nodes deleted without being released don't keep their shared node alive
+	Mock.DeleteNode(FHoudiniEngineUtils::HapiGetParentNodeId(UserD));
+	FUnrealMeshTranslator::EvictUnusedSharedStaticMeshInputNodes();
+	TestNull(TEXT("Shared node of a deleted input deleted"), Mock.FindNode(RecreatedNodeId));
+	TestEqual(TEXT("No shared nodes left"), FUnrealMeshTranslator::GetNumSharedStaticMeshNodes(), 0);
+
+	// Clearing forgets the shared nodes with the session
+	HAPI_NodeId ClearedNodeId = -1;
+	FUnrealMeshTranslator::FindOrCreateSharedStaticMeshNode(SecondKey, UploadSharedNode, ClearedNodeId);
+	FUnrealMeshTranslator::AddSharedStaticMeshInputNodeUser(SecondKey, UserB);
+	FUnrealMeshTranslator::ClearSharedStaticMeshInputNodes();
+	TestEqual(TEXT("Shared nodes forgotten after clear"), FUnrealMeshTranslator::GetNumSharedStaticMeshNodes(), 0);
+	TestEqual(TEXT("Users forgotten after clear"), FUnrealMeshTranslator::GetSharedStaticMeshNodeForInputNode(UserB), -1);
+
+	MaxUnusedCVar->Set(PreviousMaxUnused, ECVF_SetByCode);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreAssetLibraryExpandedHDA, "Houdini.Core.Inputs.AssetLibraryExpandedHDA", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreAssetLibraryExpandedHDA::RunTest(const FString & Parameters)
+{
+	// The loaded libraries are listed by the mock instead of the session
+	FHoudiniMockApi Mock;
+	FHoudiniScopedMockApi ScopedMock(Mock);
+	if (!TestTrue(TEXT("Installed the mock"), ScopedMock.IsInstalled()))
+		return false;
+
+	// An expanded HDA is a directory with the asset's sections in sub directories
+	IFileManager& FileManager = IFileManager::Get();
+	const FString ExpandedHDA = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("HoudiniAssetLibraryRegistry"), TEXT("test.hda"));
+	const FString IndexFile = FPaths::Combine(ExpandedHDA, TEXT("INDEX__SECTION"));
+	const FString ContentsFile = FPaths::Combine(ExpandedHDA, TEXT("Sop_1test"), TEXT("Contents.dir"), TEXT("Contents.mc"));
+	FileManager.DeleteDirectory(*ExpandedHDA, false, true);
+	TestTrue(TEXT("Write the index"), FFileHelper::SaveStringToFile(TEXT("Operator: test"), *IndexFile));
+	TestTrue(TEXT("Write the contents"), FFileHelper::SaveStringToFile(TEXT("contents"), *ContentsFile));
+	const FDateTime ContentsTime = FileManager.GetTimeStamp(*ContentsFile);
+	const FDateTime DirectoryTime = FileManager.GetTimeStamp(*ExpandedHDA);
+
+	UHoudiniAsset* HoudiniAsset = NewObject<UHoudiniAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	FHoudiniAssetLibraryRegistry::Reset();
+
+	// The library is reused while the expanded HDA is unchanged
+	const HAPI_AssetLibraryId FirstLibraryId = 7;
+	Mock.AddAssetLibrary(FirstLibraryId, { TEXT("Sop/test") });
+	FHoudiniAssetLibraryRegistry::RegisterLoadedLibrary(HoudiniAsset, ExpandedHDA, FirstLibraryId, 0.0);
+
+	HAPI_AssetLibraryId FoundLibraryId = -1;
+	TestTrue(TEXT("Unchanged expanded HDA reused"), FHoudiniAssetLibraryRegistry::FindLoadedLibrary(HoudiniAsset, ExpandedHDA, FoundLibraryId));
+	TestEqual(TEXT("Reused library"), FoundLibraryId, FirstLibraryId);
+
+	// Edit a file inside the expanded HDA, without changing its size, nor the directory's timestamp
+	TestTrue(TEXT("Edit the contents"), FFileHelper::SaveStringToFile(TEXT("CONTENTS"), *ContentsFile));
+	FileManager.SetTimeStamp(*ContentsFile, ContentsTime + FTimespan::FromMinutes(1.0));
+	FileManager.SetTimeStamp(*ExpandedHDA, DirectoryTime);
+	TestFalse(TEXT("Edited expanded HDA reloaded"), FHoudiniAssetLibraryRegistry::FindLoadedLibrary(HoudiniAsset, ExpandedHDA, FoundLibraryId));
+
+	const HAPI_AssetLibraryId SecondLibraryId = 8;
+	Mock.AddAssetLibrary(SecondLibraryId, { TEXT("Sop/test") });
+	FHoudiniAssetLibraryRegistry::RegisterLoadedLibrary(HoudiniAsset, ExpandedHDA, SecondLibraryId, 0.0);
+	TestTrue(TEXT("Reloaded expanded HDA reused"), FHoudiniAssetLibraryRegistry::FindLoadedLibrary(HoudiniAsset, ExpandedHDA, FoundLibraryId));
+	TestEqual(TEXT("Reloaded library"), FoundLibraryId, SecondLibraryId);
+
+	// Adding a file changes the library too
+	TestTrue(TEXT("Add a section"), FFileHelper::SaveStringToFile(TEXT("help"), *FPaths::Combine(ExpandedHDA, TEXT("Sop_1test"), TEXT("Help"))));
+	TestFalse(TEXT("Expanded HDA with a new file reloaded"), FHoudiniAssetLibraryRegistry::FindLoadedLibrary(HoudiniAsset, ExpandedHDA, FoundLibraryId));
+
+	// Don't prewarm the test asset in the next session
+	FHoudiniAssetLibraryRegistry::Reset();
+	HoudiniAsset->MarkPendingKill();
+	FileManager.DeleteDirectory(*ExpandedHDA, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreLandscapeParallelExtraction, "Houdini.Core.Landscape.ParallelExtraction", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreLandscapeParallelExtraction::RunTest(const FString & Parameters)
+{
+	IConsoleVariable* ParallelCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.ParallelLandscapeExtraction"));
+	if (!TestNotNull(TEXT("Parallel landscape extraction CVar"), ParallelCVar))
+		return false;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("HoudiniLandscapeExtractionTest"), GetTransientPackage(), false);
+	if (!TestNotNull(TEXT("Test world"), World))
+		return false;
+
+	// 3x2 components of 2x2 sections, with random heights and a non uniform scale
+	const int32 NumSubsections = 2;
+	const int32 SubsectionSizeQuads = 7;
+	const int32 ComponentSizeQuads = NumSubsections * SubsectionSizeQuads;
+	const int32 SizeX = 3 * ComponentSizeQuads + 1;
+	const int32 SizeY = 2 * ComponentSizeQuads + 1;
+
+	FRandomStream RandomStream(1234);
+	TArray<uint16> HeightData;
+	HeightData.SetNumUninitialized(SizeX * SizeY);
+	for (uint16& Height : HeightData)
+		Height = (uint16)RandomStream.RandRange(0, MAX_uint16);
+
+	TMap<FGuid, TArray<uint16>> HeightDataPerLayers;
+	HeightDataPerLayers.Add(FGuid(), HeightData);
+	TMap<FGuid, TArray<FLandscapeImportLayerInfo>> MaterialLayerDataPerLayers;
+	MaterialLayerDataPerLayers.Add(FGuid(), TArray<FLandscapeImportLayerInfo>());
+
+	ALandscape* Landscape = World->SpawnActor<ALandscape>();
+	if (!TestNotNull(TEXT("Landscape spawned"), Landscape))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	Landscape->SetActorTransform(FTransform(FRotator(0.0f, 30.0f, 0.0f), FVector(100.0f, -200.0f, 50.0f), FVector(100.0f, 50.0f, 25.0f)));
+	Landscape->SetLandscapeGuid(FGuid::NewGuid());
+	Landscape->Import(
+		Landscape->GetLandscapeGuid(),
+		0, 0, SizeX - 1, SizeY - 1,
+		NumSubsections, SubsectionSizeQuads,
+		HeightDataPerLayers, nullptr,
+		MaterialLayerDataPerLayers, ELandscapeImportAlphamapType::Additive);
+
+	TestEqual(TEXT("Landscape components imported"), Landscape->LandscapeComponents.Num(), 6);
+
+	struct FExtractedLandscapeData
+	{
+		TArray<FVector> Positions;
+		TArray<FVector> Normals;
+		TArray<FVector> UVs;
+		TArray<FIntPoint> VertexIndices;
+		TArray<FString> ComponentNames;
+		TArray<FLinearColor> LightmapValues;
+	};
+
+	auto Extract = [&](const int32 InParallel, TSet<ULandscapeComponent*>& InComponents, const bool bTileUVs, const bool bNormalizedUVs, FExtractedLandscapeData& OutData)
+	{
+		ParallelCVar->Set(InParallel, ECVF_SetByCode);
+		return FUnrealLandscapeTranslator::ExtractLandscapeData(
+			Landscape, InComponents, false, bTileUVs, bNormalizedUVs,
+			OutData.Positions, OutData.Normals, OutData.UVs, OutData.VertexIndices, OutData.ComponentNames, OutData.LightmapValues);
+	};
+
+	auto TestExtraction = [&](const TCHAR* InStep, TSet<ULandscapeComponent*>& InComponents, const bool bTileUVs, const bool bNormalizedUVs)
+	{
+		FExtractedLandscapeData Serial;
+		FExtractedLandscapeData Parallel;
+		if (!TestTrue(FString::Printf(TEXT("%s: serial extraction"), InStep), Extract(0, InComponents, bTileUVs, bNormalizedUVs, Serial)))
+			return;
+		if (!TestTrue(FString::Printf(TEXT("%s: parallel extraction"), InStep), Extract(1, InComponents, bTileUVs, bNormalizedUVs, Parallel)))
+			return;
+
+		const int32 VertexCount = InComponents.Num() * FMath::Square(ComponentSizeQuads + 1);
+		TestEqual(FString::Printf(TEXT("%s: point count"), InStep), Serial.Positions.Num(), VertexCount);
+		TestEqual(FString::Printf(TEXT("%s: component count"), InStep), Serial.ComponentNames.Num(), InComponents.Num());
+
+		TestTrue(FString::Printf(TEXT("%s: identical positions"), InStep), Serial.Positions == Parallel.Positions);
+		TestTrue(FString::Printf(TEXT("%s: identical normals"), InStep), Serial.Normals == Parallel.Normals);
+		TestTrue(FString::Printf(TEXT("%s: identical uvs"), InStep), Serial.UVs == Parallel.UVs);
+		TestTrue(FString::Printf(TEXT("%s: identical vertex indices"), InStep), Serial.VertexIndices == Parallel.VertexIndices);
+		TestTrue(FString::Printf(TEXT("%s: identical component names"), InStep), Serial.ComponentNames == Parallel.ComponentNames);
+	};
+
+	const int32 PreviousParallel = ParallelCVar->GetInt();
+
+	TSet<ULandscapeComponent*> AllComponents(Landscape->LandscapeComponents);
+	TestExtraction(TEXT("Global UVs"), AllComponents, false, false);
+	TestExtraction(TEXT("Normalized global UVs"), AllComponents, false, true);
+	TestExtraction(TEXT("Normalized tile UVs"), AllComponents, true, true);
+
+	TSet<ULandscapeComponent*> SelectedComponents;
+	SelectedComponents.Add(Landscape->LandscapeComponents[1]);
+	SelectedComponents.Add(Landscape->LandscapeComponents[4]);
+	SelectedComponents.Add(Landscape->LandscapeComponents[5]);
+	TestExtraction(TEXT("Selected components"), SelectedComponents, false, true);
+
+	ParallelCVar->Set(PreviousParallel, ECVF_SetByCode);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreGenericAttributeBulkUpdate, "Houdini.Core.GenericAttributes.BulkUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreGenericAttributeBulkUpdate::RunTest(const FString & Parameters)
+{
+	const int32 NumObjects = 8;
+
+	// Per-instance float, bool, name and string-to-numeric attributes
+	auto MakeAttribute = [NumObjects](const TCHAR* InName, const EAttribStorageType InType)
+	{
+		FHoudiniGenericAttribute Attribute;
+		Attribute.AttributeName = InName;
+		Attribute.AttributeType = InType;
+		Attribute.AttributeOwner = EAttribOwner::Point;
+		Attribute.AttributeCount = NumObjects;
+		Attribute.AttributeTupleSize = 1;
+		return Attribute;
+	};
+
+	TArray<FHoudiniGenericAttribute> Attributes;
+	FHoudiniGenericAttribute& DrawDistance = Attributes.Add_GetRef(MakeAttribute(TEXT("LDMaxDrawDistance"), EAttribStorageType::FLOAT));
+	FHoudiniGenericAttribute& CastDynamicShadow = Attributes.Add_GetRef(MakeAttribute(TEXT("bCastDynamicShadow"), EAttribStorageType::INT));
+	FHoudiniGenericAttribute& SortPriority = Attributes.Add_GetRef(MakeAttribute(TEXT("TranslucencySortPriority"), EAttribStorageType::STRING));
+	for (int32 Idx = 0; Idx < NumObjects; Idx++)
+	{
+		DrawDistance.DoubleValues.Add(1000.0 * (Idx + 1));
+		CastDynamicShadow.IntValues.Add(Idx % 2);
+		SortPriority.StringValues.Add(FString::FromInt(Idx - 4));
+	}
+
+	// The same values are applied per object and in bulk, with a reversed index mapping
+	TArray<UObject*> SingleObjects;
+	TArray<UObject*> BulkObjects;
+	TArray<int32> Indices;
+	for (int32 Idx = 0; Idx < NumObjects; Idx++)
+	{
+		SingleObjects.Add(NewObject<UStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient));
+		BulkObjects.Add(NewObject<UStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient));
+		Indices.Add(NumObjects - 1 - Idx);
+	}
+
+	FHoudiniGenericAttribute::ClearPropertyCache();
+	for (const FHoudiniGenericAttribute& Attribute : Attributes)
+	{
+		for (int32 Idx = 0; Idx < NumObjects; Idx++)
+			FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(SingleObjects[Idx], Attribute, Indices[Idx]);
+
+		TestEqual(FString::Printf(TEXT("%s updated on all objects"), *Attribute.AttributeName),
+			FHoudiniGenericAttribute::UpdatePropertyAttributeOnObjects(BulkObjects, Attribute, Indices), NumObjects);
+	}
+
+	for (int32 Idx = 0; Idx < NumObjects; Idx++)
+	{
+		const UStaticMeshComponent* Single = Cast<UStaticMeshComponent>(SingleObjects[Idx]);
+		const UStaticMeshComponent* Bulk = Cast<UStaticMeshComponent>(BulkObjects[Idx]);
+		TestEqual(TEXT("Bulk draw distance"), Bulk->LDMaxDrawDistance, (float)DrawDistance.DoubleValues[Indices[Idx]]);
+		TestEqual(TEXT("Bulk draw distance matches per object"), Bulk->LDMaxDrawDistance, Single->LDMaxDrawDistance);
+		TestEqual(TEXT("Bulk dynamic shadow matches per object"), (bool)Bulk->bCastDynamicShadow, (bool)Single->bCastDynamicShadow);
+		TestEqual(TEXT("Bulk sort priority"), Bulk->TranslucencySortPriority, Indices[Idx] - 4);
+		TestEqual(TEXT("Bulk sort priority matches per object"), Bulk->TranslucencySortPriority, Single->TranslucencySortPriority);
+	}
+
+	// Manually handled properties still go through the per object path
+	FHoudiniGenericAttribute CastShadow = MakeAttribute(TEXT("CastShadow"), EAttribStorageType::INT);
+	CastShadow.IntValues.Init(0, NumObjects);
+	TestEqual(TEXT("CastShadow updated on all objects"), FHoudiniGenericAttribute::UpdatePropertyAttributeOnObjects(BulkObjects, CastShadow, Indices), NumObjects);
+	TestFalse(TEXT("CastShadow disabled"), (bool)Cast<UStaticMeshComponent>(BulkObjects[0])->CastShadow);
+
+	FHoudiniGenericAttribute::ClearPropertyCache();
+
+	return true;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,1771 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniMockApi.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "../HoudiniEngine.h"
+#include "../HoudiniEnginePrivatePCH.h"
+#include "../HoudiniEngineString.h"
+#include "../HoudiniEngineUtils.h"
+#include "HoudiniApi.h"
+#include "HAPI/HAPI_Version.h"
+
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// Increase when the recording format changes
+static const int32 HoudiniMockApiFileVersion = 1;
+static const uint32 HoudiniMockApiFileMagic = 0x4D484150; // "MHAP"
+
+FHoudiniMockApi* FHoudiniMockApi::ActiveMock = nullptr;
+
+// Ids of the nodes created through the mock, far from the ids of the synthetic and recorded nodes
+static const HAPI_NodeId HoudiniMockCreatedNodeIdBase = 1 << 24;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// SERIALIZATION
+//-----------------------------------------------------------------------------------------------------------------------------
+
+// The HAPI structs are plain data, and their string handles have been remapped to the mock's string table
+template<typename THapiStruct>
+static void SerializeHapiStruct(FArchive& Ar, THapiStruct& InOutStruct)
+{
+	Ar.Serialize(&InOutStruct, sizeof(THapiStruct));
+}
+
+template<typename THapiStruct>
+static void SerializeHapiStructArray(FArchive& Ar, TArray<THapiStruct>& InOutArray)
+{
+	int32 Num = InOutArray.Num();
+	Ar << Num;
+	if (Ar.IsLoading())
+		InOutArray.SetNumZeroed(Num);
+
+	if (Num > 0)
+		Ar.Serialize(InOutArray.GetData(), sizeof(THapiStruct) * Num);
+}
+
+static FArchive& operator<<(FArchive& Ar, FHoudiniMockAttribute& InAttribute)
+{
+	SerializeHapiStruct(Ar, InAttribute.Info);
+	Ar << InAttribute.FloatData;
+	Ar << InAttribute.IntData;
+	Ar << InAttribute.StringData;
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FHoudiniMockPart& InPart)
+{
+	SerializeHapiStruct(Ar, InPart.Info);
+	Ar << InPart.FaceCounts;
+	Ar << InPart.VertexList;
+	Ar << InPart.FaceMaterialIds;
+	for (int32 Owner = 0; Owner < HAPI_ATTROWNER_MAX; Owner++)
+		Ar << InPart.Attributes[Owner];
+	for (int32 Type = 0; Type < HAPI_GROUPTYPE_MAX; Type++)
+		Ar << InPart.GroupMembership[Type];
+	SerializeHapiStruct(Ar, InPart.VolumeInfo);
+	Ar << InPart.HeightfieldData;
+	Ar << InPart.InstancedPartIds;
+	SerializeHapiStructArray(Ar, InPart.InstanceTransforms);
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FHoudiniMockGeo& InGeo)
+{
+	SerializeHapiStruct(Ar, InGeo.Info);
+	for (int32 Type = 0; Type < HAPI_GROUPTYPE_MAX; Type++)
+		Ar << InGeo.GroupNames[Type];
+	Ar << InGeo.Parts;
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FHoudiniMockNode& InNode)
+{
+	SerializeHapiStruct(Ar, InNode.Info);
+	SerializeHapiStruct(Ar, InNode.AssetInfo);
+	SerializeHapiStructArray(Ar, InNode.Parms);
+	Ar << InNode.ParmIntValues;
+	Ar << InNode.ParmFloatValues;
+	Ar << InNode.ParmStringValues;
+	SerializeHapiStructArray(Ar, InNode.ParmChoices);
+	return Ar;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// MOCK FUNCTIONS
+//-----------------------------------------------------------------------------------------------------------------------------
+
+// Copies [Start, Start + Length[ tuples from a mock buffer, checking the range first
+template<typename TSource, typename TDest>
+static HAPI_Result HoudiniMockCopyRange(const TArray<TSource>& InSource, TDest* OutDest, const int32& InStart, const int32& InLength, const int32& InTupleSize = 1)
+{
+	if (!OutDest || InStart < 0 || InLength < 0 || InTupleSize <= 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const int32 First = InStart * InTupleSize;
+	const int32 Count = InLength * InTupleSize;
+	if (First + Count > InSource.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	for (int32 Idx = 0; Idx < Count; Idx++)
+		OutDest[Idx] = (TDest)InSource[First + Idx];
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static FHoudiniMockPart* HoudiniMockFindPart(HAPI_NodeId node_id, HAPI_PartId part_id)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	return Mock ? Mock->FindPart(node_id, part_id) : nullptr;
+}
+
+static const FHoudiniMockAttribute* HoudiniMockFindAttribute(HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeOwner owner)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part || !name || owner < 0 || owner >= HAPI_ATTROWNER_MAX)
+		return nullptr;
+
+	return Part->Attributes[owner].Find(UTF8_TO_TCHAR(name));
+}
+
+static HAPI_Result HoudiniMock_GetGeoInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GeoInfo * geo_info)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockGeo* Geo = Mock ? Mock->FindGeo(node_id) : nullptr;
+	if (!Geo || !geo_info)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*geo_info = Geo->Info;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetPartInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartInfo * part_info)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part || !part_info)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*part_info = Part->Info;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetAttributeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeOwner owner, HAPI_AttributeInfo * attr_info)
+{
+	if (!attr_info || !HoudiniMockFindPart(node_id, part_id))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	// Like HAPI, missing attributes are not an error
+	const FHoudiniMockAttribute* Attribute = HoudiniMockFindAttribute(node_id, part_id, name, owner);
+	if (!Attribute)
+	{
+		FMemory::Memzero(*attr_info);
+		attr_info->exists = false;
+		attr_info->owner = owner;
+		attr_info->storage = HAPI_STORAGETYPE_INVALID;
+		attr_info->originalOwner = HAPI_ATTROWNER_INVALID;
+		attr_info->typeInfo = HAPI_ATTRIBUTE_TYPE_INVALID;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	*attr_info = Attribute->Info;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetAttributeNames(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_AttributeOwner owner, HAPI_StringHandle * attribute_names_array, int count)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Mock || !Part || !attribute_names_array || owner < 0 || owner >= HAPI_ATTROWNER_MAX)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	if (count != Part->Attributes[owner].Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	int32 Idx = 0;
+	for (const auto& CurrentAttribute : Part->Attributes[owner])
+		attribute_names_array[Idx++] = Mock->FindStringHandle(CurrentAttribute.Key);
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetAttributeFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, float * data_array, int start, int length)
+{
+	if (!attr_info)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const FHoudiniMockAttribute* Attribute = HoudiniMockFindAttribute(node_id, part_id, name, attr_info->owner);
+	if (!Attribute)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const int32 TupleSize = Attribute->Info.tupleSize;
+	if (stride >= 0 && stride != TupleSize)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	// Int attributes are converted, like HAPI does
+	if (Attribute->Info.storage == HAPI_STORAGETYPE_FLOAT)
+		return HoudiniMockCopyRange(Attribute->FloatData, data_array, start, length, TupleSize);
+	else if (Attribute->Info.storage == HAPI_STORAGETYPE_INT)
+		return HoudiniMockCopyRange(Attribute->IntData, data_array, start, length, TupleSize);
+
+	return HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+static HAPI_Result HoudiniMock_GetAttributeIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, int * data_array, int start, int length)
+{
+	if (!attr_info)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const FHoudiniMockAttribute* Attribute = HoudiniMockFindAttribute(node_id, part_id, name, attr_info->owner);
+	if (!Attribute)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const int32 TupleSize = Attribute->Info.tupleSize;
+	if (stride >= 0 && stride != TupleSize)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	if (Attribute->Info.storage == HAPI_STORAGETYPE_INT)
+		return HoudiniMockCopyRange(Attribute->IntData, data_array, start, length, TupleSize);
+	else if (Attribute->Info.storage == HAPI_STORAGETYPE_FLOAT)
+		return HoudiniMockCopyRange(Attribute->FloatData, data_array, start, length, TupleSize);
+
+	return HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+static HAPI_Result HoudiniMock_GetAttributeStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_array, int start, int length)
+{
+	if (!attr_info)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const FHoudiniMockAttribute* Attribute = HoudiniMockFindAttribute(node_id, part_id, name, attr_info->owner);
+	if (!Attribute || Attribute->Info.storage != HAPI_STORAGETYPE_STRING)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Attribute->StringData, data_array, start, length, Attribute->Info.tupleSize);
+}
+
+static HAPI_Result HoudiniMock_GetFaceCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * face_counts_array, int start, int length)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Part->FaceCounts, face_counts_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetVertexList(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * vertex_list_array, int start, int length)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Part->VertexList, vertex_list_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetMaterialNodeIdsOnFaces(const HAPI_Session * session, HAPI_NodeId geometry_node_id, HAPI_PartId part_id, HAPI_Bool * are_all_the_same, HAPI_NodeId * material_ids_array, int start, int length)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(geometry_node_id, part_id);
+	if (!Part || !are_all_the_same || !material_ids_array)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	if (Part->FaceMaterialIds.Num() <= 0)
+	{
+		// No material on this part
+		*are_all_the_same = true;
+		for (int32 Idx = 0; Idx < length; Idx++)
+			material_ids_array[Idx] = -1;
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	HAPI_Result Result = HoudiniMockCopyRange(Part->FaceMaterialIds, material_ids_array, start, length);
+	if (Result != HAPI_RESULT_SUCCESS)
+		return Result;
+
+	*are_all_the_same = true;
+	for (int32 Idx = 1; Idx < length; Idx++)
+	{
+		if (material_ids_array[Idx] != material_ids_array[0])
+		{
+			*are_all_the_same = false;
+			break;
+		}
+	}
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetGroupNames(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GroupType group_type, HAPI_StringHandle * group_names_array, int group_count)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockGeo* Geo = Mock ? Mock->FindGeo(node_id) : nullptr;
+	if (!Geo || !group_names_array || group_type < 0 || group_type >= HAPI_GROUPTYPE_MAX)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const TArray<FString>& GroupNames = Geo->GroupNames[group_type];
+	if (group_count > GroupNames.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	for (int32 Idx = 0; Idx < group_count; Idx++)
+		group_names_array[Idx] = Mock->FindStringHandle(GroupNames[Idx]);
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetGroupMembership(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name, HAPI_Bool * membership_array_all_equal, int * membership_array, int start, int length)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part || !group_name || group_type < 0 || group_type >= HAPI_GROUPTYPE_MAX)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const TArray<int32>* Membership = Part->GroupMembership[group_type].Find(UTF8_TO_TCHAR(group_name));
+	if (!Membership)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	HAPI_Result Result = HoudiniMockCopyRange(*Membership, membership_array, start, length);
+	if (Result != HAPI_RESULT_SUCCESS)
+		return Result;
+
+	if (membership_array_all_equal)
+	{
+		*membership_array_all_equal = true;
+		for (int32 Idx = 1; Idx < length; Idx++)
+		{
+			if (membership_array[Idx] != membership_array[0])
+			{
+				*membership_array_all_equal = false;
+				break;
+			}
+		}
+	}
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetStringBufLength(const HAPI_Session * session, HAPI_StringHandle string_handle, int * buffer_length)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	const FString* String = Mock ? Mock->FindString(string_handle) : nullptr;
+	if (!String || !buffer_length)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FTCHARToUTF8 Converted(**String);
+	*buffer_length = Converted.Length() + 1;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetString(const HAPI_Session * session, HAPI_StringHandle string_handle, char * string_value, int length)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	const FString* String = Mock ? Mock->FindString(string_handle) : nullptr;
+	if (!String || !string_value || length <= 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FTCHARToUTF8 Converted(**String);
+	const int32 CopyLength = FMath::Min(Converted.Length(), length - 1);
+	FMemory::Memcpy(string_value, Converted.Get(), CopyLength);
+	string_value[CopyLength] = '\0';
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetStringBatchSize(const HAPI_Session * session, const int * string_handle_array, int string_handle_count, int * string_buffer_size)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	if (!Mock || !string_buffer_size)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return Mock->GetStringBatch(string_handle_array, string_handle_count, *string_buffer_size) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+static HAPI_Result HoudiniMock_GetStringBatch(const HAPI_Session * session, char * char_buffer, int char_array_length)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	if (!Mock)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return Mock->CopyStringBatch(char_buffer, char_array_length) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+static HAPI_Result HoudiniMock_GetVolumeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeInfo * volume_info)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part || !volume_info || Part->Info.type != HAPI_PARTTYPE_VOLUME)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*volume_info = Part->VolumeInfo;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetVolumeBounds(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * x_min, float * y_min, float * z_min, float * x_max, float * y_max, float * z_max, float * x_center, float * y_center, float * z_center)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part || Part->Info.type != HAPI_PARTTYPE_VOLUME)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	// Volumes span [-1, 1] in their local space
+	const HAPI_Transform& Transform = Part->VolumeInfo.transform;
+	const float Center[3] = { Transform.position[0], Transform.position[1], Transform.position[2] };
+	const float Extent[3] = { FMath::Abs(Transform.scale[0]), FMath::Abs(Transform.scale[1]), FMath::Abs(Transform.scale[2]) };
+	if (x_min) *x_min = Center[0] - Extent[0];
+	if (y_min) *y_min = Center[1] - Extent[1];
+	if (z_min) *z_min = Center[2] - Extent[2];
+	if (x_max) *x_max = Center[0] + Extent[0];
+	if (y_max) *y_max = Center[1] + Extent[1];
+	if (z_max) *z_max = Center[2] + Extent[2];
+	if (x_center) *x_center = Center[0];
+	if (y_center) *y_center = Center[1];
+	if (z_center) *z_center = Center[2];
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetHeightFieldData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * values_array, int start, int length)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Part->HeightfieldData, values_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetInstancedPartIds(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartId * instanced_parts_array, int start, int length)
+{
+	FHoudiniMockPart* Part = HoudiniMockFindPart(node_id, part_id);
+	if (!Part)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Part->InstancedPartIds, instanced_parts_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetInstanceTransforms(FHoudiniMockPart* Part, HAPI_RSTOrder rst_order, HAPI_Transform * transforms_array, int start, int length)
+{
+	if (!Part || !transforms_array)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	if (Part->InstanceTransforms.Num() > 0)
+	{
+		HAPI_Result Result = HoudiniMockCopyRange(Part->InstanceTransforms, transforms_array, start, length);
+		for (int32 Idx = 0; Result == HAPI_RESULT_SUCCESS && Idx < length; Idx++)
+			transforms_array[Idx].rstOrder = rst_order;
+
+		return Result;
+	}
+
+	// Without recorded transforms, the instances are placed on the points
+	const FHoudiniMockAttribute* Positions = Part->Attributes[HAPI_ATTROWNER_POINT].Find(TEXT(HAPI_UNREAL_ATTRIB_POSITION));
+	if (!Positions || Positions->Info.tupleSize != 3 || (start + length) * 3 > Positions->FloatData.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	for (int32 Idx = 0; Idx < length; Idx++)
+	{
+		HAPI_Transform& Transform = transforms_array[Idx];
+		FMemory::Memzero(Transform);
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Transform.position[Axis] = Positions->FloatData[(start + Idx) * 3 + Axis];
+			Transform.scale[Axis] = 1.0f;
+		}
+		Transform.rotationQuaternion[3] = 1.0f;
+		Transform.rstOrder = rst_order;
+	}
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetInstancerPartTransforms(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, HAPI_Transform * transforms_array, int start, int length)
+{
+	return HoudiniMock_GetInstanceTransforms(HoudiniMockFindPart(node_id, part_id), rst_order, transforms_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetInstanceTransformsOnPart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, HAPI_Transform * transforms_array, int start, int length)
+{
+	return HoudiniMock_GetInstanceTransforms(HoudiniMockFindPart(node_id, part_id), rst_order, transforms_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetNodeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeInfo * node_info)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node || !node_info)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*node_info = Node->Info;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetAvailableAssetCount(const HAPI_Session * session, HAPI_AssetLibraryId library_id, int * asset_count)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	const TArray<HAPI_StringHandle>* AssetNames = Mock ? Mock->FindAssetLibrary(library_id) : nullptr;
+	if (!AssetNames || !asset_count)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*asset_count = AssetNames->Num();
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetAvailableAssets(const HAPI_Session * session, HAPI_AssetLibraryId library_id, HAPI_StringHandle * asset_names_array, int asset_count)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	const TArray<HAPI_StringHandle>* AssetNames = Mock ? Mock->FindAssetLibrary(library_id) : nullptr;
+	if (!AssetNames)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(*AssetNames, asset_names_array, 0, asset_count);
+}
+
+static HAPI_Result HoudiniMock_CreateInputNode(const HAPI_Session * session, HAPI_NodeId * node_id, const char * name)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	if (!Mock || !node_id)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*node_id = Mock->CreateInputNode(name ? UTF8_TO_TCHAR(name) : TEXT("input"));
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_IsNodeValid(const HAPI_Session * session, HAPI_NodeId node_id, int unique_node_id, HAPI_Bool * answer)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	if (!Mock || !answer)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FHoudiniMockNode* Node = Mock->FindNode(node_id);
+	*answer = Node && Node->Info.uniqueHoudiniNodeId == unique_node_id;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_DeleteNode(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	if (!Mock || !Mock->DeleteNode(node_id))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_RenameNode(const HAPI_Session * session, HAPI_NodeId node_id, const char * new_name)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	if (!Mock || !new_name || !Mock->RenameNode(node_id, UTF8_TO_TCHAR(new_name)))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_DisconnectNodeOutputsAt(const HAPI_Session * session, HAPI_NodeId node_id, int output_index)
+{
+	// The mock doesn't keep track of the connections
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	return (Mock && Mock->FindNode(node_id)) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+static HAPI_Result HoudiniMock_SetPartInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_PartInfo * part_info)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	if (!Mock || !part_info || !Mock->SetPartInfo(node_id, part_id, *part_info))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_CommitGeo(const HAPI_Session * session, HAPI_NodeId node_id)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	return (Mock && Mock->FindGeo(node_id)) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+static HAPI_Result HoudiniMock_SetObjectTransform(const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_TransformEuler * trans)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node || !trans || Node->Info.type != HAPI_NODETYPE_OBJ)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetAssetInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_AssetInfo * asset_info)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node || !asset_info)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*asset_info = Node->AssetInfo;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetParameters(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmInfo * parm_infos_array, int start, int length)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Node->Parms, parm_infos_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetParmIntValues(const HAPI_Session * session, HAPI_NodeId node_id, int * values_array, int start, int length)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Node->ParmIntValues, values_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetParmFloatValues(const HAPI_Session * session, HAPI_NodeId node_id, float * values_array, int start, int length)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Node->ParmFloatValues, values_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetParmStringValues(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_Bool evaluate, HAPI_StringHandle * values_array, int start, int length)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Node->ParmStringValues, values_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetParmChoiceLists(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmChoiceInfo * parm_choices_array, int start, int length)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	return HoudiniMockCopyRange(Node->ParmChoices, parm_choices_array, start, length);
+}
+
+static HAPI_Result HoudiniMock_GetParmIdFromName(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_ParmId * parm_id)
+{
+	FHoudiniMockApi* Mock = FHoudiniMockApi::GetActive();
+	FHoudiniMockNode* Node = Mock ? Mock->FindNode(node_id) : nullptr;
+	if (!Node || !parm_name || !parm_id)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const FString ParmName = UTF8_TO_TCHAR(parm_name);
+	for (const HAPI_ParmInfo& ParmInfo : Node->Parms)
+	{
+		const FString* Name = Mock->FindString(ParmInfo.nameSH);
+		if (Name && Name->Equals(ParmName))
+		{
+			*parm_id = ParmInfo.id;
+			return HAPI_RESULT_SUCCESS;
+		}
+	}
+
+	*parm_id = -1;
+	return HAPI_RESULT_SUCCESS;
+}
+
+// Parameter tags are not recorded
+static HAPI_Result HoudiniMock_ParmHasTag(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, const char * tag_name, HAPI_Bool * has_tag)
+{
+	if (!has_tag)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*has_tag = false;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetParmTagName(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int tag_index, HAPI_StringHandle * tag_name)
+{
+	return HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+static HAPI_Result HoudiniMock_GetParmTagValue(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, const char * tag_name, HAPI_StringHandle * tag_value)
+{
+	return HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+// Parameter expressions are not recorded
+static HAPI_Result HoudiniMock_ParmHasExpression(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, HAPI_Bool * has_expression)
+{
+	if (!has_expression)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*has_expression = false;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMock_GetParmExpression(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, HAPI_StringHandle * value)
+{
+	return HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+// Struct initializers, as the empty stubs leave the structs untouched when libHAPI isn't loaded
+static void HoudiniMock_AttributeInfo_Init(HAPI_AttributeInfo * in)
+{
+	FMemory::Memzero(*in);
+	in->owner = HAPI_ATTROWNER_INVALID;
+	in->storage = HAPI_STORAGETYPE_INVALID;
+	in->originalOwner = HAPI_ATTROWNER_INVALID;
+	in->typeInfo = HAPI_ATTRIBUTE_TYPE_INVALID;
+}
+
+static void HoudiniMock_GeoInfo_Init(HAPI_GeoInfo * in)
+{
+	FMemory::Memzero(*in);
+	in->type = HAPI_GEOTYPE_INVALID;
+	in->nodeId = -1;
+}
+
+static void HoudiniMock_PartInfo_Init(HAPI_PartInfo * in)
+{
+	FMemory::Memzero(*in);
+	in->id = -1;
+	in->type = HAPI_PARTTYPE_INVALID;
+}
+
+static void HoudiniMock_Transform_Init(HAPI_Transform * in)
+{
+	FMemory::Memzero(*in);
+	in->rotationQuaternion[3] = 1.0f;
+	in->scale[0] = in->scale[1] = in->scale[2] = 1.0f;
+	in->rstOrder = HAPI_SRT;
+}
+
+static void HoudiniMock_TransformEuler_Init(HAPI_TransformEuler * in)
+{
+	FMemory::Memzero(*in);
+	in->scale[0] = in->scale[1] = in->scale[2] = 1.0f;
+	in->rotationOrder = HAPI_XYZ;
+	in->rstOrder = HAPI_SRT;
+}
+
+static void HoudiniMock_VolumeInfo_Init(HAPI_VolumeInfo * in)
+{
+	FMemory::Memzero(*in);
+	in->type = HAPI_VOLUMETYPE_INVALID;
+	in->storage = HAPI_STORAGETYPE_INVALID;
+	HoudiniMock_Transform_Init(&in->transform);
+}
+
+static void HoudiniMock_NodeInfo_Init(HAPI_NodeInfo * in)
+{
+	FMemory::Memzero(*in);
+	in->id = -1;
+	in->parentId = -1;
+}
+
+static void HoudiniMock_AssetInfo_Init(HAPI_AssetInfo * in)
+{
+	FMemory::Memzero(*in);
+	in->nodeId = -1;
+	in->objectNodeId = -1;
+}
+
+static void HoudiniMock_ParmInfo_Init(HAPI_ParmInfo * in)
+{
+	FMemory::Memzero(*in);
+	in->id = -1;
+	in->parentId = -1;
+	in->intValuesIndex = -1;
+	in->floatValuesIndex = -1;
+	in->stringValuesIndex = -1;
+	in->choiceIndex = -1;
+}
+
+static void HoudiniMock_ParmChoiceInfo_Init(HAPI_ParmChoiceInfo * in)
+{
+	FMemory::Memzero(*in);
+	in->parentParmId = -1;
+}
+
+// All the functions replaced by the mock.
+// Session functions are left untouched so the engine doesn't consider the mock as a running session.
+#define HOUDINI_MOCK_API_FUNCTIONS(X) \
+	X(GetGeoInfo) \
+	X(GetPartInfo) \
+	X(GetAttributeInfo) \
+	X(GetAttributeNames) \
+	X(GetAttributeFloatData) \
+	X(GetAttributeIntData) \
+	X(GetAttributeStringData) \
+	X(GetFaceCounts) \
+	X(GetVertexList) \
+	X(GetMaterialNodeIdsOnFaces) \
+	X(GetGroupNames) \
+	X(GetGroupMembership) \
+	X(GetStringBufLength) \
+	X(GetString) \
+	X(GetStringBatchSize) \
+	X(GetStringBatch) \
+	X(GetVolumeInfo) \
+	X(GetVolumeBounds) \
+	X(GetHeightFieldData) \
+	X(GetInstancedPartIds) \
+	X(GetInstancerPartTransforms) \
+	X(GetInstanceTransformsOnPart) \
+	X(GetNodeInfo) \
+	X(GetAssetInfo) \
+	X(GetParameters) \
+	X(GetParmIntValues) \
+	X(GetParmFloatValues) \
+	X(GetParmStringValues) \
+	X(GetParmChoiceLists) \
+	X(GetParmIdFromName) \
+	X(ParmHasTag) \
+	X(GetParmTagName) \
+	X(GetParmTagValue) \
+	X(ParmHasExpression) \
+	X(GetParmExpression) \
+	X(GetAvailableAssetCount) \
+	X(GetAvailableAssets) \
+	X(CreateInputNode) \
+	X(IsNodeValid) \
+	X(DeleteNode) \
+	X(RenameNode) \
+	X(DisconnectNodeOutputsAt) \
+	X(SetPartInfo) \
+	X(CommitGeo) \
+	X(SetObjectTransform) \
+	X(AttributeInfo_Init) \
+	X(GeoInfo_Init) \
+	X(PartInfo_Init) \
+	X(Transform_Init) \
+	X(TransformEuler_Init) \
+	X(VolumeInfo_Init) \
+	X(NodeInfo_Init) \
+	X(AssetInfo_Init) \
+	X(ParmInfo_Init) \
+	X(ParmChoiceInfo_Init)
+
+// The live function pointers, restored when the mock is uninstalled
+struct FHoudiniMockSavedApi
+{
+#define HOUDINI_MOCK_API_SAVED_POINTER(Name) FHoudiniApi::Name##FuncPtr Name = nullptr;
+	HOUDINI_MOCK_API_FUNCTIONS(HOUDINI_MOCK_API_SAVED_POINTER)
+#undef HOUDINI_MOCK_API_SAVED_POINTER
+};
+
+static FHoudiniMockSavedApi HoudiniMockSavedApi;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// FHoudiniMockApi
+//-----------------------------------------------------------------------------------------------------------------------------
+
+FHoudiniMockApi::FHoudiniMockApi()
+{
+	Reset();
+}
+
+FHoudiniMockApi::~FHoudiniMockApi()
+{
+	if (IsInstalled())
+		Uninstall();
+}
+
+void
+FHoudiniMockApi::Reset()
+{
+	Strings.Empty();
+	StringHandles.Empty();
+	Geos.Empty();
+	Nodes.Empty();
+	AssetLibraries.Empty();
+	PendingStringBatches.Empty();
+	NextNodeId = HoudiniMockCreatedNodeIdBase;
+
+	// Handle 0 is invalid for HAPI
+	Strings.Add(FString());
+}
+
+HAPI_StringHandle
+FHoudiniMockApi::AddString(const FString& InString)
+{
+	if (const HAPI_StringHandle* FoundHandle = StringHandles.Find(InString))
+		return *FoundHandle;
+
+	const HAPI_StringHandle NewHandle = Strings.Add(InString);
+	StringHandles.Add(InString, NewHandle);
+	return NewHandle;
+}
+
+HAPI_StringHandle
+FHoudiniMockApi::FindStringHandle(const FString& InString) const
+{
+	const HAPI_StringHandle* FoundHandle = StringHandles.Find(InString);
+	return FoundHandle ? *FoundHandle : 0;
+}
+
+const FString*
+FHoudiniMockApi::FindString(const HAPI_StringHandle& InHandle) const
+{
+	return (InHandle > 0 && Strings.IsValidIndex(InHandle)) ? &Strings[InHandle] : nullptr;
+}
+
+FHoudiniMockGeo&
+FHoudiniMockApi::AddGeo(const HAPI_NodeId& InGeoId, const FString& InName)
+{
+	FHoudiniMockGeo& Geo = Geos.FindOrAdd(InGeoId);
+	HoudiniMock_GeoInfo_Init(&Geo.Info);
+	Geo.Info.type = HAPI_GEOTYPE_DEFAULT;
+	Geo.Info.nameSH = AddString(InName);
+	Geo.Info.nodeId = InGeoId;
+	Geo.Info.isDisplayGeo = true;
+	Geo.Info.hasGeoChanged = true;
+	Geo.Info.partCount = Geo.Parts.Num();
+	return Geo;
+}
+
+FHoudiniMockPart&
+FHoudiniMockApi::AddPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const FString& InName, const HAPI_PartType& InType)
+{
+	FHoudiniMockGeo* Geo = FindGeo(InGeoId);
+	if (!Geo)
+		Geo = &AddGeo(InGeoId, FString::Printf(TEXT("geo%d"), InGeoId));
+
+	FHoudiniMockPart& Part = Geo->Parts.FindOrAdd(InPartId);
+	HoudiniMock_PartInfo_Init(&Part.Info);
+	Part.Info.id = InPartId;
+	Part.Info.nameSH = AddString(InName);
+	Part.Info.type = InType;
+	Part.Info.hasChanged = true;
+	HoudiniMock_VolumeInfo_Init(&Part.VolumeInfo);
+
+	Geo->Info.partCount = Geo->Parts.Num();
+	return Part;
+}
+
+FHoudiniMockGeo*
+FHoudiniMockApi::FindGeo(const HAPI_NodeId& InGeoId)
+{
+	return Geos.Find(InGeoId);
+}
+
+FHoudiniMockPart*
+FHoudiniMockApi::FindPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId)
+{
+	FHoudiniMockGeo* Geo = Geos.Find(InGeoId);
+	return Geo ? Geo->Parts.Find(InPartId) : nullptr;
+}
+
+void
+FHoudiniMockApi::AddFloatAttribute(
+	FHoudiniMockPart& InPart, const FString& InName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize, const TArray<float>& InData)
+{
+	AddString(InName);
+	FHoudiniMockAttribute& Attribute = InPart.Attributes[InOwner].FindOrAdd(InName);
+	HoudiniMock_AttributeInfo_Init(&Attribute.Info);
+	Attribute.Info.exists = true;
+	Attribute.Info.owner = InOwner;
+	Attribute.Info.originalOwner = InOwner;
+	Attribute.Info.storage = HAPI_STORAGETYPE_FLOAT;
+	Attribute.Info.tupleSize = InTupleSize;
+	Attribute.Info.count = InTupleSize > 0 ? InData.Num() / InTupleSize : 0;
+	Attribute.FloatData = InData;
+}
+
+void
+FHoudiniMockApi::AddIntAttribute(
+	FHoudiniMockPart& InPart, const FString& InName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize, const TArray<int32>& InData)
+{
+	AddString(InName);
+	FHoudiniMockAttribute& Attribute = InPart.Attributes[InOwner].FindOrAdd(InName);
+	HoudiniMock_AttributeInfo_Init(&Attribute.Info);
+	Attribute.Info.exists = true;
+	Attribute.Info.owner = InOwner;
+	Attribute.Info.originalOwner = InOwner;
+	Attribute.Info.storage = HAPI_STORAGETYPE_INT;
+	Attribute.Info.tupleSize = InTupleSize;
+	Attribute.Info.count = InTupleSize > 0 ? InData.Num() / InTupleSize : 0;
+	Attribute.IntData = InData;
+}
+
+void
+FHoudiniMockApi::AddStringAttribute(
+	FHoudiniMockPart& InPart, const FString& InName, const HAPI_AttributeOwner& InOwner, const TArray<FString>& InData)
+{
+	AddString(InName);
+	FHoudiniMockAttribute& Attribute = InPart.Attributes[InOwner].FindOrAdd(InName);
+	HoudiniMock_AttributeInfo_Init(&Attribute.Info);
+	Attribute.Info.exists = true;
+	Attribute.Info.owner = InOwner;
+	Attribute.Info.originalOwner = InOwner;
+	Attribute.Info.storage = HAPI_STORAGETYPE_STRING;
+	Attribute.Info.tupleSize = 1;
+	Attribute.Info.count = InData.Num();
+
+	Attribute.StringData.SetNumUninitialized(InData.Num());
+	for (int32 Idx = 0; Idx < InData.Num(); Idx++)
+		Attribute.StringData[Idx] = AddString(InData[Idx]);
+}
+
+void
+FHoudiniMockApi::AddGroup(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const HAPI_GroupType& InType, const FString& InName, const TArray<int32>& InMembership)
+{
+	FHoudiniMockGeo* Geo = FindGeo(InGeoId);
+	FHoudiniMockPart* Part = FindPart(InGeoId, InPartId);
+	if (!Geo || !Part || InType < 0 || InType >= HAPI_GROUPTYPE_MAX)
+		return;
+
+	AddString(InName);
+	Geo->GroupNames[InType].AddUnique(InName);
+	Geo->Info.pointGroupCount = Geo->GroupNames[HAPI_GROUPTYPE_POINT].Num();
+	Geo->Info.primitiveGroupCount = Geo->GroupNames[HAPI_GROUPTYPE_PRIM].Num();
+	Geo->Info.edgeGroupCount = Geo->GroupNames[HAPI_GROUPTYPE_EDGE].Num();
+
+	Part->GroupMembership[InType].Add(InName, InMembership);
+}
+
+void
+FHoudiniMockApi::SetHeightfield(
+	FHoudiniMockPart& InPart, const FString& InVolumeName, const int32& InXLength, const int32& InYLength, const TArray<float>& InData, const HAPI_Transform& InTransform)
+{
+	InPart.Info.type = HAPI_PARTTYPE_VOLUME;
+
+	HoudiniMock_VolumeInfo_Init(&InPart.VolumeInfo);
+	InPart.VolumeInfo.nameSH = AddString(InVolumeName);
+	InPart.VolumeInfo.type = HAPI_VOLUMETYPE_HOUDINI;
+	InPart.VolumeInfo.xLength = InXLength;
+	InPart.VolumeInfo.yLength = InYLength;
+	InPart.VolumeInfo.zLength = 1;
+	InPart.VolumeInfo.tupleSize = 1;
+	InPart.VolumeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+	InPart.VolumeInfo.tileSize = 8;
+	InPart.VolumeInfo.transform = InTransform;
+
+	InPart.HeightfieldData = InData;
+
+	// Heightfields also have a name primitive attribute
+	TArray<FString> VolumeNames;
+	VolumeNames.Add(InVolumeName);
+	AddStringAttribute(InPart, TEXT(HAPI_ATTRIB_NAME), HAPI_ATTROWNER_PRIM, VolumeNames);
+}
+
+void
+FHoudiniMockApi::FinalizePart(FHoudiniMockPart& InPart)
+{
+	InPart.Info.faceCount = InPart.FaceCounts.Num();
+	InPart.Info.vertexCount = InPart.VertexList.Num();
+
+	const FHoudiniMockAttribute* Positions = InPart.Attributes[HAPI_ATTROWNER_POINT].Find(TEXT(HAPI_UNREAL_ATTRIB_POSITION));
+	InPart.Info.pointCount = Positions ? Positions->Info.count : 0;
+
+	for (int32 Owner = 0; Owner < HAPI_ATTROWNER_MAX; Owner++)
+		InPart.Info.attributeCounts[Owner] = InPart.Attributes[Owner].Num();
+
+	InPart.Info.instancedPartCount = InPart.InstancedPartIds.Num();
+	InPart.Info.instanceCount = InPart.InstanceTransforms.Num();
+	InPart.Info.isInstanced = false;
+}
+
+FHoudiniMockNode&
+FHoudiniMockApi::AddNode(const HAPI_NodeId& InNodeId, const FString& InName)
+{
+	FHoudiniMockNode& Node = Nodes.FindOrAdd(InNodeId);
+	HoudiniMock_NodeInfo_Init(&Node.Info);
+	Node.Info.id = InNodeId;
+	Node.Info.nameSH = AddString(InName);
+	Node.Info.internalNodePathSH = AddString(TEXT("/obj/") + InName);
+	Node.Info.type = HAPI_NODETYPE_OBJ;
+	Node.Info.isValid = true;
+	Node.Info.totalCookCount = 1;
+	Node.Info.uniqueHoudiniNodeId = InNodeId;
+
+	HoudiniMock_AssetInfo_Init(&Node.AssetInfo);
+	Node.AssetInfo.nodeId = InNodeId;
+	Node.AssetInfo.objectNodeId = InNodeId;
+	Node.AssetInfo.hasEverCooked = true;
+
+	return Node;
+}
+
+FHoudiniMockNode*
+FHoudiniMockApi::FindNode(const HAPI_NodeId& InNodeId)
+{
+	return Nodes.Find(InNodeId);
+}
+
+void
+FHoudiniMockApi::AddAssetLibrary(const HAPI_AssetLibraryId& InLibraryId, const TArray<FString>& InAssetNames)
+{
+	TArray<HAPI_StringHandle>& AssetNames = AssetLibraries.FindOrAdd(InLibraryId);
+	AssetNames.Empty();
+	for (const FString& AssetName : InAssetNames)
+		AssetNames.Add(AddString(AssetName));
+}
+
+const TArray<HAPI_StringHandle>*
+FHoudiniMockApi::FindAssetLibrary(const HAPI_AssetLibraryId& InLibraryId) const
+{
+	return AssetLibraries.Find(InLibraryId);
+}
+
+HAPI_NodeId
+FHoudiniMockApi::CreateInputNode(const FString& InName)
+{
+	const HAPI_NodeId ObjNodeId = NextNodeId++;
+	AddNode(ObjNodeId, InName);
+
+	const HAPI_NodeId SopNodeId = NextNodeId++;
+	FHoudiniMockNode& SopNode = AddNode(SopNodeId, TEXT("input"));
+	SopNode.Info.type = HAPI_NODETYPE_SOP;
+	SopNode.Info.parentId = ObjNodeId;
+	SopNode.Info.internalNodePathSH = AddString(TEXT("/obj/") + InName + TEXT("/input"));
+	SopNode.AssetInfo.objectNodeId = ObjNodeId;
+
+	FHoudiniMockNode* ObjNode = FindNode(ObjNodeId);
+	ObjNode->Info.childNodeCount = 1;
+
+	AddGeo(SopNodeId, TEXT("input"));
+	return SopNodeId;
+}
+
+bool
+FHoudiniMockApi::DeleteNode(const HAPI_NodeId& InNodeId)
+{
+	if (!Nodes.Remove(InNodeId))
+		return false;
+
+	Geos.Remove(InNodeId);
+
+	TArray<HAPI_NodeId> ChildNodeIds;
+	for (const auto& CurrentNode : Nodes)
+	{
+		if (CurrentNode.Value.Info.parentId == InNodeId)
+			ChildNodeIds.Add(CurrentNode.Key);
+	}
+
+	for (const HAPI_NodeId& ChildNodeId : ChildNodeIds)
+		DeleteNode(ChildNodeId);
+
+	return true;
+}
+
+bool
+FHoudiniMockApi::RenameNode(const HAPI_NodeId& InNodeId, const FString& InName)
+{
+	FHoudiniMockNode* Node = FindNode(InNodeId);
+	if (!Node)
+		return false;
+
+	Node->Info.nameSH = AddString(InName);
+	return true;
+}
+
+bool
+FHoudiniMockApi::SetPartInfo(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const HAPI_PartInfo& InPartInfo)
+{
+	FHoudiniMockGeo* Geo = FindGeo(InGeoId);
+	if (!Geo)
+		return false;
+
+	FHoudiniMockPart& Part = Geo->Parts.FindOrAdd(InPartId);
+	Part = FHoudiniMockPart();
+	Part.Info = InPartInfo;
+	Part.Info.id = InPartId;
+	HoudiniMock_VolumeInfo_Init(&Part.VolumeInfo);
+
+	Geo->Info.partCount = Geo->Parts.Num();
+	return true;
+}
+
+HAPI_ParmId
+FHoudiniMockApi::AddParm(
+	FHoudiniMockNode& InNode, const FString& InName, const HAPI_ParmType& InType, const int32& InSize, const HAPI_ParmId& InParentId)
+{
+	HAPI_ParmInfo ParmInfo;
+	HoudiniMock_ParmInfo_Init(&ParmInfo);
+
+	// Parm ids start at 0, and are ordered like the parm infos
+	ParmInfo.id = InNode.Parms.Num();
+	ParmInfo.parentId = InParentId;
+	ParmInfo.type = InType;
+	ParmInfo.size = InSize;
+	ParmInfo.nameSH = AddString(InName);
+	ParmInfo.labelSH = AddString(InName);
+	ParmInfo.templateNameSH = ParmInfo.nameSH;
+
+	// The child index is the index among the parent's children
+	int32 ChildIndex = 0;
+	for (const HAPI_ParmInfo& CurrentParm : InNode.Parms)
+	{
+		if (CurrentParm.parentId == InParentId)
+			ChildIndex++;
+	}
+	ParmInfo.childIndex = ChildIndex;
+
+	InNode.Parms.Add(ParmInfo);
+	InNode.Info.parmCount = InNode.Parms.Num();
+
+	return ParmInfo.id;
+}
+
+HAPI_ParmId
+FHoudiniMockApi::AddFloatParm(FHoudiniMockNode& InNode, const FString& InName, const TArray<float>& InValues, const HAPI_ParmId& InParentId)
+{
+	const HAPI_ParmId ParmId = AddParm(InNode, InName, HAPI_PARMTYPE_FLOAT, InValues.Num(), InParentId);
+	InNode.Parms[ParmId].floatValuesIndex = InNode.ParmFloatValues.Num();
+	InNode.ParmFloatValues.Append(InValues);
+	InNode.Info.parmFloatValueCount = InNode.ParmFloatValues.Num();
+	return ParmId;
+}
+
+HAPI_ParmId
+FHoudiniMockApi::AddIntParm(FHoudiniMockNode& InNode, const FString& InName, const TArray<int32>& InValues, const HAPI_ParmId& InParentId)
+{
+	const HAPI_ParmId ParmId = AddParm(InNode, InName, HAPI_PARMTYPE_INT, InValues.Num(), InParentId);
+	InNode.Parms[ParmId].intValuesIndex = InNode.ParmIntValues.Num();
+	InNode.ParmIntValues.Append(InValues);
+	InNode.Info.parmIntValueCount = InNode.ParmIntValues.Num();
+	return ParmId;
+}
+
+HAPI_ParmId
+FHoudiniMockApi::AddStringParm(FHoudiniMockNode& InNode, const FString& InName, const TArray<FString>& InValues, const HAPI_ParmId& InParentId)
+{
+	const HAPI_ParmId ParmId = AddParm(InNode, InName, HAPI_PARMTYPE_STRING, InValues.Num(), InParentId);
+	InNode.Parms[ParmId].stringValuesIndex = InNode.ParmStringValues.Num();
+	for (const FString& CurrentValue : InValues)
+		InNode.ParmStringValues.Add(AddString(CurrentValue));
+	InNode.Info.parmStringValueCount = InNode.ParmStringValues.Num();
+	return ParmId;
+}
+
+HAPI_ParmId
+FHoudiniMockApi::AddToggleParm(FHoudiniMockNode& InNode, const FString& InName, const bool& InValue, const HAPI_ParmId& InParentId)
+{
+	const HAPI_ParmId ParmId = AddParm(InNode, InName, HAPI_PARMTYPE_TOGGLE, 1, InParentId);
+	InNode.Parms[ParmId].intValuesIndex = InNode.ParmIntValues.Num();
+	InNode.ParmIntValues.Add(InValue ? 1 : 0);
+	InNode.Info.parmIntValueCount = InNode.ParmIntValues.Num();
+	return ParmId;
+}
+
+HAPI_ParmId
+FHoudiniMockApi::AddFolderListParm(FHoudiniMockNode& InNode, const FString& InName, const HAPI_ParmId& InParentId)
+{
+	// Folder lists store their folder count as an int value
+	const HAPI_ParmId ParmId = AddParm(InNode, InName, HAPI_PARMTYPE_FOLDERLIST, 0, InParentId);
+	InNode.Parms[ParmId].intValuesIndex = InNode.ParmIntValues.Num();
+	InNode.ParmIntValues.Add(0);
+	InNode.Info.parmIntValueCount = InNode.ParmIntValues.Num();
+	return ParmId;
+}
+
+HAPI_ParmId
+FHoudiniMockApi::AddFolderParm(FHoudiniMockNode& InNode, const FString& InName, const HAPI_ParmId& InParentId)
+{
+	const HAPI_ParmId ParmId = AddParm(InNode, InName, HAPI_PARMTYPE_FOLDER, 0, InParentId);
+	if (InNode.Parms.IsValidIndex(InParentId) && InNode.Parms[InParentId].type == HAPI_PARMTYPE_FOLDERLIST)
+	{
+		InNode.Parms[InParentId].size++;
+		InNode.ParmIntValues[InNode.Parms[InParentId].intValuesIndex]++;
+	}
+
+	return ParmId;
+}
+
+HAPI_StringHandle
+FHoudiniMockApi::RecordString(const HAPI_StringHandle& InLiveHandle)
+{
+	if (InLiveHandle <= 0)
+		return 0;
+
+	FString Value;
+	FHoudiniEngineString::ToFString(InLiveHandle, Value);
+	return AddString(Value);
+}
+
+bool
+FHoudiniMockApi::RecordGeo(const HAPI_NodeId& InGeoId)
+{
+	if (ActiveMock)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Cannot record geo %d while a mock HAPI is installed."), InGeoId);
+		return false;
+	}
+
+	HAPI_GeoInfo GeoInfo;
+	FHoudiniApi::GeoInfo_Init(&GeoInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetGeoInfo(
+		FHoudiniEngine::Get().GetSession(), InGeoId, &GeoInfo), false);
+
+	FHoudiniMockGeo& Geo = Geos.FindOrAdd(InGeoId);
+	Geo.Info = GeoInfo;
+	Geo.Info.nameSH = RecordString(GeoInfo.nameSH);
+
+	// Group names
+	const HAPI_GroupType GroupTypes[] = { HAPI_GROUPTYPE_POINT, HAPI_GROUPTYPE_PRIM };
+	for (const HAPI_GroupType& GroupType : GroupTypes)
+	{
+		Geo.GroupNames[GroupType].Empty();
+		FHoudiniEngineUtils::HapiGetGroupNames(InGeoId, 0, GroupType, false, Geo.GroupNames[GroupType]);
+		for (const FString& GroupName : Geo.GroupNames[GroupType])
+			AddString(GroupName);
+	}
+
+	bool bSuccess = true;
+	for (int32 PartId = 0; PartId < GeoInfo.partCount; PartId++)
+		bSuccess &= RecordPart(InGeoId, PartId);
+
+	return bSuccess;
+}
+
+bool
+FHoudiniMockApi::RecordPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId)
+{
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
+		FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, &PartInfo), false);
+
+	FHoudiniMockGeo& Geo = Geos.FindOrAdd(InGeoId);
+	FHoudiniMockPart& Part = Geo.Parts.FindOrAdd(InPartId);
+	Part.Info = PartInfo;
+	Part.Info.nameSH = RecordString(PartInfo.nameSH);
+	HoudiniMock_VolumeInfo_Init(&Part.VolumeInfo);
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	// Topology
+	Part.FaceCounts.SetNumZeroed(PartInfo.faceCount);
+	if (PartInfo.faceCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetFaceCounts(
+			Session, InGeoId, InPartId, Part.FaceCounts.GetData(), 0, PartInfo.faceCount), false);
+
+		HAPI_Bool bAllSame = false;
+		Part.FaceMaterialIds.SetNumZeroed(PartInfo.faceCount);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetMaterialNodeIdsOnFaces(
+			Session, InGeoId, InPartId, &bAllSame, Part.FaceMaterialIds.GetData(), 0, PartInfo.faceCount))
+		{
+			Part.FaceMaterialIds.Empty();
+		}
+	}
+
+	Part.VertexList.SetNumZeroed(PartInfo.vertexCount);
+	if (PartInfo.vertexCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetVertexList(
+			Session, InGeoId, InPartId, Part.VertexList.GetData(), 0, PartInfo.vertexCount), false);
+	}
+
+	// Attributes
+	for (int32 Owner = 0; Owner < HAPI_ATTROWNER_MAX; Owner++)
+		RecordAttributes(InGeoId, Part, (HAPI_AttributeOwner)Owner);
+
+	// Group membership
+	for (int32 GroupType = 0; GroupType < HAPI_GROUPTYPE_MAX; GroupType++)
+	{
+		Part.GroupMembership[GroupType].Empty();
+		const int32 ElementCount = GroupType == HAPI_GROUPTYPE_POINT ? PartInfo.pointCount : PartInfo.faceCount;
+		if (GroupType == HAPI_GROUPTYPE_EDGE || ElementCount <= 0)
+			continue;
+
+		for (const FString& GroupName : Geo.GroupNames[GroupType])
+		{
+			TArray<int32> Membership;
+			Membership.SetNumZeroed(ElementCount);
+			HAPI_Bool bAllEqual = false;
+			if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetGroupMembership(
+				Session, InGeoId, InPartId, (HAPI_GroupType)GroupType, TCHAR_TO_UTF8(*GroupName), &bAllEqual, Membership.GetData(), 0, ElementCount))
+			{
+				Part.GroupMembership[GroupType].Add(GroupName, Membership);
+			}
+		}
+	}
+
+	// Heightfields
+	if (PartInfo.type == HAPI_PARTTYPE_VOLUME)
+	{
+		HAPI_VolumeInfo VolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&VolumeInfo);
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetVolumeInfo(Session, InGeoId, InPartId, &VolumeInfo))
+		{
+			Part.VolumeInfo = VolumeInfo;
+			Part.VolumeInfo.nameSH = RecordString(VolumeInfo.nameSH);
+
+			if (VolumeInfo.zLength == 1 && VolumeInfo.tupleSize == 1 && VolumeInfo.storage == HAPI_STORAGETYPE_FLOAT)
+			{
+				Part.HeightfieldData.SetNumZeroed(VolumeInfo.xLength * VolumeInfo.yLength);
+				FHoudiniEngineUtils::HapiGetHeightFieldData(InGeoId, InPartId, Part.HeightfieldData);
+			}
+		}
+	}
+
+	// Instancers
+	if (PartInfo.type == HAPI_PARTTYPE_INSTANCER && PartInfo.instancedPartCount > 0)
+	{
+		Part.InstancedPartIds.SetNumZeroed(PartInfo.instancedPartCount);
+		FHoudiniApi::GetInstancedPartIds(Session, InGeoId, InPartId, Part.InstancedPartIds.GetData(), 0, PartInfo.instancedPartCount);
+
+		Part.InstanceTransforms.SetNumZeroed(PartInfo.instanceCount);
+		if (PartInfo.instanceCount > 0)
+		{
+			FHoudiniApi::GetInstancerPartTransforms(
+				Session, InGeoId, InPartId, HAPI_SRT, Part.InstanceTransforms.GetData(), 0, PartInfo.instanceCount);
+		}
+	}
+	else if (PartInfo.pointCount > 0 && PartInfo.type == HAPI_PARTTYPE_MESH && PartInfo.faceCount <= 0)
+	{
+		// Point clouds can be used as attribute instancers
+		TArray<HAPI_Transform> InstanceTransforms;
+		InstanceTransforms.SetNumZeroed(PartInfo.pointCount);
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetInstanceTransformsOnPart(
+			Session, InGeoId, InPartId, HAPI_SRT, InstanceTransforms.GetData(), 0, PartInfo.pointCount))
+		{
+			Part.InstanceTransforms = InstanceTransforms;
+		}
+	}
+
+	Geo.Info.partCount = Geo.Parts.Num();
+
+	return true;
+}
+
+bool
+FHoudiniMockApi::RecordAttributes(const HAPI_NodeId& InGeoId, FHoudiniMockPart& InPart, const HAPI_AttributeOwner& InOwner)
+{
+	InPart.Attributes[InOwner].Empty();
+
+	const int32 AttributeCount = InPart.Info.attributeCounts[InOwner];
+	if (AttributeCount <= 0)
+		return true;
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	const HAPI_PartId PartId = InPart.Info.id;
+
+	TArray<HAPI_StringHandle> NameHandles;
+	NameHandles.SetNumZeroed(AttributeCount);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
+		Session, InGeoId, PartId, InOwner, NameHandles.GetData(), AttributeCount), false);
+
+	TArray<FString> Names;
+	FHoudiniEngineString::SHArrayToFStringArray(NameHandles, Names);
+
+	for (const FString& Name : Names)
+	{
+		HAPI_AttributeInfo AttributeInfo;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+			Session, InGeoId, PartId, TCHAR_TO_UTF8(*Name), InOwner, &AttributeInfo) || !AttributeInfo.exists)
+			continue;
+
+		// Array attributes are not recorded
+		const int32 ValueCount = AttributeInfo.count * AttributeInfo.tupleSize;
+		if (ValueCount <= 0 || AttributeInfo.totalArrayElements > 0)
+			continue;
+
+		FHoudiniMockAttribute Attribute;
+		Attribute.Info = AttributeInfo;
+
+		HAPI_Result Result = HAPI_RESULT_FAILURE;
+		if (AttributeInfo.storage == HAPI_STORAGETYPE_FLOAT)
+		{
+			Attribute.FloatData.SetNumZeroed(ValueCount);
+			Result = FHoudiniApi::GetAttributeFloatData(
+				Session, InGeoId, PartId, TCHAR_TO_UTF8(*Name), &AttributeInfo, -1, Attribute.FloatData.GetData(), 0, AttributeInfo.count);
+		}
+		else if (AttributeInfo.storage == HAPI_STORAGETYPE_INT)
+		{
+			Attribute.IntData.SetNumZeroed(ValueCount);
+			Result = FHoudiniApi::GetAttributeIntData(
+				Session, InGeoId, PartId, TCHAR_TO_UTF8(*Name), &AttributeInfo, -1, Attribute.IntData.GetData(), 0, AttributeInfo.count);
+		}
+		else if (AttributeInfo.storage == HAPI_STORAGETYPE_STRING)
+		{
+			TArray<HAPI_StringHandle> LiveHandles;
+			LiveHandles.SetNumZeroed(ValueCount);
+			Result = FHoudiniApi::GetAttributeStringData(
+				Session, InGeoId, PartId, TCHAR_TO_UTF8(*Name), &AttributeInfo, LiveHandles.GetData(), 0, AttributeInfo.count);
+
+			TArray<FString> Values;
+			FHoudiniEngineString::SHArrayToFStringArray(LiveHandles, Values);
+			Attribute.StringData.SetNumZeroed(Values.Num());
+			for (int32 Idx = 0; Idx < Values.Num(); Idx++)
+				Attribute.StringData[Idx] = AddString(Values[Idx]);
+		}
+
+		if (Result != HAPI_RESULT_SUCCESS)
+			continue;
+
+		AddString(Name);
+		InPart.Attributes[InOwner].Add(Name, Attribute);
+	}
+
+	// Skipped attributes must not be listed
+	InPart.Info.attributeCounts[InOwner] = InPart.Attributes[InOwner].Num();
+
+	return true;
+}
+
+bool
+FHoudiniMockApi::RecordNodeParameters(const HAPI_NodeId& InNodeId)
+{
+	if (ActiveMock)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Cannot record node %d while a mock HAPI is installed."), InNodeId);
+		return false;
+	}
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	HAPI_NodeInfo NodeInfo;
+	FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetNodeInfo(Session, InNodeId, &NodeInfo), false);
+
+	FHoudiniMockNode& Node = Nodes.FindOrAdd(InNodeId);
+	Node.Info = NodeInfo;
+	Node.Info.nameSH = RecordString(NodeInfo.nameSH);
+	Node.Info.internalNodePathSH = RecordString(NodeInfo.internalNodePathSH);
+
+	HoudiniMock_AssetInfo_Init(&Node.AssetInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAssetInfo(Session, InNodeId, &Node.AssetInfo))
+	{
+		// Not an asset, point the asset info to the node itself
+		HoudiniMock_AssetInfo_Init(&Node.AssetInfo);
+		Node.AssetInfo.nodeId = InNodeId;
+	}
+
+	Node.Parms.SetNumZeroed(NodeInfo.parmCount);
+	if (NodeInfo.parmCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParameters(
+			Session, InNodeId, Node.Parms.GetData(), 0, NodeInfo.parmCount), false);
+	}
+
+	for (HAPI_ParmInfo& ParmInfo : Node.Parms)
+	{
+		ParmInfo.typeInfoSH = RecordString(ParmInfo.typeInfoSH);
+		ParmInfo.nameSH = RecordString(ParmInfo.nameSH);
+		ParmInfo.labelSH = RecordString(ParmInfo.labelSH);
+		ParmInfo.templateNameSH = RecordString(ParmInfo.templateNameSH);
+		ParmInfo.helpSH = RecordString(ParmInfo.helpSH);
+		ParmInfo.visibilityConditionSH = RecordString(ParmInfo.visibilityConditionSH);
+		ParmInfo.disabledConditionSH = RecordString(ParmInfo.disabledConditionSH);
+		// Tags are not recorded
+		ParmInfo.tagCount = 0;
+	}
+
+	Node.ParmIntValues.SetNumZeroed(NodeInfo.parmIntValueCount);
+	if (NodeInfo.parmIntValueCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
+			Session, InNodeId, Node.ParmIntValues.GetData(), 0, NodeInfo.parmIntValueCount), false);
+	}
+
+	Node.ParmFloatValues.SetNumZeroed(NodeInfo.parmFloatValueCount);
+	if (NodeInfo.parmFloatValueCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmFloatValues(
+			Session, InNodeId, Node.ParmFloatValues.GetData(), 0, NodeInfo.parmFloatValueCount), false);
+	}
+
+	Node.ParmStringValues.SetNumZeroed(NodeInfo.parmStringValueCount);
+	if (NodeInfo.parmStringValueCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmStringValues(
+			Session, InNodeId, true, Node.ParmStringValues.GetData(), 0, NodeInfo.parmStringValueCount), false);
+
+		for (HAPI_StringHandle& Handle : Node.ParmStringValues)
+			Handle = RecordString(Handle);
+	}
+
+	Node.ParmChoices.SetNumZeroed(NodeInfo.parmChoiceCount);
+	if (NodeInfo.parmChoiceCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmChoiceLists(
+			Session, InNodeId, Node.ParmChoices.GetData(), 0, NodeInfo.parmChoiceCount), false);
+
+		for (HAPI_ParmChoiceInfo& Choice : Node.ParmChoices)
+		{
+			Choice.labelSH = RecordString(Choice.labelSH);
+			Choice.valueSH = RecordString(Choice.valueSH);
+		}
+	}
+
+	return true;
+}
+
+void
+FHoudiniMockApi::Serialize(FArchive& Ar)
+{
+	Ar << Strings;
+	Ar << Geos;
+	Ar << Nodes;
+
+	if (Ar.IsLoading())
+	{
+		StringHandles.Empty(Strings.Num());
+		for (int32 Idx = 1; Idx < Strings.Num(); Idx++)
+			StringHandles.Add(Strings[Idx], Idx);
+	}
+}
+
+bool
+FHoudiniMockApi::SaveToFile(const FString& InFilePath) const
+{
+	TArray<uint8> Buffer;
+	FMemoryWriter Writer(Buffer);
+
+	uint32 Magic = HoudiniMockApiFileMagic;
+	int32 Version = HoudiniMockApiFileVersion;
+	int32 HapiMajor = HAPI_VERSION_HOUDINI_ENGINE_MAJOR;
+	int32 HapiMinor = HAPI_VERSION_HOUDINI_ENGINE_MINOR;
+	Writer << Magic << Version << HapiMajor << HapiMinor;
+
+	const_cast<FHoudiniMockApi*>(this)->Serialize(Writer);
+
+	return FFileHelper::SaveArrayToFile(Buffer, *InFilePath);
+}
+
+bool
+FHoudiniMockApi::LoadFromFile(const FString& InFilePath)
+{
+	if (IsInstalled())
+		return false;
+
+	TArray<uint8> Buffer;
+	if (!FFileHelper::LoadFileToArray(Buffer, *InFilePath))
+		return false;
+
+	FMemoryReader Reader(Buffer);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 HapiMajor = 0;
+	int32 HapiMinor = 0;
+	Reader << Magic << Version << HapiMajor << HapiMinor;
+
+	// The HAPI structs are stored as is, so the recording must match the current HAPI version
+	if (Magic != HoudiniMockApiFileMagic || Version != HoudiniMockApiFileVersion
+		|| HapiMajor != HAPI_VERSION_HOUDINI_ENGINE_MAJOR || HapiMinor != HAPI_VERSION_HOUDINI_ENGINE_MINOR)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Mock HAPI recording %s is incompatible with this version of the plugin."), *InFilePath);
+		return false;
+	}
+
+	Reset();
+	Serialize(Reader);
+
+	return !Reader.IsError();
+}
+
+bool
+FHoudiniMockApi::Install()
+{
+	if (ActiveMock)
+	{
+		HOUDINI_LOG_WARNING(TEXT("A mock HAPI is already installed."));
+		return false;
+	}
+
+#define HOUDINI_MOCK_API_INSTALL(Name) \
+	HoudiniMockSavedApi.Name = FHoudiniApi::Name; \
+	FHoudiniApi::Name = &HoudiniMock_##Name;
+	HOUDINI_MOCK_API_FUNCTIONS(HOUDINI_MOCK_API_INSTALL)
+#undef HOUDINI_MOCK_API_INSTALL
+
+	ActiveMock = this;
+	return true;
+}
+
+void
+FHoudiniMockApi::Uninstall()
+{
+	if (ActiveMock != this)
+		return;
+
+#define HOUDINI_MOCK_API_UNINSTALL(Name) \
+	FHoudiniApi::Name = HoudiniMockSavedApi.Name;
+	HOUDINI_MOCK_API_FUNCTIONS(HOUDINI_MOCK_API_UNINSTALL)
+#undef HOUDINI_MOCK_API_UNINSTALL
+
+	ActiveMock = nullptr;
+}
+
+bool
+FHoudiniMockApi::GetStringBatch(const int32* InHandles, const int32& InCount, int32& OutBufferSize)
+{
+	if (!InHandles || InCount <= 0)
+		return false;
+
+	TArray<HAPI_StringHandle> Handles;
+	Handles.SetNumUninitialized(InCount);
+
+	OutBufferSize = 0;
+	for (int32 Idx = 0; Idx < InCount; Idx++)
+	{
+		const FString* String = FindString(InHandles[Idx]);
+		if (!String)
+			return false;
+
+		Handles[Idx] = InHandles[Idx];
+		OutBufferSize += FTCHARToUTF8(**String).Length() + 1;
+	}
+
+	// The batch is kept per thread, as the size and copy calls come in pairs
+	FScopeLock ScopeLock(&StringBatchLock);
+	PendingStringBatches.Add(FPlatformTLS::GetCurrentThreadId(), MoveTemp(Handles));
+
+	return true;
+}
+
+bool
+FHoudiniMockApi::CopyStringBatch(char* OutBuffer, const int32& InBufferSize)
+{
+	if (!OutBuffer)
+		return false;
+
+	TArray<HAPI_StringHandle> Handles;
+	{
+		FScopeLock ScopeLock(&StringBatchLock);
+		if (!PendingStringBatches.RemoveAndCopyValue(FPlatformTLS::GetCurrentThreadId(), Handles))
+			return false;
+	}
+
+	// Strings are stored one after the other, null terminated
+	int32 Offset = 0;
+	for (const HAPI_StringHandle& Handle : Handles)
+	{
+		FTCHARToUTF8 Converted(**FindString(Handle));
+		if (Offset + Converted.Length() + 1 > InBufferSize)
+			return false;
+
+		FMemory::Memcpy(OutBuffer + Offset, Converted.Get(), Converted.Length());
+		Offset += Converted.Length();
+		OutBuffer[Offset++] = '\0';
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,242 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAPI/HAPI_Common.h"
+
+// An attribute stored on a mock part.
+// String attributes store handles into the mock's string table.
+struct FHoudiniMockAttribute
+{
+	HAPI_AttributeInfo Info;
+	TArray<float> FloatData;
+	TArray<int32> IntData;
+	TArray<HAPI_StringHandle> StringData;
+};
+
+// A part stored on a mock geo: topology, attributes, group membership, heightfield and instancing data.
+struct FHoudiniMockPart
+{
+	HAPI_PartInfo Info;
+
+	TArray<int32> FaceCounts;
+	TArray<int32> VertexList;
+	// Per-face material node ids, empty if the part has no material
+	TArray<HAPI_NodeId> FaceMaterialIds;
+
+	TMap<FString, FHoudiniMockAttribute> Attributes[HAPI_ATTROWNER_MAX];
+	TMap<FString, TArray<int32>> GroupMembership[HAPI_GROUPTYPE_MAX];
+
+	// Only used by volume parts
+	HAPI_VolumeInfo VolumeInfo;
+	TArray<float> HeightfieldData;
+
+	// Only used by instancer parts
+	TArray<HAPI_PartId> InstancedPartIds;
+	TArray<HAPI_Transform> InstanceTransforms;
+};
+
+// A mock SOP/geo node
+struct FHoudiniMockGeo
+{
+	HAPI_GeoInfo Info;
+	TArray<FString> GroupNames[HAPI_GROUPTYPE_MAX];
+	TMap<HAPI_PartId, FHoudiniMockPart> Parts;
+};
+
+// A mock node with parameters.
+// The parameter values are stored in flat arrays, indexed by the parm infos' value indices.
+struct FHoudiniMockNode
+{
+	HAPI_NodeInfo Info;
+	HAPI_AssetInfo AssetInfo;
+	TArray<HAPI_ParmInfo> Parms;
+	TArray<int32> ParmIntValues;
+	TArray<float> ParmFloatValues;
+	TArray<HAPI_StringHandle> ParmStringValues;
+	TArray<HAPI_ParmChoiceInfo> ParmChoices;
+};
+
+/**
+ * Recording/replay stand-in for FHoudiniApi.
+ * Geometry and parameters can either be built synthetically or recorded from a live session,
+ * saved to disk and played back without a Houdini installation.
+ * While installed, the mock replaces the FHoudiniApi function pointers used to read geometry
+ * (part infos, attributes, groups, heightfields, instancers) and parameters,
+ * the ones used to create, reset and delete input nodes, and the ones listing the assets of a loaded library.
+ * Other functions are left untouched.
+ */
+class FHoudiniMockApi
+{
+	public:
+
+		FHoudiniMockApi();
+		~FHoudiniMockApi();
+
+		// Removes all the recorded data
+		void Reset();
+
+		//-----------------------------------------------------------------------------------------------------------------------------
+		// SYNTHETIC DATA
+		//-----------------------------------------------------------------------------------------------------------------------------
+
+		HAPI_StringHandle AddString(const FString& InString);
+		// Doesn't modify the string table, so it can be used by the mock functions from any thread
+		HAPI_StringHandle FindStringHandle(const FString& InString) const;
+		const FString* FindString(const HAPI_StringHandle& InHandle) const;
+
+		FHoudiniMockGeo& AddGeo(const HAPI_NodeId& InGeoId, const FString& InName);
+		FHoudiniMockPart& AddPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const FString& InName, const HAPI_PartType& InType);
+
+		FHoudiniMockGeo* FindGeo(const HAPI_NodeId& InGeoId);
+		FHoudiniMockPart* FindPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId);
+
+		// Adds attributes to a part, the part info's counts are updated by FinalizePart()
+		void AddFloatAttribute(
+			FHoudiniMockPart& InPart, const FString& InName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize, const TArray<float>& InData);
+		void AddIntAttribute(
+			FHoudiniMockPart& InPart, const FString& InName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize, const TArray<int32>& InData);
+		void AddStringAttribute(
+			FHoudiniMockPart& InPart, const FString& InName, const HAPI_AttributeOwner& InOwner, const TArray<FString>& InData);
+
+		void AddGroup(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const HAPI_GroupType& InType, const FString& InName, const TArray<int32>& InMembership);
+
+		void SetHeightfield(
+			FHoudiniMockPart& InPart, const FString& InVolumeName, const int32& InXLength, const int32& InYLength, const TArray<float>& InData, const HAPI_Transform& InTransform);
+
+		// Updates the part info's point/face/vertex and attribute counts from the part's data
+		void FinalizePart(FHoudiniMockPart& InPart);
+
+		FHoudiniMockNode& AddNode(const HAPI_NodeId& InNodeId, const FString& InName);
+		FHoudiniMockNode* FindNode(const HAPI_NodeId& InNodeId);
+
+		// Adds a loaded asset library defining the given assets
+		void AddAssetLibrary(const HAPI_AssetLibraryId& InLibraryId, const TArray<FString>& InAssetNames);
+		const TArray<HAPI_StringHandle>* FindAssetLibrary(const HAPI_AssetLibraryId& InLibraryId) const;
+
+		// Adds parameters to a node, returns the new parameter's id
+		HAPI_ParmId AddFloatParm(FHoudiniMockNode& InNode, const FString& InName, const TArray<float>& InValues, const HAPI_ParmId& InParentId = -1);
+		HAPI_ParmId AddIntParm(FHoudiniMockNode& InNode, const FString& InName, const TArray<int32>& InValues, const HAPI_ParmId& InParentId = -1);
+		HAPI_ParmId AddStringParm(FHoudiniMockNode& InNode, const FString& InName, const TArray<FString>& InValues, const HAPI_ParmId& InParentId = -1);
+		HAPI_ParmId AddToggleParm(FHoudiniMockNode& InNode, const FString& InName, const bool& InValue, const HAPI_ParmId& InParentId = -1);
+		HAPI_ParmId AddFolderListParm(FHoudiniMockNode& InNode, const FString& InName, const HAPI_ParmId& InParentId = -1);
+		HAPI_ParmId AddFolderParm(FHoudiniMockNode& InNode, const FString& InName, const HAPI_ParmId& InParentId);
+
+		//-----------------------------------------------------------------------------------------------------------------------------
+		// NODE CREATION
+		//-----------------------------------------------------------------------------------------------------------------------------
+
+		// Creates a SOP in its own OBJ node, like HAPI_CreateInputNode, and returns the SOP's id
+		HAPI_NodeId CreateInputNode(const FString& InName);
+		// Removes a node, its children and their geometry
+		bool DeleteNode(const HAPI_NodeId& InNodeId);
+		bool RenameNode(const HAPI_NodeId& InNodeId, const FString& InName);
+		// Replaces a part's info, as done by the plugin when uploading geometry
+		bool SetPartInfo(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const HAPI_PartInfo& InPartInfo);
+
+		//-----------------------------------------------------------------------------------------------------------------------------
+		// RECORDING
+		//-----------------------------------------------------------------------------------------------------------------------------
+
+		// Captures all the parts of a geo node from the live session
+		bool RecordGeo(const HAPI_NodeId& InGeoId);
+		// Captures a node's parameters (and asset info if it is an asset) from the live session
+		bool RecordNodeParameters(const HAPI_NodeId& InNodeId);
+
+		bool SaveToFile(const FString& InFilePath) const;
+		bool LoadFromFile(const FString& InFilePath);
+
+		//-----------------------------------------------------------------------------------------------------------------------------
+		// PLAYBACK
+		//-----------------------------------------------------------------------------------------------------------------------------
+
+		// Replaces the FHoudiniApi function pointers with the mock's
+		// Only one mock can be installed at a time.
+		bool Install();
+		// Restores the FHoudiniApi function pointers
+		void Uninstall();
+
+		bool IsInstalled() const { return ActiveMock == this; };
+
+		// The currently installed mock
+		static FHoudiniMockApi* GetActive() { return ActiveMock; };
+
+		// Used by the mock functions
+		bool GetStringBatch(const int32* InHandles, const int32& InCount, int32& OutBufferSize);
+		bool CopyStringBatch(char* OutBuffer, const int32& InBufferSize);
+
+	protected:
+
+		// Recording helpers
+		HAPI_StringHandle RecordString(const HAPI_StringHandle& InLiveHandle);
+		bool RecordPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId);
+		bool RecordAttributes(const HAPI_NodeId& InGeoId, FHoudiniMockPart& InPart, const HAPI_AttributeOwner& InOwner);
+
+		HAPI_ParmId AddParm(
+			FHoudiniMockNode& InNode, const FString& InName, const HAPI_ParmType& InType, const int32& InSize, const HAPI_ParmId& InParentId);
+
+		void Serialize(FArchive& Ar);
+
+	protected:
+
+		// String table, handle 0 is reserved as HAPI considers it invalid
+		TArray<FString> Strings;
+		TMap<FString, HAPI_StringHandle> StringHandles;
+
+		TMap<HAPI_NodeId, FHoudiniMockGeo> Geos;
+		TMap<HAPI_NodeId, FHoudiniMockNode> Nodes;
+		// Asset names of the synthetic asset libraries, not recorded
+		TMap<HAPI_AssetLibraryId, TArray<HAPI_StringHandle>> AssetLibraries;
+		// Id of the next node created by CreateInputNode
+		HAPI_NodeId NextNodeId;
+
+		// Strings requested by the last GetStringBatchSize call, per thread id
+		TMap<uint32, TArray<HAPI_StringHandle>> PendingStringBatches;
+		FCriticalSection StringBatchLock;
+
+		static FHoudiniMockApi* ActiveMock;
+};
+
+// Installs a mock for the duration of a scope
+struct FHoudiniScopedMockApi
+{
+	FHoudiniScopedMockApi(FHoudiniMockApi& InMock) : Mock(InMock) { bInstalled = Mock.Install(); };
+	~FHoudiniScopedMockApi() { if (bInstalled) Mock.Uninstall(); };
+
+	bool IsInstalled() const { return bInstalled; };
+
+	private:
+		FHoudiniMockApi& Mock;
+		bool bInstalled;
+};
+
+#endif
@@ -0,0 +1,547 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniMockSessionServer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "../HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "HAPI/HAPI_Version.h"
+
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+// Ids of the stand-in sessions, far from the ones used by live sessions
+static const HAPI_SessionId HoudiniMockSessionIdBase = 0x4D53000000LL;
+
+FHoudiniMockSessionServer* FHoudiniMockSessionServer::ActiveServer = nullptr;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// MOCK FUNCTIONS
+//-----------------------------------------------------------------------------------------------------------------------------
+
+// All the functions replaced by the stand-in
+#define HOUDINI_MOCK_SESSION_FUNCTIONS(X) \
+	X(IsInitialized) \
+	X(IsSessionValid) \
+	X(Initialize) \
+	X(Cleanup) \
+	X(CloseSession) \
+	X(CreateThriftNamedPipeSession) \
+	X(CreateThriftSocketSession) \
+	X(StartThriftNamedPipeServer) \
+	X(StartThriftSocketServer) \
+	X(GetSessionEnvInt) \
+	X(GetEnvInt) \
+	X(SetServerEnvString) \
+	X(ClearConnectionError) \
+	X(GetConnectionErrorLength) \
+	X(GetConnectionError)
+
+// The live function pointers, used for the sessions the stand-in doesn't own and restored when it is uninstalled
+struct FHoudiniMockSessionSavedApi
+{
+#define HOUDINI_MOCK_SESSION_SAVED_POINTER(Name) FHoudiniApi::Name##FuncPtr Name = nullptr;
+	HOUDINI_MOCK_SESSION_FUNCTIONS(HOUDINI_MOCK_SESSION_SAVED_POINTER)
+#undef HOUDINI_MOCK_SESSION_SAVED_POINTER
+};
+
+static FHoudiniMockSessionSavedApi HoudiniMockSessionSavedApi;
+
+// Returns the stand-in if it owns the session
+static FHoudiniMockSessionServer* HoudiniMockFindSessionOwner(const HAPI_Session * session)
+{
+	FHoudiniMockSessionServer* Server = FHoudiniMockSessionServer::GetActive();
+	if (!Server || !Server->OwnsSession(session))
+		return nullptr;
+
+	return Server;
+}
+
+static HAPI_Result HoudiniMockSession_IsInitialized(const HAPI_Session * session)
+{
+	if (FHoudiniMockSessionServer* Server = HoudiniMockFindSessionOwner(session))
+		return Server->IsSessionInitialized(session);
+
+	return HoudiniMockSessionSavedApi.IsInitialized(session);
+}
+
+static HAPI_Result HoudiniMockSession_IsSessionValid(const HAPI_Session * session)
+{
+	if (FHoudiniMockSessionServer* Server = HoudiniMockFindSessionOwner(session))
+		return Server->IsSessionValid(session);
+
+	return HoudiniMockSessionSavedApi.IsSessionValid(session);
+}
+
+static HAPI_Result HoudiniMockSession_Initialize(const HAPI_Session * session, const HAPI_CookOptions * cook_options, HAPI_Bool use_cooking_thread, int cooking_thread_stack_size, const char * houdini_environment_files, const char * otl_search_path, const char * dso_search_path, const char * image_dso_search_path, const char * audio_dso_search_path)
+{
+	if (FHoudiniMockSessionServer* Server = HoudiniMockFindSessionOwner(session))
+		return Server->InitializeSession(session);
+
+	return HoudiniMockSessionSavedApi.Initialize(
+		session, cook_options, use_cooking_thread, cooking_thread_stack_size, houdini_environment_files,
+		otl_search_path, dso_search_path, image_dso_search_path, audio_dso_search_path);
+}
+
+static HAPI_Result HoudiniMockSession_Cleanup(const HAPI_Session * session)
+{
+	if (FHoudiniMockSessionServer* Server = HoudiniMockFindSessionOwner(session))
+		return Server->CleanupSession(session);
+
+	return HoudiniMockSessionSavedApi.Cleanup(session);
+}
+
+static HAPI_Result HoudiniMockSession_CloseSession(const HAPI_Session * session)
+{
+	if (FHoudiniMockSessionServer* Server = HoudiniMockFindSessionOwner(session))
+		return Server->CloseSession(session);
+
+	return HoudiniMockSessionSavedApi.CloseSession(session);
+}
+
+static HAPI_Result HoudiniMockSession_CreateThriftNamedPipeSession(HAPI_Session * session, const char * pipe_name)
+{
+	FHoudiniMockSessionServer* Server = FHoudiniMockSessionServer::GetActive();
+	if (!Server || !pipe_name)
+		return HAPI_RESULT_FAILURE;
+
+	return Server->ConnectSession(FHoudiniMockSessionServer::GetPipeServerName(UTF8_TO_TCHAR(pipe_name)), session);
+}
+
+static HAPI_Result HoudiniMockSession_CreateThriftSocketSession(HAPI_Session * session, const char * host_name, int port)
+{
+	FHoudiniMockSessionServer* Server = FHoudiniMockSessionServer::GetActive();
+	if (!Server)
+		return HAPI_RESULT_FAILURE;
+
+	return Server->ConnectSession(FHoudiniMockSessionServer::GetSocketServerName(port), session);
+}
+
+static HAPI_Result HoudiniMockSession_StartThriftNamedPipeServer(const HAPI_ThriftServerOptions * options, const char * pipe_name, HAPI_ProcessId * process_id)
+{
+	FHoudiniMockSessionServer* Server = FHoudiniMockSessionServer::GetActive();
+	if (!Server || !pipe_name)
+		return HAPI_RESULT_FAILURE;
+
+	if (process_id)
+		*process_id = 0;
+
+	return Server->StartServer(FHoudiniMockSessionServer::GetPipeServerName(UTF8_TO_TCHAR(pipe_name)));
+}
+
+static HAPI_Result HoudiniMockSession_StartThriftSocketServer(const HAPI_ThriftServerOptions * options, int port, HAPI_ProcessId * process_id)
+{
+	FHoudiniMockSessionServer* Server = FHoudiniMockSessionServer::GetActive();
+	if (!Server)
+		return HAPI_RESULT_FAILURE;
+
+	if (process_id)
+		*process_id = 0;
+
+	return Server->StartServer(FHoudiniMockSessionServer::GetSocketServerName(port));
+}
+
+static HAPI_Result HoudiniMockSession_GetSessionEnvInt(const HAPI_Session * session, HAPI_SessionEnvIntType int_type, int * value)
+{
+	FHoudiniMockSessionServer* Server = HoudiniMockFindSessionOwner(session);
+	if (!Server)
+		return HoudiniMockSessionSavedApi.GetSessionEnvInt(session, int_type, value);
+
+	if (!value || int_type != HAPI_SESSIONENVINT_LICENSE)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	if (HAPI_RESULT_SUCCESS != Server->IsSessionValid(session))
+		return HAPI_RESULT_INVALID_SESSION;
+
+	*value = (int)HAPI_LICENSE_HOUDINI_ENGINE;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMockSession_GetEnvInt(HAPI_EnvIntType int_type, int * value)
+{
+	if (!value)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	// The stand-in always runs the version the plugin was built against
+	switch (int_type)
+	{
+		case HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR:
+			*value = HAPI_VERSION_HOUDINI_ENGINE_MAJOR;
+			return HAPI_RESULT_SUCCESS;
+
+		case HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR:
+			*value = HAPI_VERSION_HOUDINI_ENGINE_MINOR;
+			return HAPI_RESULT_SUCCESS;
+
+		case HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API:
+			*value = HAPI_VERSION_HOUDINI_ENGINE_API;
+			return HAPI_RESULT_SUCCESS;
+
+		default:
+			break;
+	}
+
+	return HoudiniMockSessionSavedApi.GetEnvInt(int_type, value);
+}
+
+static HAPI_Result HoudiniMockSession_SetServerEnvString(const HAPI_Session * session, const char * variable_name, const char * value)
+{
+	FHoudiniMockSessionServer* Server = HoudiniMockFindSessionOwner(session);
+	if (!Server)
+		return HoudiniMockSessionSavedApi.SetServerEnvString(session, variable_name, value);
+
+	return Server->IsSessionValid(session);
+}
+
+static HAPI_Result HoudiniMockSession_ClearConnectionError()
+{
+	if (FHoudiniMockSessionServer* Server = FHoudiniMockSessionServer::GetActive())
+		Server->ClearConnectionError();
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMockSession_GetConnectionErrorLength(int * buffer_length)
+{
+	FHoudiniMockSessionServer* Server = FHoudiniMockSessionServer::GetActive();
+	if (!Server || !buffer_length)
+		return HAPI_RESULT_FAILURE;
+
+	const FString Error = Server->GetConnectionError();
+	*buffer_length = Error.IsEmpty() ? 0 : FTCHARToUTF8(*Error).Length() + 1;
+	return HAPI_RESULT_SUCCESS;
+}
+
+static HAPI_Result HoudiniMockSession_GetConnectionError(char * string_value, int length, HAPI_Bool clear)
+{
+	FHoudiniMockSessionServer* Server = FHoudiniMockSessionServer::GetActive();
+	if (!Server || !string_value || length <= 0)
+		return HAPI_RESULT_FAILURE;
+
+	FTCHARToUTF8 Error(*Server->GetConnectionError());
+	const int32 CopyLength = FMath::Min(Error.Length(), length - 1);
+	FMemory::Memcpy(string_value, Error.Get(), CopyLength);
+	string_value[CopyLength] = '\0';
+
+	if (clear)
+		Server->ClearConnectionError();
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// FHoudiniMockSessionServer
+//-----------------------------------------------------------------------------------------------------------------------------
+
+FHoudiniMockSessionServer::FHoudiniMockSessionServer()
+{
+	Reset();
+}
+
+FHoudiniMockSessionServer::~FHoudiniMockSessionServer()
+{
+	if (IsInstalled())
+		Uninstall();
+}
+
+void
+FHoudiniMockSessionServer::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	RunningServers.Empty();
+	Sessions.Empty();
+	NextSessionId = HoudiniMockSessionIdBase;
+
+	StartupDelay = 0.0f;
+	bFailInitialize = false;
+	bCanStartServers = true;
+
+	StartedServerCount = 0;
+	ClosedSessionCount = 0;
+
+	ConnectionError.Empty();
+}
+
+void
+FHoudiniMockSessionServer::SetStartupDelay(const float& InSeconds)
+{
+	FScopeLock ScopeLock(&Lock);
+	StartupDelay = FMath::Max(InSeconds, 0.0f);
+}
+
+void
+FHoudiniMockSessionServer::SetFailInitialize(const bool& bInFailInitialize)
+{
+	FScopeLock ScopeLock(&Lock);
+	bFailInitialize = bInFailInitialize;
+}
+
+void
+FHoudiniMockSessionServer::SetCanStartServers(const bool& bInCanStartServers)
+{
+	FScopeLock ScopeLock(&Lock);
+	bCanStartServers = bInCanStartServers;
+}
+
+void
+FHoudiniMockSessionServer::AddRunningServer(const FString& InServerName)
+{
+	FScopeLock ScopeLock(&Lock);
+	RunningServers.Add(InServerName);
+}
+
+bool
+FHoudiniMockSessionServer::KillServer(const FString& InServerName)
+{
+	FScopeLock ScopeLock(&Lock);
+	return RunningServers.Remove(InServerName) > 0;
+}
+
+bool
+FHoudiniMockSessionServer::IsServerRunning(const FString& InServerName) const
+{
+	FScopeLock ScopeLock(&Lock);
+	return RunningServers.Contains(InServerName);
+}
+
+int32
+FHoudiniMockSessionServer::GetStartedServerCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return StartedServerCount;
+}
+
+int32
+FHoudiniMockSessionServer::GetOpenSessionCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Sessions.Num();
+}
+
+int32
+FHoudiniMockSessionServer::GetClosedSessionCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return ClosedSessionCount;
+}
+
+FString
+FHoudiniMockSessionServer::GetPipeServerName(const FString& InPipeName)
+{
+	return TEXT("pipe:") + InPipeName;
+}
+
+FString
+FHoudiniMockSessionServer::GetSocketServerName(const int32& InPort)
+{
+	return FString::Printf(TEXT("port:%d"), InPort);
+}
+
+bool
+FHoudiniMockSessionServer::Install()
+{
+	if (ActiveServer)
+	{
+		HOUDINI_LOG_WARNING(TEXT("A mock session server is already installed."));
+		return false;
+	}
+
+#define HOUDINI_MOCK_SESSION_INSTALL(Name) \
+	HoudiniMockSessionSavedApi.Name = FHoudiniApi::Name; \
+	FHoudiniApi::Name = &HoudiniMockSession_##Name;
+	HOUDINI_MOCK_SESSION_FUNCTIONS(HOUDINI_MOCK_SESSION_INSTALL)
+#undef HOUDINI_MOCK_SESSION_INSTALL
+
+	ActiveServer = this;
+	return true;
+}
+
+void
+FHoudiniMockSessionServer::Uninstall()
+{
+	if (ActiveServer != this)
+		return;
+
+#define HOUDINI_MOCK_SESSION_UNINSTALL(Name) \
+	FHoudiniApi::Name = HoudiniMockSessionSavedApi.Name;
+	HOUDINI_MOCK_SESSION_FUNCTIONS(HOUDINI_MOCK_SESSION_UNINSTALL)
+#undef HOUDINI_MOCK_SESSION_UNINSTALL
+
+	ActiveServer = nullptr;
+}
+
+HAPI_Result
+FHoudiniMockSessionServer::StartServer(const FString& InServerName)
+{
+	float Delay = 0.0f;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!bCanStartServers)
+		{
+			ConnectionError = FString::Printf(TEXT("Could not start the server %s"), *InServerName);
+			return HAPI_RESULT_FAILURE;
+		}
+
+		Delay = StartupDelay;
+	}
+
+	// Simulate the server launch without holding the lock
+	if (Delay > 0.0f)
+		FPlatformProcess::Sleep(Delay);
+
+	FScopeLock ScopeLock(&Lock);
+	if (RunningServers.Contains(InServerName))
+	{
+		// Like HARS, a server can't be started on a pipe/port that is already in use
+		ConnectionError = FString::Printf(TEXT("The server %s is already running"), *InServerName);
+		return HAPI_RESULT_FAILURE;
+	}
+
+	RunningServers.Add(InServerName);
+	StartedServerCount++;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockSessionServer::ConnectSession(const FString& InServerName, HAPI_Session* OutSession)
+{
+	if (!OutSession)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FScopeLock ScopeLock(&Lock);
+	if (!RunningServers.Contains(InServerName))
+	{
+		ConnectionError = FString::Printf(TEXT("Could not connect to the server %s"), *InServerName);
+		return HAPI_RESULT_FAILURE;
+	}
+
+	FMockSession NewSession;
+	NewSession.ServerName = InServerName;
+
+	OutSession->type = HAPI_SESSION_THRIFT;
+	OutSession->id = NextSessionId++;
+	Sessions.Add(OutSession->id, NewSession);
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniMockSessionServer::OwnsSession(const HAPI_Session* InSession) const
+{
+	if (!InSession || InSession->type != HAPI_SESSION_THRIFT || InSession->id < HoudiniMockSessionIdBase)
+		return false;
+
+	FScopeLock ScopeLock(&Lock);
+	return Sessions.Contains(InSession->id);
+}
+
+HAPI_Result
+FHoudiniMockSessionServer::IsSessionValid(const HAPI_Session* InSession) const
+{
+	if (!InSession)
+		return HAPI_RESULT_INVALID_SESSION;
+
+	FScopeLock ScopeLock(&Lock);
+	const FMockSession* MockSession = Sessions.Find(InSession->id);
+	if (!MockSession || !RunningServers.Contains(MockSession->ServerName))
+		return HAPI_RESULT_INVALID_SESSION;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockSessionServer::InitializeSession(const HAPI_Session* InSession)
+{
+	if (HAPI_RESULT_SUCCESS != IsSessionValid(InSession))
+		return HAPI_RESULT_INVALID_SESSION;
+
+	FScopeLock ScopeLock(&Lock);
+	if (bFailInitialize)
+		return HAPI_RESULT_FAILURE;
+
+	FMockSession& MockSession = Sessions.FindChecked(InSession->id);
+	if (MockSession.bInitialized)
+		return HAPI_RESULT_ALREADY_INITIALIZED;
+
+	MockSession.bInitialized = true;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockSessionServer::IsSessionInitialized(const HAPI_Session* InSession) const
+{
+	if (HAPI_RESULT_SUCCESS != IsSessionValid(InSession))
+		return HAPI_RESULT_INVALID_SESSION;
+
+	FScopeLock ScopeLock(&Lock);
+	const FMockSession* MockSession = Sessions.Find(InSession->id);
+	return (MockSession && MockSession->bInitialized) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_NOT_INITIALIZED;
+}
+
+HAPI_Result
+FHoudiniMockSessionServer::CleanupSession(const HAPI_Session* InSession)
+{
+	if (HAPI_RESULT_SUCCESS != IsSessionValid(InSession))
+		return HAPI_RESULT_INVALID_SESSION;
+
+	FScopeLock ScopeLock(&Lock);
+	Sessions.FindChecked(InSession->id).bInitialized = false;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockSessionServer::CloseSession(const HAPI_Session* InSession)
+{
+	if (!InSession)
+		return HAPI_RESULT_INVALID_SESSION;
+
+	FScopeLock ScopeLock(&Lock);
+	if (Sessions.Remove(InSession->id) <= 0)
+		return HAPI_RESULT_INVALID_SESSION;
+
+	ClosedSessionCount++;
+	return HAPI_RESULT_SUCCESS;
+}
+
+void
+FHoudiniMockSessionServer::ClearConnectionError()
+{
+	FScopeLock ScopeLock(&Lock);
+	ConnectionError.Empty();
+}
+
+FString
+FHoudiniMockSessionServer::GetConnectionError() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return ConnectionError;
+}
+
+#endif
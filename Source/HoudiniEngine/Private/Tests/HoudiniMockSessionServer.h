@@ -0,0 +1,137 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAPI/HAPI_Common.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Local stand-in for the Houdini Engine server, used to test the session start without a Houdini installation.
+ * While installed, the FHoudiniApi session functions (server start, session creation, HAPI initialization...)
+ * are replaced by in-memory servers and sessions. Servers can be slowed down, made to fail or killed to simulate a crash.
+ * Calls made with sessions that were not created by the stand-in are forwarded to the live functions,
+ * so a running session isn't affected.
+ * The mock functions can be called from any thread.
+ */
+class FHoudiniMockSessionServer
+{
+	public:
+
+		FHoudiniMockSessionServer();
+		~FHoudiniMockSessionServer();
+
+		// Stops all the servers, closes all the sessions and restores the default settings
+		void Reset();
+
+		// Time taken by a server to start, simulating the launch of HARS
+		void SetStartupDelay(const float& InSeconds);
+		// Makes the HAPI initialization fail for the new sessions
+		void SetFailInitialize(const bool& bInFailInitialize);
+		// Prevents the servers from starting, as if HARS couldn't be found
+		void SetCanStartServers(const bool& bInCanStartServers);
+
+		// Adds a running server, as if it had been started by the user
+		void AddRunningServer(const FString& InServerName);
+		// Simulates a server crash, all its sessions become invalid
+		bool KillServer(const FString& InServerName);
+		bool IsServerRunning(const FString& InServerName) const;
+
+		int32 GetStartedServerCount() const;
+		int32 GetOpenSessionCount() const;
+		int32 GetClosedSessionCount() const;
+
+		// Server names used for named pipe and socket servers
+		static FString GetPipeServerName(const FString& InPipeName);
+		static FString GetSocketServerName(const int32& InPort);
+
+		// Replaces the FHoudiniApi session functions with the stand-in's
+		// Only one stand-in can be installed at a time.
+		bool Install();
+		// Restores the FHoudiniApi session functions
+		void Uninstall();
+
+		bool IsInstalled() const { return ActiveServer == this; };
+
+		// The currently installed stand-in
+		static FHoudiniMockSessionServer* GetActive() { return ActiveServer; };
+
+		// Used by the mock functions
+		HAPI_Result StartServer(const FString& InServerName);
+		HAPI_Result ConnectSession(const FString& InServerName, HAPI_Session* OutSession);
+		bool OwnsSession(const HAPI_Session* InSession) const;
+		HAPI_Result IsSessionValid(const HAPI_Session* InSession) const;
+		HAPI_Result InitializeSession(const HAPI_Session* InSession);
+		HAPI_Result IsSessionInitialized(const HAPI_Session* InSession) const;
+		HAPI_Result CleanupSession(const HAPI_Session* InSession);
+		HAPI_Result CloseSession(const HAPI_Session* InSession);
+		void ClearConnectionError();
+		FString GetConnectionError() const;
+
+	protected:
+
+		struct FMockSession
+		{
+			FString ServerName;
+			bool bInitialized = false;
+		};
+
+		TSet<FString> RunningServers;
+		TMap<HAPI_SessionId, FMockSession> Sessions;
+		HAPI_SessionId NextSessionId;
+
+		float StartupDelay;
+		bool bFailInitialize;
+		bool bCanStartServers;
+
+		int32 StartedServerCount;
+		int32 ClosedSessionCount;
+
+		FString ConnectionError;
+
+		mutable FCriticalSection Lock;
+
+		static FHoudiniMockSessionServer* ActiveServer;
+};
+
+// Installs a stand-in server for the duration of a scope
+struct FHoudiniScopedMockSessionServer
+{
+	FHoudiniScopedMockSessionServer(FHoudiniMockSessionServer& InServer) : Server(InServer) { bInstalled = Server.Install(); };
+	~FHoudiniScopedMockSessionServer() { if (bInstalled) Server.Uninstall(); };
+
+	bool IsInstalled() const { return bInstalled; };
+
+	private:
+		FHoudiniMockSessionServer& Server;
+		bool bInstalled;
+};
+
+#endif
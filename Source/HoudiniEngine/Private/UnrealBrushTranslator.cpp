@@ -50,6 +50,8 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogBrushTranslator, Log, All);
 
+TMap<uint64, TWeakObjectPtr<UModel>> FUnrealBrushTranslator::CombinedBrushModels;
+
 bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 	UHoudiniInputBrush* InputBrushObject, 
 	ABrush* BrushActor, 
@@ -122,8 +124,12 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 	//--------------------------------------------------------------------------------------------------
 	TArray<ABrush*> BrushActors;
 	UHoudiniInputBrush::FindIntersectingSubtractiveBrushes(InputBrushObject, BrushActors);
-	
-	UModel* BrushModel = UHCsgUtils::BuildModelFromBrushes(BrushActors);
+
+	// Reuse the model if these brushes have already been combined
+	UModel* BrushModel = GetCombinedBrushModel(BrushActors);
+	if (!IsValid(BrushModel))
+		return false;
+
 	InputBrushObject->UpdateCachedData(BrushModel, BrushActors);
 	
 	// DEBUG: Upload the level model (baked by UE) to Houdini
@@ -429,3 +435,39 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 	return true;
 }
 
+uint64
+FUnrealBrushTranslator::GetBrushSetHash(const TArray<ABrush*>& InBrushes)
+{
+	uint64 Hash = InBrushes.Num();
+	for (ABrush* Brush : InBrushes)
+	{
+		const FHoudiniBrushInfo BrushInfo(Brush);
+		BrushInfo.HashCombine(Hash, BrushInfo.GetHash());
+	}
+
+	return Hash;
+}
+
+UModel*
+FUnrealBrushTranslator::GetCombinedBrushModel(TArray<ABrush*>& InBrushes)
+{
+	const uint64 Hash = GetBrushSetHash(InBrushes);
+	const TWeakObjectPtr<UModel>* CachedModel = CombinedBrushModels.Find(Hash);
+	if (CachedModel && CachedModel->IsValid())
+		return CachedModel->Get();
+
+	UModel* BrushModel = UHCsgUtils::BuildModelFromBrushes(InBrushes);
+	if (!IsValid(BrushModel))
+		return nullptr;
+
+	// Forget the models that have been garbage collected
+	for (auto It = CombinedBrushModels.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+			It.RemoveCurrent();
+	}
+
+	CombinedBrushModels.Add(Hash, BrushModel);
+
+	return BrushModel;
+}
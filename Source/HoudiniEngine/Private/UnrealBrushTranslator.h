@@ -26,8 +26,10 @@
 
 #pragma once
 
+#include "CoreMinimal.h"
 #include "HAPI/HAPI_Common.h"
 #include "UObject/NameTypes.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 class ABrush;
 class AActor;
@@ -47,4 +49,14 @@ public:
 		const FString& NodeName
 	);
 
+	// Returns the CSG model combining the brushes, reusing the last model built for the same brushes and transforms
+	static UModel* GetCombinedBrushModel(TArray<ABrush*>& InBrushes);
+
+	// Hash of the brushes' identity, order, transforms and shapes
+	static uint64 GetBrushSetHash(const TArray<ABrush*>& InBrushes);
+
+protected:
+
+	// Combined models per brush set hash. The models are kept alive by the brush inputs using them.
+	static TMap<uint64, TWeakObjectPtr<UModel>> CombinedBrushModels;
 };
\ No newline at end of file
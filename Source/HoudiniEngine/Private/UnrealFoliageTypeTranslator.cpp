@@ -52,8 +52,9 @@ FUnrealFoliageTypeTranslator::HapiCreateInputNodeForFoliageType_InstancedStaticM
 	if (!IsValid(InputSM))
 		return false;
 
+	// The foliage type attributes are added to the input node, so it can't object merge a shared mesh node
 	UStaticMeshComponent* const StaticMeshComponent = nullptr;
-	bool bSuccess = HapiCreateInputNodeForStaticMesh(
+	bool bSuccess = HapiCreateInputNodeForStaticMesh_Direct(
 		InputSM,
 		InputObjectNodeId,
 		InputNodeName,
@@ -41,6 +41,14 @@
 #include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionObject.h"
 #include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionActor.h"
 #include "Materials/Material.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineGeometryCollectionInputSinglePart(
+	TEXT("HoudiniEngine.GeometryCollectionInputSinglePart"),
+	0,
+	TEXT("Geometry collection inputs upload method.\n")
+	TEXT("0: One node per piece, merged (default)\n")
+	TEXT("1: All pieces in a single part, with a piece index attribute\n"));
 
 bool 
 FUnrealGeometryCollectionTranslator::HapiCreateInputNodeForGeometryCollection(
@@ -101,7 +109,10 @@ FUnrealGeometryCollectionTranslator::HapiCreateInputNodeForGeometryCollection(
                 FHoudiniEngine::Get().GetSession(),
                 PackNodeId, 0, MergeNodeId, 0), false);
 
-	UploadGeometryCollection(GeometryCollection, InputObjectNodeId, InputNodeName, MergeNodeId, GeometryCollectionComponent);
+	if (CVarHoudiniEngineGeometryCollectionInputSinglePart.GetValueOnAnyThread() != 0)
+		UploadGeometryCollectionAsSinglePart(GeometryCollection, InputObjectNodeId, InputNodeName, MergeNodeId, GeometryCollectionComponent);
+	else
+		UploadGeometryCollection(GeometryCollection, InputObjectNodeId, InputNodeName, MergeNodeId, GeometryCollectionComponent);
 
 	// Setup the pack node to create packed primitives.
 	{
@@ -803,6 +814,458 @@ FUnrealGeometryCollectionTranslator::UploadGeometryCollection(
 	return true;
 }
 
+// Adds and uploads a float attribute on part 0 of a node
+static bool
+HoudiniGCSetFloatAttribute(
+	const HAPI_NodeId& InNodeId, const char* InAttributeName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize, const TArray<float>& InData)
+{
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	AttributeInfo.tupleSize = InTupleSize;
+	AttributeInfo.count = InData.Num() / InTupleSize;
+	AttributeInfo.exists = true;
+	AttributeInfo.owner = InOwner;
+	AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+	AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(), InNodeId, 0, InAttributeName, &AttributeInfo), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
+		InData, InNodeId, 0, InAttributeName, AttributeInfo), false);
+
+	return true;
+}
+
+// Adds and uploads an int prim attribute on part 0 of a node
+static bool
+HoudiniGCSetIntPrimAttribute(const HAPI_NodeId& InNodeId, const char* InAttributeName, const TArray<int32>& InData)
+{
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	AttributeInfo.tupleSize = 1;
+	AttributeInfo.count = InData.Num();
+	AttributeInfo.exists = true;
+	AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
+	AttributeInfo.storage = HAPI_STORAGETYPE_INT;
+	AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(), InNodeId, 0, InAttributeName, &AttributeInfo), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeIntData(
+		InData, InNodeId, 0, InAttributeName, AttributeInfo), false);
+
+	return true;
+}
+
+// Adds and uploads the name prim attribute on part 0 of a node, each piece's name covering its range of faces.
+// The names are only converted once per piece, the faces simply reference them.
+static bool
+HoudiniGCSetPieceNameAttribute(const HAPI_NodeId& InNodeId, const TArray<FString>& InPieceNames, const TArray<int32>& InPieceFaceCounts)
+{
+	int32 NumFaces = 0;
+	for (const int32& FaceCount : InPieceFaceCounts)
+		NumFaces += FaceCount;
+
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	AttributeInfo.count = NumFaces;
+	AttributeInfo.tupleSize = 1;
+	AttributeInfo.exists = true;
+	AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
+	AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+	AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(), InNodeId, 0, HAPI_ATTRIB_NAME, &AttributeInfo), false);
+
+	TArray<const char *> RawPieceNames;
+	RawPieceNames.SetNum(InPieceNames.Num());
+	for (int32 PieceIdx = 0; PieceIdx < InPieceNames.Num(); PieceIdx++)
+		RawPieceNames[PieceIdx] = FHoudiniEngineUtils::ExtractRawString(InPieceNames[PieceIdx]);
+
+	// Send the names in chunks, only a chunk's worth of string pointers is built at a time
+	const int32 ChunkSize = FHoudiniEngineUtils::ThriftMaxStringChunkSize;
+	TArray<const char *> ChunkNames;
+	ChunkNames.SetNumUninitialized(FMath::Min(ChunkSize, NumFaces));
+
+	bool bSuccess = true;
+	int32 PieceIdx = 0;
+	int32 PieceFacesLeft = InPieceFaceCounts.Num() > 0 ? InPieceFaceCounts[0] : 0;
+	for (int32 ChunkStart = 0; ChunkStart < NumFaces; ChunkStart += ChunkSize)
+	{
+		const int32 CurCount = FMath::Min(ChunkSize, NumFaces - ChunkStart);
+		for (int32 Idx = 0; Idx < CurCount; Idx++)
+		{
+			// Move on to the next piece with faces
+			while (PieceFacesLeft <= 0)
+				PieceFacesLeft = InPieceFaceCounts[++PieceIdx];
+
+			ChunkNames[Idx] = RawPieceNames[PieceIdx];
+			PieceFacesLeft--;
+		}
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetAttributeStringData(
+			FHoudiniEngine::Get().GetSession(), InNodeId, 0, HAPI_ATTRIB_NAME,
+			&AttributeInfo, ChunkNames.GetData(), ChunkStart, CurCount))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to set the geometry collection piece names: %s"), *FHoudiniEngineUtils::GetErrorDescription());
+			bSuccess = false;
+			break;
+		}
+	}
+
+	// ExtractRawString allocates memory using malloc, free it!
+	FHoudiniEngineUtils::FreeRawStringMemory(RawPieceNames);
+
+	return bSuccess;
+}
+
+bool
+FUnrealGeometryCollectionTranslator::UploadGeometryCollectionAsSinglePart(
+	UGeometryCollection* GeometryCollectionObject,
+	HAPI_NodeId InParentNodeId,
+	FString InName,
+	HAPI_NodeId InMergeNodeId,
+	UGeometryCollectionComponent * GeometryCollectionComponent)
+{
+	if (!IsValid(GeometryCollectionObject))
+	{
+		return false;
+	}
+
+	TSharedPtr<FGeometryCollection, ESPMode::ThreadSafe> GeometryCollectionPtr = GeometryCollectionObject->GetGeometryCollection();
+	FGeometryCollection* GeometryCollection = GeometryCollectionPtr.Get();
+	check(GeometryCollection);
+
+	const TManagedArray<FVector>& Vertex = GeometryCollection->Vertex;
+	const TManagedArray<FVector>& TangentU = GeometryCollection->TangentU;
+	const TManagedArray<FVector>& TangentV = GeometryCollection->TangentV;
+	const TManagedArray<FVector>& Normal = GeometryCollection->Normal;
+	const TManagedArray<FVector2D>& UV = GeometryCollection->UV;
+	const TManagedArray<FLinearColor>& Color = GeometryCollection->Color;
+	const TManagedArray<FIntVector>& Indices = GeometryCollection->Indices;
+	const TManagedArray<int32>& MaterialID = GeometryCollection->MaterialID;
+	const TManagedArray<int32>& Parent = GeometryCollection->Parent;
+	const TManagedArray<int32>& SimulationType = GeometryCollection->SimulationType;
+	const TManagedArray<int32>& VertexStartArray = GeometryCollection->VertexStart;
+	const TManagedArray<int32>& VertexCountArray = GeometryCollection->VertexCount;
+	const TManagedArray<int32>& FaceStartArray = GeometryCollection->FaceStart;
+	const TManagedArray<int32>& FaceCountArray = GeometryCollection->FaceCount;
+	const TManagedArray<int32>& TransformToGeometryIndexArray = GeometryCollection->TransformToGeometryIndex;
+
+	// Need to update hierarchy level otherwise sometimes level would be out of date!
+	FGeometryCollectionClusteringUtility::UpdateHierarchyLevelOfChildren(GeometryCollection, -1);
+
+	if (GeometryCollection->Sections.Num() == 0)
+	{
+		HOUDINI_LOG_ERROR(TEXT("No triangles in mesh"));
+		return false;
+	}
+
+	const TManagedArray<int32>* Levels = GeometryCollection->HasAttribute("Level", FGeometryCollection::TransformGroup) ?
+		&GeometryCollection->GetAttribute<int32>("Level", FGeometryCollection::TransformGroup) : nullptr;
+
+	// The hierarchy of the pieces: level and cluster, assigned in transform order like the per-piece upload does
+	struct FGCPiece
+	{
+		int32 ObjectIndex;
+		int32 GeometryIndex;
+		int32 Level;
+		int32 ClusterIndex;
+	};
+
+	// Level -> ( ParentId -> ClusterLevel )
+	TMap<int32, TMap<int32, int32>> LevelToClusterArray;
+	TMap<int32, int32> LevelToNewClusterIndex;
+
+	TArray<FGCPiece> Pieces;
+	int32 NumPoints = 0;
+	int32 NumFaces = 0;
+	for (int32 ObjectIndex = 0; ObjectIndex < TransformToGeometryIndexArray.Num(); ObjectIndex++)
+	{
+		const int32 GeometryIndex = TransformToGeometryIndexArray[ObjectIndex];
+		if (GeometryIndex == -1)
+			continue;
+
+		FGCPiece& Piece = Pieces.AddDefaulted_GetRef();
+		Piece.ObjectIndex = ObjectIndex;
+		Piece.GeometryIndex = GeometryIndex;
+
+		Piece.Level = Levels ? (*Levels)[GeometryIndex] : 1;
+
+		// If simulation type is none, then disable it
+		if (SimulationType[GeometryIndex] == FGeometryCollection::ESimulationTypes::FST_None)
+			Piece.Level = 0;
+
+		Piece.ClusterIndex = -1;
+		TMap<int32, int32>& ClusterMap = LevelToClusterArray.FindOrAdd(Piece.Level);
+		const int32 ParentIndex = Parent[GeometryIndex];
+		if (ParentIndex != FGeometryCollection::Invalid)
+		{
+			if (int32* ExistingClusterIndex = ClusterMap.Find(ParentIndex))
+			{
+				Piece.ClusterIndex = *ExistingClusterIndex;
+			}
+			else
+			{
+				int32* NewClusterIndex = LevelToNewClusterIndex.Find(Piece.Level);
+				Piece.ClusterIndex = NewClusterIndex ? ++(*NewClusterIndex) : LevelToNewClusterIndex.Add(Piece.Level, 0);
+				ClusterMap.Add(ParentIndex, Piece.ClusterIndex);
+			}
+		}
+
+		NumPoints += VertexCountArray[GeometryIndex];
+		NumFaces += FaceCountArray[GeometryIndex];
+	}
+
+	// The per-piece nodes are connected to the merge by geometry index
+	Pieces.Sort([](const FGCPiece& A, const FGCPiece& B) { return A.GeometryIndex < B.GeometryIndex; });
+
+	HAPI_NodeId GeometryNodeId = -1;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+		InParentNodeId, TEXT("null"), TEXT("gc_pieces"), false, &GeometryNodeId), false);
+
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
+	Part.id = 0;
+	Part.nameSH = 0;
+	Part.vertexCount = NumFaces * 3;
+	Part.faceCount = NumFaces;
+	Part.pointCount = NumPoints;
+	Part.type = HAPI_PARTTYPE_MESH;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+		FHoudiniEngine::Get().GetSession(), GeometryNodeId, 0, &Part), false);
+
+	TArray<UMaterialInterface*> MaterialInterfaces;
+	int32 UEDefaultMaterialIndex = INDEX_NONE;
+	const int32 NumMaterials = GeometryCollectionObject->Materials.Num();
+	for (int32 Index = 0; Index < NumMaterials; ++Index)
+	{
+		UMaterialInterface* CurrMaterial = GeometryCollectionObject->Materials[Index];
+
+		// Possible we have a null entry - replace with default
+		if (!IsValid(CurrMaterial))
+		{
+			CurrMaterial = UMaterial::GetDefaultMaterial(MD_Surface);
+			UEDefaultMaterialIndex = Index;
+		}
+
+		MaterialInterfaces.Add(CurrMaterial);
+	}
+
+	const bool HasUVs = UV.Num() == Vertex.Num();
+	const bool HasNormals = Normal.Num() == Vertex.Num();
+	const bool HasTangentU = TangentU.Num() == Vertex.Num();
+	const bool HasTangentV = TangentV.Num() == Vertex.Num();
+	const bool HasColor = Color.Num() == Vertex.Num();
+
+	TArray<float> Positions;
+	Positions.SetNumUninitialized(NumPoints * 3);
+
+	TArray<float> UVs, Normals, Tangents, Binormals, RGBColors, Alphas;
+	if (HasUVs)
+		UVs.SetNumUninitialized(Part.vertexCount * 3);
+	if (HasNormals)
+		Normals.SetNumUninitialized(Part.vertexCount * 3);
+	if (HasTangentU)
+		Tangents.SetNumUninitialized(Part.vertexCount * 3);
+	if (HasTangentV)
+		Binormals.SetNumUninitialized(Part.vertexCount * 3);
+	if (HasColor)
+	{
+		RGBColors.SetNumUninitialized(Part.vertexCount * 3);
+		Alphas.SetNumUninitialized(Part.vertexCount);
+	}
+
+	TArray<int32> VertexList;
+	VertexList.SetNumUninitialized(Part.vertexCount);
+
+	TArray<int32> TriangleMaterialIndices;
+	if (NumMaterials > 0)
+		TriangleMaterialIndices.Reserve(NumFaces);
+
+	// Prim attributes, identifying the piece of each face. The names are stored per piece.
+	TArray<FString> PieceNames;
+	TArray<int32> PieceFaceCounts;
+	TArray<int32> PieceIndices;
+	TArray<int32> PieceLevels;
+	TArray<int32> PieceClusters;
+	PieceNames.Reserve(Pieces.Num());
+	PieceFaceCounts.Reserve(Pieces.Num());
+	PieceIndices.Reserve(NumFaces);
+	PieceLevels.Reserve(NumFaces);
+	PieceClusters.Reserve(NumFaces);
+
+	int32 PointOffset = 0;
+	int32 HoudiniVertexIdx = 0;
+	for (const FGCPiece& Piece : Pieces)
+	{
+		const int32 VertexStart = VertexStartArray[Piece.GeometryIndex];
+		const int32 VertexCount = VertexCountArray[Piece.GeometryIndex];
+		const int32 FaceStart = FaceStartArray[Piece.GeometryIndex];
+		const int32 FaceCount = FaceCountArray[Piece.GeometryIndex];
+
+		for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+		{
+			// Convert Unreal to Houdini
+			const FVector& PositionVector = Vertex[VertexStart + VertexIdx];
+			const int32 PointIdx = (PointOffset + VertexIdx) * 3;
+			Positions[PointIdx + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			Positions[PointIdx + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			Positions[PointIdx + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		}
+
+		PieceNames.Add(FString::Printf(TEXT("gc_piece_%d"), Piece.ObjectIndex));
+		PieceFaceCounts.Add(FaceCount);
+		for (int32 i = 0; i < FaceCount; i++)
+		{
+			const FIntVector FaceIndices = Indices[FaceStart + i];
+			for (int32 TriangleVertexIndex = 0; TriangleVertexIndex < 3; TriangleVertexIndex++)
+			{
+				// Swap second and third vertices due to winding
+				const int32 VertexIndex = FaceIndices[(3 - TriangleVertexIndex) % 3];
+				const int32 Float3Index = HoudiniVertexIdx * 3;
+
+				// Vectors have their Z and Y swapped due to axis conversion
+				if (HasUVs)
+				{
+					UVs[Float3Index + 0] = UV[VertexIndex].X;
+					UVs[Float3Index + 1] = 1 - UV[VertexIndex].Y;
+					UVs[Float3Index + 2] = 0;
+				}
+
+				if (HasNormals)
+				{
+					Normals[Float3Index + 0] = Normal[VertexIndex].X;
+					Normals[Float3Index + 1] = Normal[VertexIndex].Z;
+					Normals[Float3Index + 2] = Normal[VertexIndex].Y;
+				}
+
+				if (HasTangentU)
+				{
+					Tangents[Float3Index + 0] = TangentU[VertexIndex].X;
+					Tangents[Float3Index + 1] = TangentU[VertexIndex].Z;
+					Tangents[Float3Index + 2] = TangentU[VertexIndex].Y;
+				}
+
+				if (HasTangentV)
+				{
+					Binormals[Float3Index + 0] = TangentV[VertexIndex].X;
+					Binormals[Float3Index + 1] = TangentV[VertexIndex].Z;
+					Binormals[Float3Index + 2] = TangentV[VertexIndex].Y;
+				}
+
+				if (HasColor)
+				{
+					RGBColors[Float3Index + 0] = Color[VertexIndex].R;
+					RGBColors[Float3Index + 1] = Color[VertexIndex].G;
+					RGBColors[Float3Index + 2] = Color[VertexIndex].B;
+					Alphas[HoudiniVertexIdx] = Color[VertexIndex].A;
+				}
+
+				VertexList[HoudiniVertexIdx] = PointOffset + VertexIndex - VertexStart;
+				HoudiniVertexIdx++;
+			}
+
+			if (NumMaterials > 0)
+			{
+				const int32 MatIndex = MaterialID[FaceStart + i];
+				TriangleMaterialIndices.Add(MaterialInterfaces.IsValidIndex(MatIndex) ? MatIndex : UEDefaultMaterialIndex);
+			}
+
+			PieceIndices.Add(Piece.ObjectIndex);
+			PieceLevels.Add(Piece.Level);
+			PieceClusters.Add(Piece.ClusterIndex);
+		}
+
+		PointOffset += VertexCount;
+	}
+
+	if (!HoudiniGCSetFloatAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, 3, Positions))
+		return false;
+
+	if (HasUVs && !HoudiniGCSetFloatAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_UV, HAPI_ATTROWNER_VERTEX, 3, UVs))
+		return false;
+
+	if (HasNormals && !HoudiniGCSetFloatAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_NORMAL, HAPI_ATTROWNER_VERTEX, 3, Normals))
+		return false;
+
+	if (HasTangentU && !HoudiniGCSetFloatAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_TANGENTU, HAPI_ATTROWNER_VERTEX, 3, Tangents))
+		return false;
+
+	if (HasTangentV && !HoudiniGCSetFloatAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_TANGENTV, HAPI_ATTROWNER_VERTEX, 3, Binormals))
+		return false;
+
+	if (HasColor)
+	{
+		if (!HoudiniGCSetFloatAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_COLOR, HAPI_ATTROWNER_VERTEX, 3, RGBColors))
+			return false;
+
+		if (!HoudiniGCSetFloatAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_ALPHA, HAPI_ATTROWNER_VERTEX, 1, Alphas))
+			return false;
+	}
+
+	if (NumFaces > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetVertexList(
+			VertexList, GeometryNodeId, 0), false);
+
+		TArray<int32> FaceCounts;
+		FaceCounts.Init(3, NumFaces);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetFaceCounts(
+			FaceCounts, GeometryNodeId, 0), false);
+	}
+
+	// Materials - Reuse code from FHoudiniMeshTranslator
+	if (NumMaterials > 0)
+	{
+		TArray<FString> TriangleMaterials;
+		TMap<FString, TArray<float>> ScalarMaterialParameters;
+		TMap<FString, TArray<float>> VectorMaterialParameters;
+		TMap<FString, TArray<FString>> TextureMaterialParameters;
+
+		FUnrealMeshTranslator::CreateFaceMaterialArray(
+			MaterialInterfaces, TriangleMaterialIndices, TriangleMaterials,
+			ScalarMaterialParameters, VectorMaterialParameters, TextureMaterialParameters);
+
+		if (!FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
+			GeometryNodeId, 0, TriangleMaterials.Num(), TriangleMaterials,
+			ScalarMaterialParameters, VectorMaterialParameters, TextureMaterialParameters))
+		{
+			return false;
+		}
+	}
+
+	// name (required for packing)
+	if (!HoudiniGCSetPieceNameAttribute(GeometryNodeId, PieceNames, PieceFaceCounts))
+		return false;
+
+	// Piece hierarchy: unreal_gc_piece_index, unreal_gc_piece (level) and unreal_gc_cluster
+	if (!HoudiniGCSetIntPrimAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_GC_PIECE_INDEX, PieceIndices))
+		return false;
+
+	if (!HoudiniGCSetIntPrimAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_GC_PIECE, PieceLevels))
+		return false;
+
+	if (!HoudiniGCSetIntPrimAttribute(GeometryNodeId, HAPI_UNREAL_ATTRIB_GC_CLUSTER_PIECE, PieceClusters))
+		return false;
+
+	AddGeometryCollectionDetailAttributes(GeometryCollectionObject, GeometryNodeId, Part.id, Part, InName, GeometryCollectionComponent);
+
+	// Commit the geo.
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), GeometryNodeId), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
+		FHoudiniEngine::Get().GetSession(),
+		InMergeNodeId, 0, GeometryNodeId, 0), false);
+
+	return true;
+}
+
 bool FUnrealGeometryCollectionTranslator::AddGeometryCollectionDetailAttributes(
 	UGeometryCollection* GeometryCollectionObject, HAPI_NodeId GeoId, HAPI_PartId PartId, HAPI_PartInfo & Part, const FString& InName, UGeometryCollectionComponent * GeometryCollectionComponent)
 {
@@ -57,6 +57,15 @@ struct HOUDINIENGINE_API FUnrealGeometryCollectionTranslator
 			HAPI_NodeId InMergeNodeId, 
 			UGeometryCollectionComponent * GeometryCollectionComponent = nullptr);
 
+		// Uploads all the pieces in a single part, in the order the merge of the per-piece nodes would produce.
+		// The pieces are identified by their name (gc_piece_N) and unreal_gc_piece_index prim attributes.
+		static bool UploadGeometryCollectionAsSinglePart(
+			UGeometryCollection * GeometryCollectionObject,
+			HAPI_NodeId InParentNodeId,
+			FString InName,
+			HAPI_NodeId InMergeNodeId,
+			UGeometryCollectionComponent * GeometryCollectionComponent = nullptr);
+
 		static bool AddGeometryCollectionDetailAttributes(
 			UGeometryCollection* GeometryCollectionObject,
 			HAPI_NodeId GeoId, 
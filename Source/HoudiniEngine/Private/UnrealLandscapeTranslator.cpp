@@ -34,6 +34,7 @@
 
 #include "UnrealLandscapeTranslator.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniInputNodePool.h"
 
 #include "Landscape.h"
 #include "LandscapeDataAccess.h"
@@ -41,6 +42,15 @@
 #include "LightMap.h"
 #include "Engine/MapBuildDataRegistry.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineParallelLandscapeExtraction(
+	TEXT("HoudiniEngine.ParallelLandscapeExtraction"),
+	1,
+	TEXT("Controls whether the landscape components are extracted on worker threads when sending a landscape as a mesh or points.\n")
+	TEXT("0: Disabled, the components are extracted one after the other on the calling thread\n")
+	TEXT("1: Enabled (default)\n"));
 
 
 bool 
@@ -137,8 +147,8 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 	TArray<FVector> LandscapeUVArray;
 	// Array for the vertex index of each point in its component
 	TArray<FIntPoint> LandscapeComponentVertexIndicesArray;
-	// Array for the tile names per point
-	TArray<const char *> LandscapeComponentNameArray;
+	// Array for the name of each extracted component, the points are stored component by component
+	TArray<FString> LandscapeComponentNames;
 	// Array for the lightmap values
 	TArray<FLinearColor> LandscapeLightmapValues;
 	// Selected components set to all components in current landscape proxy
@@ -151,7 +161,7 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 		bExportLighting, bExportTileUVs, bExportNormalizedUVs,
 		LandscapePositionArray, LandscapeNormalArray,
 		LandscapeUVArray, LandscapeComponentVertexIndicesArray,
-		LandscapeComponentNameArray, LandscapeLightmapValues))
+		LandscapeComponentNames, LandscapeLightmapValues))
 		return false;
 
 	//--------------------------------------------------------------------------------------------------
@@ -175,7 +185,7 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 		return false;
 
 	// Create point attribute containing landscape component name.
-	if (!AddLandscapeComponentNameAttribute(DisplayGeoInfo.nodeId, LandscapeComponentNameArray))
+	if (!AddLandscapeComponentNameAttribute(DisplayGeoInfo.nodeId, LandscapeComponentNames, VertexCountPerComponent))
 		return false;
 
 	// Create point attribute info containing lightmap information.
@@ -1179,15 +1189,10 @@ FUnrealLandscapeTranslator::CreateHeightfieldInputNode(
 	if (HeightfieldNodeId != -1)
 		return false;
 
-	// Convert the node's name
-	std::string NameStr;
-	FHoudiniEngineUtils::ConvertUnrealString(NodeName, NameStr);
-
-	// Create the heigthfield node via HAPI
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateHeightFieldInput(
-		FHoudiniEngine::Get().GetSession(),
-		-1, NameStr.c_str(), YSize, XSize, 1.0f, HAPI_HeightFieldSampling::HAPI_HEIGHTFIELD_SAMPLING_CORNER,
-		&HeightfieldNodeId, &HeightNodeId, &MaskNodeId, &MergeNodeId), false);
+	// Create the heigthfield node via HAPI, or reuse one of the same size
+	if (!FHoudiniInputNodePool::AcquireHeightfieldNode(
+		NodeName, XSize, YSize, HeightfieldNodeId, HeightNodeId, MaskNodeId, MergeNodeId))
+		return false;
 	
 	// Cook it
 	return FHoudiniEngineUtils::HapiCookNode(HeightfieldNodeId, nullptr, true);
@@ -1572,7 +1577,7 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 	TArray<FVector>& LandscapeNormalArray,
 	TArray<FVector>& LandscapeUVArray,
 	TArray<FIntPoint>& LandscapeComponentVertexIndicesArray,
-	TArray<const char *>& LandscapeComponentNameArray,
+	TArray<FString>& LandscapeComponentNames,
 	TArray<FLinearColor>& LandscapeLightmapValues)
 {
 	if (!LandscapeProxy)
@@ -1581,45 +1586,62 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 	if (SelectedComponents.Num() < 1)
 		return false;
 
-	// Get runtime settings.
-	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-
 	// Calc all the needed sizes
 	int32 ComponentSizeQuads = ((LandscapeProxy->ComponentSizeQuads + 1) >> LandscapeProxy->ExportLOD) - 1;
 	float ScaleFactor = (float)LandscapeProxy->ComponentSizeQuads / (float)ComponentSizeQuads;
 
-	int32 NumComponents = SelectedComponents.Num();
-	bool bExportOnlySelected = NumComponents != LandscapeProxy->LandscapeComponents.Num();
+	bool bExportOnlySelected = SelectedComponents.Num() != LandscapeProxy->LandscapeComponents.Num();
+
+	// The components are extracted in the landscape's order
+	TArray<ULandscapeComponent *> ComponentsToExtract;
+	ComponentsToExtract.Reserve(SelectedComponents.Num());
+	for (ULandscapeComponent * LandscapeComponent : LandscapeProxy->LandscapeComponents)
+	{
+		if (bExportOnlySelected && !SelectedComponents.Contains(LandscapeComponent))
+			continue;
 
+		ComponentsToExtract.Add(LandscapeComponent);
+	}
+
+	int32 NumComponents = ComponentsToExtract.Num();
 	int32 VertexCountPerComponent = FMath::Square(ComponentSizeQuads + 1);
 	int32 VertexCount = NumComponents * VertexCountPerComponent;
 	if (!VertexCount)
 		return false;
 
-	// Initialize the data arrays    
+	// Initialize the data arrays, each component writes to its own slice
 	LandscapePositionArray.SetNumUninitialized(VertexCount);
 	LandscapeNormalArray.SetNumUninitialized(VertexCount);
 	LandscapeUVArray.SetNumUninitialized(VertexCount);
-	LandscapeComponentNameArray.SetNumUninitialized(VertexCount);
 	LandscapeComponentVertexIndicesArray.SetNumUninitialized(VertexCount);
+	LandscapeComponentNames.SetNum(NumComponents);
 	if (bExportLighting)
 		LandscapeLightmapValues.SetNumUninitialized(VertexCount);
 
 	//-----------------------------------------------------------------------------------------------------------------
-	// EXTRACT THE LANDSCAPE DATA
+	// ACCESS THE COMPONENTS' DATA
 	//-----------------------------------------------------------------------------------------------------------------
-	FIntPoint IntPointMax = FIntPoint::ZeroValue;
-
-	int32 AllPositionsIdx = 0;
-	for (int32 ComponentIdx = 0; ComponentIdx < LandscapeProxy->LandscapeComponents.Num(); ComponentIdx++)
+	// Creating the data interfaces locks the heightmap mips, and reading the lightmaps accesses their bulk data,
+	// so this is done on the calling thread. Only the per-vertex extraction runs in parallel.
+	struct FLandscapeComponentExtractionData
 	{
-		ULandscapeComponent * LandscapeComponent = LandscapeProxy->LandscapeComponents[ComponentIdx];
-		if (bExportOnlySelected && !SelectedComponents.Contains(LandscapeComponent))
-			continue;
+		TUniquePtr<FLandscapeComponentDataInterface> CDI;
+		FTransform ComponentTransform;
+		FIntPoint SectionBase;
 
-		TArray64< uint8 > LightmapMipData;
+		TArray64<uint8> LightmapMipData;
 		int32 LightmapMipSizeX = 0;
 		int32 LightmapMipSizeY = 0;
+	};
+
+	TArray<FLandscapeComponentExtractionData> ComponentsData;
+	ComponentsData.SetNum(NumComponents);
+
+	FIntPoint IntPointMax = FIntPoint::ZeroValue;
+	for (int32 ComponentIdx = 0; ComponentIdx < NumComponents; ComponentIdx++)
+	{
+		ULandscapeComponent * LandscapeComponent = ComponentsToExtract[ComponentIdx];
+		FLandscapeComponentExtractionData& ComponentData = ComponentsData[ComponentIdx];
 
 		// See if we need to export lighting information.
 		if (bExportLighting)
@@ -1631,25 +1653,45 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 				UTexture2D * TextureLightmap = LightMap2D->GetTexture(0);
 				if (TextureLightmap)
 				{
-					if (TextureLightmap->Source.GetMipData(LightmapMipData, 0, 0, 0, nullptr))
+					if (TextureLightmap->Source.GetMipData(ComponentData.LightmapMipData, 0, 0, 0, nullptr))
 					{
-						LightmapMipSizeX = TextureLightmap->Source.GetSizeX();
-						LightmapMipSizeY = TextureLightmap->Source.GetSizeY();
+						ComponentData.LightmapMipSizeX = TextureLightmap->Source.GetSizeX();
+						ComponentData.LightmapMipSizeY = TextureLightmap->Source.GetSizeY();
 					}
 					else
 					{
-						LightmapMipData.Empty();
+						ComponentData.LightmapMipData.Empty();
 					}
 				}
 			}
 		}
 
 		// Construct landscape component data interface to access raw data.
-		FLandscapeComponentDataInterface CDI(LandscapeComponent, LandscapeProxy->ExportLOD);
+		ComponentData.CDI = MakeUnique<FLandscapeComponentDataInterface>(LandscapeComponent, LandscapeProxy->ExportLOD);
+		ComponentData.ComponentTransform = LandscapeComponent->GetComponentTransform();
+		ComponentData.SectionBase = LandscapeComponent->GetSectionBase();
 
 		// Get name of this landscape component.
-		const char * LandscapeComponentNameStr = FHoudiniEngineUtils::ExtractRawString(LandscapeComponent->GetName());
-		for (int32 VertexIdx = 0; VertexIdx < VertexCountPerComponent; VertexIdx++)
+		LandscapeComponentNames[ComponentIdx] = LandscapeComponent->GetName();
+
+		// Keep track of max offset.
+		if (!bExportTileUVs)
+			IntPointMax = IntPointMax.ComponentMax(ComponentData.SectionBase);
+	}
+
+	//-----------------------------------------------------------------------------------------------------------------
+	// EXTRACT THE LANDSCAPE DATA
+	//-----------------------------------------------------------------------------------------------------------------
+	auto ExtractComponent = [&](int32 ComponentIdx)
+	{
+		const FLandscapeComponentExtractionData& ComponentData = ComponentsData[ComponentIdx];
+		FLandscapeComponentDataInterface& CDI = *ComponentData.CDI;
+
+		// Retrieve component scale.
+		const FVector & ScaleVector = ComponentData.ComponentTransform.GetScale3D();
+
+		int32 AllPositionsIdx = ComponentIdx * VertexCountPerComponent;
+		for (int32 VertexIdx = 0; VertexIdx < VertexCountPerComponent; VertexIdx++, AllPositionsIdx++)
 		{
 			int32 VertX = 0;
 			int32 VertY = 0;
@@ -1678,23 +1720,20 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 			else
 			{
 				// We want to export global uvs (default).
-				FIntPoint IntPoint = LandscapeComponent->GetSectionBase();
+				const FIntPoint& IntPoint = ComponentData.SectionBase;
 				TextureUV = FVector(VertX * ScaleFactor + IntPoint.X, VertY * ScaleFactor + IntPoint.Y, 0.0f);
-
-				// Keep track of max offset.
-				IntPointMax = IntPointMax.ComponentMax(IntPoint);
 			}
 
 			if (bExportLighting)
 			{
 				FLinearColor VertexLightmapColor(0.0f, 0.0f, 0.0f, 1.0f);
-				if (LightmapMipData.Num() > 0)
+				if (ComponentData.LightmapMipData.Num() > 0)
 				{
 					FVector2D UVCoord(VertX, VertY);
 					UVCoord /= (ComponentSizeQuads + 1);
 
 					FColor LightmapColorRaw = PickVertexColorFromTextureMip(
-						LightmapMipData.GetData(), UVCoord, LightmapMipSizeX, LightmapMipSizeY);
+						ComponentData.LightmapMipData.GetData(), UVCoord, ComponentData.LightmapMipSizeX, ComponentData.LightmapMipSizeY);
 
 					VertexLightmapColor = LightmapColorRaw.ReinterpretAsLinear();
 				}
@@ -1702,12 +1741,6 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 				LandscapeLightmapValues[AllPositionsIdx] = VertexLightmapColor;
 			}
 
-			// Retrieve component transform.
-			const FTransform & ComponentTransform = LandscapeComponent->GetComponentTransform();
-
-			// Retrieve component scale.
-			const FVector & ScaleVector = ComponentTransform.GetScale3D();
-
 			// Perform normalization.
 			Normal /= ScaleVector;
 			Normal.Normalize();
@@ -1726,9 +1759,6 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 
 			Swap(Normal.Y, Normal.Z);
 
-			// Store landscape component name for this point.
-			LandscapeComponentNameArray[AllPositionsIdx] = LandscapeComponentNameStr;
-
 			// Store vertex index (x,y) for this point.
 			LandscapeComponentVertexIndicesArray[AllPositionsIdx].X = VertX;
 			LandscapeComponentVertexIndicesArray[AllPositionsIdx].Y = VertY;
@@ -1738,14 +1768,22 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 
 			// Store uv.
 			LandscapeUVArray[AllPositionsIdx] = TextureUV;
-
-			AllPositionsIdx++;
 		}
+	};
 
-		// Free the memory allocated for LandscapeComponentNameStr
-		FHoudiniEngineUtils::FreeRawStringMemory(LandscapeComponentNameStr);
+	if (NumComponents > 1 && CVarHoudiniEngineParallelLandscapeExtraction.GetValueOnAnyThread() > 0)
+	{
+		ParallelFor(NumComponents, ExtractComponent);
+	}
+	else
+	{
+		for (int32 ComponentIdx = 0; ComponentIdx < NumComponents; ComponentIdx++)
+			ExtractComponent(ComponentIdx);
 	}
 
+	// Release the data interfaces, this unlocks the heightmap mips
+	ComponentsData.Empty();
+
 	// If we need to normalize UV space and we are doing global UVs.
 	if (!bExportTileUVs && bExportNormalizedUVs)
 	{
@@ -1895,9 +1933,10 @@ FUnrealLandscapeTranslator::AddLandscapeComponentVertexIndicesAttribute(const HA
 }
 
 bool 
-FUnrealLandscapeTranslator::AddLandscapeComponentNameAttribute(const HAPI_NodeId& NodeId, const TArray<const char *>& LandscapeComponentNameArray)
+FUnrealLandscapeTranslator::AddLandscapeComponentNameAttribute(
+	const HAPI_NodeId& NodeId, const TArray<FString>& LandscapeComponentNames, const int32& VertexCountPerComponent)
 {
-	int32 VertexCount = LandscapeComponentNameArray.Num();
+	int32 VertexCount = LandscapeComponentNames.Num() * VertexCountPerComponent;
 	if (VertexCount < 3)
 		return false;
 
@@ -1916,14 +1955,40 @@ FUnrealLandscapeTranslator::AddLandscapeComponentNameAttribute(const HAPI_NodeId
 		HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
 		&AttributeInfoPointLandscapeComponentNames), false);
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeStringData(
-		FHoudiniEngine::Get().GetSession(), NodeId, 0,
-		HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
-		&AttributeInfoPointLandscapeComponentNames,
-		(const char**)LandscapeComponentNameArray.GetData(),
-		0, AttributeInfoPointLandscapeComponentNames.count), false);
+	// Convert each component name once, the points only reference them
+	TArray<const char *> RawComponentNames;
+	RawComponentNames.SetNum(LandscapeComponentNames.Num());
+	for (int32 ComponentIdx = 0; ComponentIdx < LandscapeComponentNames.Num(); ComponentIdx++)
+		RawComponentNames[ComponentIdx] = FHoudiniEngineUtils::ExtractRawString(LandscapeComponentNames[ComponentIdx]);
 
-	return true;
+	// Send the names in chunks, only a chunk's worth of string pointers is built at a time
+	const int32 ChunkSize = FHoudiniEngineUtils::ThriftMaxStringChunkSize;
+	TArray<const char *> ChunkNames;
+	ChunkNames.SetNumUninitialized(FMath::Min(ChunkSize, VertexCount));
+
+	bool bSuccess = true;
+	for (int32 ChunkStart = 0; ChunkStart < VertexCount; ChunkStart += ChunkSize)
+	{
+		const int32 CurCount = FMath::Min(ChunkSize, VertexCount - ChunkStart);
+		for (int32 Idx = 0; Idx < CurCount; Idx++)
+			ChunkNames[Idx] = RawComponentNames[(ChunkStart + Idx) / VertexCountPerComponent];
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetAttributeStringData(
+			FHoudiniEngine::Get().GetSession(), NodeId, 0,
+			HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
+			&AttributeInfoPointLandscapeComponentNames,
+			ChunkNames.GetData(), ChunkStart, CurCount))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to set the landscape component names: %s"), *FHoudiniEngineUtils::GetErrorDescription());
+			bSuccess = false;
+			break;
+		}
+	}
+
+	// ExtractRawString allocates memory using malloc, free it!
+	FHoudiniEngineUtils::FreeRawStringMemory(RawComponentNames);
+
+	return bSuccess;
 }
 
 bool FUnrealLandscapeTranslator::AddLandscapeTileAttribute(
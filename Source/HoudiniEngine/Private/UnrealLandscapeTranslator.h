@@ -202,6 +202,7 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const bool bExportMaterials);
 
 		// Extract data from the landscape
+		// The points are stored component by component, LandscapeComponentNames contains the name of each extracted component.
 		static bool ExtractLandscapeData(
 			ALandscapeProxy * LandscapeProxy,
 			TSet<ULandscapeComponent *>& SelectedComponents,
@@ -212,7 +213,7 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			TArray<FVector>& LandscapeNormalArray,
 			TArray<FVector>& LandscapeUVArray,
 			TArray<FIntPoint>& LandscapeComponentVertexIndicesArray,
-			TArray<const char *>& LandscapeComponentNameArray,
+			TArray<FString>& LandscapeComponentNames,
 			TArray<FLinearColor>& LandscapeLightmapValues);
 
 		// Helper functions to extract color from a texture
@@ -242,10 +243,11 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const HAPI_NodeId& NodeId,
 			const TArray<FIntPoint>& LandscapeComponentVertexIndicesArray);
 
-		// Add the Component Name attribute extracted from a landscape
+		// Add the Component Name attribute extracted from a landscape, as a point attribute
 		static bool AddLandscapeComponentNameAttribute(
 			const HAPI_NodeId& NodeId,
-			const TArray<const char *>& LandscapeComponentNameArray);
+			const TArray<FString>& LandscapeComponentNames,
+			const int32& VertexCountPerComponent);
 
 		static bool AddLandscapeTileAttribute(
 			const HAPI_NodeId& NodeId, const HAPI_PartId& PartId, const int32& TileIdx );
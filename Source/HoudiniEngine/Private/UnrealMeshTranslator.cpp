@@ -29,6 +29,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniInputNodePool.h"
 
 #include "RawMesh.h"
 #include "MeshDescription.h"
@@ -41,6 +42,9 @@
 #include "Materials/MaterialInterface.h"
 #include "MeshAttributes.h"
 #include "StaticMeshAttributes.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeExit.h"
 
 #if WITH_EDITOR
 	#include "EditorFramework/AssetImportData.h"
@@ -55,6 +59,83 @@ static TAutoConsoleVariable<int32> CVarHoudiniEngineStaticMeshExportMethod(
 	TEXT("2: Render Mesh / LODResources\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineShareStaticMeshInputNodes(
+	TEXT("HoudiniEngine.ShareStaticMeshInputNodes"),
+	1,
+	TEXT("Controls whether static meshes used as inputs without a component are uploaded once per session and shared.\n")
+	TEXT("0: Disabled, every input uploads its own copy of the mesh\n")
+	TEXT("1: Enabled (default)\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineMaxUnusedSharedStaticMeshInputNodes(
+	TEXT("HoudiniEngine.MaxUnusedSharedStaticMeshInputNodes"),
+	32,
+	TEXT("Number of shared static mesh input nodes that are kept in the session after they stop being referenced by an input.\n")
+);
+
+// A static mesh node shared by all the inputs using the same mesh content and export options
+struct FHoudiniSharedStaticMeshInputNode
+{
+	// The node containing the mesh data
+	HAPI_NodeId NodeId = -1;
+
+	// The input nodes that object merge the shared node
+	TSet<HAPI_NodeId> UserNodeIds;
+
+	// Last time the shared node was used by an input, used for eviction
+	double LastUsedTime = 0.0;
+};
+
+// Shared static mesh nodes, keyed by mesh path and content hash
+static TMap<FString, FHoudiniSharedStaticMeshInputNode> SharedStaticMeshInputNodes;
+
+// Shared node key for each input node referencing a shared static mesh node
+static TMap<HAPI_NodeId, FString> SharedStaticMeshInputNodeUsers;
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineParallelMeshAttributeExtraction(
+	TEXT("HoudiniEngine.ParallelMeshAttributeExtraction"),
+	1,
+	TEXT("Controls whether mesh vertex attributes are extracted on worker threads while previous attributes are sent to Houdini.\n")
+	TEXT("0: Disabled, attributes are extracted on the game thread\n")
+	TEXT("1: Enabled (default)\n")
+);
+
+// Number of vertex instances extracted per parallel block
+static const int32 MeshAttributeExtractionBlockSize = 4096;
+
+// Runs InExtractRange over [0, InNumElements) and returns a future that is ready once the whole range is extracted.
+// Large ranges are split in blocks and extracted on the task graph, small ones directly on the calling thread.
+static TFuture<void>
+LaunchMeshAttributeExtraction(const int32 InNumElements, TFunction<void(int32, int32)> InExtractRange)
+{
+	if (InNumElements <= MeshAttributeExtractionBlockSize
+		|| CVarHoudiniEngineParallelMeshAttributeExtraction.GetValueOnAnyThread() <= 0)
+	{
+		InExtractRange(0, InNumElements);
+
+		TPromise<void> Promise;
+		Promise.SetValue();
+		return Promise.GetFuture();
+	}
+
+	return Async(EAsyncExecution::TaskGraph, [InNumElements, InExtractRange]()
+	{
+		const int32 NumBlocks = FMath::DivideAndRoundUp(InNumElements, MeshAttributeExtractionBlockSize);
+		ParallelFor(NumBlocks, [&](int32 BlockIndex)
+		{
+			const int32 Start = BlockIndex * MeshAttributeExtractionBlockSize;
+			InExtractRange(Start, FMath::Min(Start + MeshAttributeExtractionBlockSize, InNumElements));
+		});
+	});
+}
+
+static void
+WaitForMeshAttributeExtraction(TFuture<void>& InTask)
+{
+	if (InTask.IsValid())
+		InTask.Wait();
+}
+
 bool
 FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	UStaticMesh* StaticMesh,
@@ -69,6 +150,322 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	if (!IsValid(StaticMesh))
 		return false;
 
+	// Components can override materials, vertex colors, tags etc. so their export can't be shared.
+	// Without a component, the exported data only depends on the mesh and the export options.
+	// The returned node then only object merges the shared node: callers that add their own attributes
+	// to the input node must use HapiCreateInputNodeForStaticMesh_Direct instead.
+	if (!StaticMeshComponent && CVarHoudiniEngineShareStaticMeshInputNodes.GetValueOnAnyThread() > 0)
+	{
+		return HapiCreateInputNodeForStaticMesh_Shared(
+			StaticMesh, InputNodeId, InputNodeName, ExportAllLODs, ExportSockets, ExportColliders);
+	}
+
+	return HapiCreateInputNodeForStaticMesh_Direct(
+		StaticMesh, InputNodeId, InputNodeName, StaticMeshComponent, ExportAllLODs, ExportSockets, ExportColliders);
+}
+
+bool
+FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh_Shared(
+	UStaticMesh* StaticMesh,
+	HAPI_NodeId& InputNodeId,
+	const FString& InputNodeName,
+	const bool& ExportAllLODs,
+	const bool& ExportSockets,
+	const bool& ExportColliders)
+{
+	if (!IsValid(StaticMesh))
+		return false;
+
+	const FString SharedKey = GetSharedStaticMeshInputNodeKey(StaticMesh, ExportAllLODs, ExportSockets, ExportColliders);
+
+	// Upload the mesh to a new shared node if there isn't a valid one for this mesh content yet
+	HAPI_NodeId SharedNodeId = -1;
+	const bool bFoundSharedNode = FindOrCreateSharedStaticMeshNode(SharedKey, [&](HAPI_NodeId& OutNodeId)
+	{
+		const FString SharedNodeName = TEXT("shared_") + StaticMesh->GetName();
+		return HapiCreateInputNodeForStaticMesh_Direct(
+			StaticMesh, OutNodeId, SharedNodeName, nullptr, ExportAllLODs, ExportSockets, ExportColliders);
+	}, SharedNodeId);
+
+	if (!bFoundSharedNode)
+		return false;
+
+	// Get the shared node's path for the object merge
+	FString SharedNodePath;
+	if (!FHoudiniEngineUtils::HapiGetAbsNodePath(SharedNodeId, SharedNodePath))
+		return false;
+
+	// Create an object merge in its own OBJ node, so that each input can have its own transform
+	HAPI_NodeId NewNodeId = -1;
+	if (!FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::ObjectMerge, InputNodeName, NewNodeId))
+		return false;
+
+	HAPI_ParmId ParmId = -1;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIdFromName(
+		FHoudiniEngine::Get().GetSession(), NewNodeId, "objpath1", &ParmId), false);
+
+	const std::string ConvertedPath = TCHAR_TO_UTF8(*SharedNodePath);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmStringValue(
+		FHoudiniEngine::Get().GetSession(), NewNodeId, ConvertedPath.c_str(), ParmId, 0), false);
+
+	if (!FHoudiniEngineUtils::HapiCookNode(NewNodeId, nullptr, true))
+		return false;
+
+	// Register the new input node as a user of the shared node
+	AddSharedStaticMeshInputNodeUser(SharedKey, NewNodeId);
+
+	// We have now created a valid new input node, delete the previous one
+	HAPI_NodeId PreviousInputNodeId = InputNodeId;
+	InputNodeId = NewNodeId;
+	if (PreviousInputNodeId >= 0)
+	{
+		ReleaseSharedStaticMeshInputNode(PreviousInputNodeId);
+		if (!FHoudiniInputNodePool::ReleaseNode(PreviousInputNodeId))
+		{
+			// Get the parent OBJ node ID before deleting!
+			HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
+
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+				FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input node for %s."), *InputNodeName);
+			}
+
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+				FHoudiniEngine::Get().GetSession(), PreviousInputOBJNode))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input OBJ node for %s."), *InputNodeName);
+			}
+		}
+	}
+
+	EvictUnusedSharedStaticMeshInputNodes();
+
+	return true;
+}
+
+uint32
+FUnrealMeshTranslator::GetStaticMeshContentHash(
+	UStaticMesh* StaticMesh,
+	const bool& ExportAllLODs,
+	const bool& ExportSockets,
+	const bool& ExportColliders)
+{
+	if (!IsValid(StaticMesh))
+		return 0;
+
+	// Export options
+	uint32 Hash = GetTypeHash(ExportAllLODs);
+	Hash = HashCombine(Hash, GetTypeHash(ExportSockets));
+	Hash = HashCombine(Hash, GetTypeHash(ExportColliders));
+	Hash = HashCombine(Hash, GetTypeHash(CVarHoudiniEngineStaticMeshExportMethod.GetValueOnAnyThread()));
+
+#if WITH_EDITORONLY_DATA
+	// The render data's DDC key covers the mesh descriptions and their build settings
+	FStaticMeshRenderData* SMRenderData = StaticMesh->GetRenderData();
+	if (SMRenderData)
+		Hash = HashCombine(Hash, GetTypeHash(SMRenderData->DerivedDataKey));
+#endif
+
+	Hash = HashCombine(Hash, GetTypeHash(StaticMesh->GetNumLODs()));
+	Hash = HashCombine(Hash, GetTypeHash(StaticMesh->GetLightMapResolution()));
+
+	// Materials
+	for (const FStaticMaterial& StaticMaterial : StaticMesh->GetStaticMaterials())
+	{
+		Hash = HashCombine(Hash, GetTypeHash(StaticMaterial.MaterialSlotName));
+		if (StaticMaterial.MaterialInterface)
+			Hash = HashCombine(Hash, GetTypeHash(StaticMaterial.MaterialInterface->GetPathName()));
+	}
+
+	// Sockets
+	if (ExportSockets)
+	{
+		for (UStaticMeshSocket* Socket : StaticMesh->Sockets)
+		{
+			if (!IsValid(Socket))
+				continue;
+
+			Hash = HashCombine(Hash, GetTypeHash(Socket->SocketName));
+			Hash = HashCombine(Hash, GetTypeHash(Socket->Tag));
+			Hash = HashCombine(Hash, GetTypeHash(Socket->RelativeLocation));
+			Hash = HashCombine(Hash, GetTypeHash(Socket->RelativeRotation.Euler()));
+			Hash = HashCombine(Hash, GetTypeHash(Socket->RelativeScale));
+		}
+	}
+
+	// Colliders, the body setup guid is regenerated whenever its geometry changes
+	if (ExportColliders && StaticMesh->GetBodySetup())
+		Hash = HashCombine(Hash, GetTypeHash(StaticMesh->GetBodySetup()->BodySetupGuid));
+
+	return Hash;
+}
+
+FString
+FUnrealMeshTranslator::GetSharedStaticMeshInputNodeKey(
+	UStaticMesh* StaticMesh,
+	const bool& ExportAllLODs,
+	const bool& ExportSockets,
+	const bool& ExportColliders)
+{
+	if (!IsValid(StaticMesh))
+		return FString();
+
+	const uint32 ContentHash = GetStaticMeshContentHash(StaticMesh, ExportAllLODs, ExportSockets, ExportColliders);
+	return FString::Printf(TEXT("%s_%08x"), *StaticMesh->GetPathName(), ContentHash);
+}
+
+bool
+FUnrealMeshTranslator::FindOrCreateSharedStaticMeshNode(
+	const FString& InSharedKey,
+	const TFunctionRef<bool(HAPI_NodeId&)>& InCreateSharedNode,
+	HAPI_NodeId& OutSharedNodeId)
+{
+	OutSharedNodeId = -1;
+	if (InSharedKey.IsEmpty())
+		return false;
+
+	// Look for an existing shared node for this key, make sure it's still valid
+	FHoudiniSharedStaticMeshInputNode* SharedNode = SharedStaticMeshInputNodes.Find(InSharedKey);
+	if (SharedNode && !FHoudiniEngineUtils::IsHoudiniNodeValid(SharedNode->NodeId))
+	{
+		for (const HAPI_NodeId& UserNodeId : SharedNode->UserNodeIds)
+			SharedStaticMeshInputNodeUsers.Remove(UserNodeId);
+
+		SharedStaticMeshInputNodes.Remove(InSharedKey);
+		SharedNode = nullptr;
+	}
+
+	if (!SharedNode)
+	{
+		HAPI_NodeId SharedNodeId = -1;
+		if (!InCreateSharedNode(SharedNodeId) || SharedNodeId < 0)
+			return false;
+
+		SharedNode = &SharedStaticMeshInputNodes.Add(InSharedKey);
+		SharedNode->NodeId = SharedNodeId;
+	}
+
+	SharedNode->LastUsedTime = FPlatformTime::Seconds();
+	OutSharedNodeId = SharedNode->NodeId;
+
+	return true;
+}
+
+void
+FUnrealMeshTranslator::AddSharedStaticMeshInputNodeUser(const FString& InSharedKey, const HAPI_NodeId& InInputNodeId)
+{
+	FHoudiniSharedStaticMeshInputNode* SharedNode = SharedStaticMeshInputNodes.Find(InSharedKey);
+	if (!SharedNode)
+		return;
+
+	SharedNode->UserNodeIds.Add(InInputNodeId);
+	SharedNode->LastUsedTime = FPlatformTime::Seconds();
+	SharedStaticMeshInputNodeUsers.Add(InInputNodeId, InSharedKey);
+}
+
+HAPI_NodeId
+FUnrealMeshTranslator::GetSharedStaticMeshNodeForInputNode(const HAPI_NodeId& InInputNodeId)
+{
+	const FString* SharedKey = SharedStaticMeshInputNodeUsers.Find(InInputNodeId);
+	const FHoudiniSharedStaticMeshInputNode* SharedNode = SharedKey ? SharedStaticMeshInputNodes.Find(*SharedKey) : nullptr;
+	return SharedNode ? SharedNode->NodeId : -1;
+}
+
+int32
+FUnrealMeshTranslator::GetNumSharedStaticMeshNodes()
+{
+	return SharedStaticMeshInputNodes.Num();
+}
+
+void
+FUnrealMeshTranslator::ReleaseSharedStaticMeshInputNode(const HAPI_NodeId& InInputNodeId)
+{
+	FString SharedKey;
+	if (!SharedStaticMeshInputNodeUsers.RemoveAndCopyValue(InInputNodeId, SharedKey))
+		return;
+
+	FHoudiniSharedStaticMeshInputNode* SharedNode = SharedStaticMeshInputNodes.Find(SharedKey);
+	if (!SharedNode)
+		return;
+
+	SharedNode->UserNodeIds.Remove(InInputNodeId);
+	SharedNode->LastUsedTime = FPlatformTime::Seconds();
+}
+
+void
+FUnrealMeshTranslator::ClearSharedStaticMeshInputNodes()
+{
+	SharedStaticMeshInputNodes.Empty();
+	SharedStaticMeshInputNodeUsers.Empty();
+}
+
+void
+FUnrealMeshTranslator::EvictUnusedSharedStaticMeshInputNodes()
+{
+	const int32 MaxUnusedNodes = FMath::Max(0, CVarHoudiniEngineMaxUnusedSharedStaticMeshInputNodes.GetValueOnAnyThread());
+	if (SharedStaticMeshInputNodes.Num() <= MaxUnusedNodes)
+		return;
+
+	// Input nodes can be deleted without releasing their shared node (ie, when the whole input is destroyed),
+	// so only count the users that still exist in the session
+	TArray<TPair<double, FString>> UnusedNodes;
+	for (auto& Pair : SharedStaticMeshInputNodes)
+	{
+		FHoudiniSharedStaticMeshInputNode& SharedNode = Pair.Value;
+		for (auto It = SharedNode.UserNodeIds.CreateIterator(); It; ++It)
+		{
+			if (FHoudiniEngineUtils::IsHoudiniNodeValid(*It))
+				continue;
+
+			SharedStaticMeshInputNodeUsers.Remove(*It);
+			It.RemoveCurrent();
+		}
+
+		if (SharedNode.UserNodeIds.Num() <= 0)
+			UnusedNodes.Add(TPair<double, FString>(SharedNode.LastUsedTime, Pair.Key));
+	}
+
+	if (UnusedNodes.Num() <= MaxUnusedNodes)
+		return;
+
+	// Delete the least recently used nodes first
+	UnusedNodes.Sort([](const TPair<double, FString>& A, const TPair<double, FString>& B) { return A.Key < B.Key; });
+	const int32 NumToEvict = UnusedNodes.Num() - MaxUnusedNodes;
+	for (int32 Idx = 0; Idx < NumToEvict; Idx++)
+	{
+		FHoudiniSharedStaticMeshInputNode SharedNode;
+		if (!SharedStaticMeshInputNodes.RemoveAndCopyValue(UnusedNodes[Idx].Value, SharedNode))
+			continue;
+
+		// Single input nodes go back to the pool
+		if (FHoudiniInputNodePool::ReleaseNode(SharedNode.NodeId))
+			continue;
+
+		// Deleting the OBJ node cleans up the merge and all the LOD/collider/socket nodes
+		HAPI_NodeId SharedOBJNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(SharedNode.NodeId);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+			FHoudiniEngine::Get().GetSession(), SharedOBJNodeId >= 0 ? SharedOBJNodeId : SharedNode.NodeId))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the shared static mesh node %s."), *UnusedNodes[Idx].Value);
+		}
+	}
+}
+
+bool
+FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh_Direct(
+	UStaticMesh* StaticMesh,
+	HAPI_NodeId& InputNodeId,
+	const FString& InputNodeName,
+	UStaticMeshComponent* StaticMeshComponent,
+	const bool& ExportAllLODs,
+	const bool& ExportSockets,
+	const bool& ExportColliders)
+{
+	// If we don't have a static mesh there's nothing to do.
+	if (!IsValid(StaticMesh))
+		return false;
+
 	// Node ID for the newly created node
 	HAPI_NodeId NewNodeId = -1;
 
@@ -109,9 +506,9 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	else
 	{
 		// No LODs/Sockets, we just need a single input node
-		// If InputNodeId is invalid, we need to create an input node.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
-			FHoudiniEngine::Get().GetSession(), &NewNodeId, TCHAR_TO_ANSI(*InputNodeName)), false);
+		// If InputNodeId is invalid, we need to create an input node, or reuse one from the pool
+		if (!FHoudiniInputNodePool::AcquireNode(EHoudiniInputNodePoolType::Mesh, InputNodeName, NewNodeId))
+			return false;
 
 		if (!FHoudiniEngineUtils::HapiCookNode(NewNodeId, nullptr, true))
 			return false;
@@ -137,20 +534,25 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	// We have now created a valid new input node, delete the previous one
 	if (PreviousInputNodeId >= 0)
 	{
-		// Get the parent OBJ node ID before deleting!
-		HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
-
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
-			FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
+		// The previous node might have been referencing a shared mesh node
+		ReleaseSharedStaticMeshInputNode(PreviousInputNodeId);
+		if (!FHoudiniInputNodePool::ReleaseNode(PreviousInputNodeId))
 		{
-			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input node for %s."), *InputNodeName);
-		}
+			// Get the parent OBJ node ID before deleting!
+			HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
 
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
-			FHoudiniEngine::Get().GetSession(), PreviousInputOBJNode))
-		{
-			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input OBJ node for %s."), *InputNodeName);
-		}		
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+				FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input node for %s."), *InputNodeName);
+			}
+
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+				FHoudiniEngine::Get().GetSession(), PreviousInputOBJNode))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input OBJ node for %s."), *InputNodeName);
+			}
+		}
 	}
 
 	// TODO:
@@ -1708,6 +2110,10 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		TArray<int32> MeshTriangleVertexCounts;
 		MeshTriangleVertexCounts.SetNumUninitialized(NumTriangles);
 
+		// Houdini vertex index to UE vertex (buffer) index, used by the attribute extraction below
+		TArray<uint32> HoudiniVertexToUEVertex;
+		HoudiniVertexToUEVertex.SetNumUninitialized(NumVertexInstances);
+
 		int32 TriangleIdx = 0;
 		int32 HoudiniVertexIdx = 0;
 		FIndexArrayView TriangleVertexIndices = LODResources.IndexBuffer.GetArrayView();
@@ -1722,80 +2128,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 					// Reverse the winding order for Houdini (but still start at 0)
 					const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
 					const uint32 UEVertexIndex = TriangleVertexIndices[Section.FirstIndex + SectionTriangleIndex * 3 + WindingIdx];
-
-					// Calculate the index of the first component of a vertex instance's value in an inline float array 
-					// representing vectors (3 float) per vertex instance
-					const int32 Float3Index = HoudiniVertexIdx * 3;
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// UVS (uvX)
-					//--------------------------------------------------------------------------------------------------------------------- 
-					if (bIsVertexInstanceUVsValid)
-					{
-						for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
-						{
-							const FVector2D &UV = LODResources.VertexBuffers.StaticMeshVertexBuffer.GetVertexUV(UEVertexIndex, UVLayerIndex);
-							UVs[UVLayerIndex][Float3Index + 0] = UV.X;
-							UVs[UVLayerIndex][Float3Index + 1] = 1.0f - UV.Y;
-							UVs[UVLayerIndex][Float3Index + 2] = 0;
-						}
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// NORMALS (N)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceNormalsValid)
-					{
-						const FVector &Normal = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(UEVertexIndex);
-						Normals[Float3Index + 0] = Normal.X;
-						Normals[Float3Index + 1] = Normal.Z;
-						Normals[Float3Index + 2] = Normal.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// TANGENT (tangentu)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceTangentsValid)
-					{
-						const FVector &Tangent = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentX(UEVertexIndex);
-						Tangents[Float3Index + 0] = Tangent.X;
-						Tangents[Float3Index + 1] = Tangent.Z;
-						Tangents[Float3Index + 2] = Tangent.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// BINORMAL (tangentv)
-					//---------------------------------------------------------------------------------------------------------------------
-					// In order to calculate the binormal we also need the tangent and normal
-					if (bIsVertexInstanceBinormalsValid)
-					{
-						FVector Binormal = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentY(UEVertexIndex);
-						Binormals[Float3Index + 0] = Binormal.X;
-						Binormals[Float3Index + 1] = Binormal.Z;
-						Binormals[Float3Index + 2] = Binormal.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// COLORS (Cd)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
-					{
-						FLinearColor Color = FLinearColor::White;
-						if (bUseComponentOverrideColors)
-						{
-							FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
-							FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
-							Color = ColorVertexBuffer.VertexColor(UEVertexIndex).ReinterpretAsLinear();
-						}
-						else
-						{
-							Color = LODResources.VertexBuffers.ColorVertexBuffer.VertexColor(UEVertexIndex).ReinterpretAsLinear();
-						}
-						RGBColors[Float3Index + 0] = Color.R;
-						RGBColors[Float3Index + 1] = Color.G;
-						RGBColors[Float3Index + 2] = Color.B;
-						Alphas[HoudiniVertexIdx] = Color.A;
-					}
+					HoudiniVertexToUEVertex[HoudiniVertexIdx] = UEVertexIndex;
 
 					//--------------------------------------------------------------------------------------------------------------------- 
 					// TRIANGLE/FACE VERTEX INDICES
@@ -1825,6 +2158,121 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 			}
 		}
 
+		// Extract the vertex instance attributes: each attribute gets its own extraction task, and is sent
+		// to Houdini below as soon as it is ready, so uploading an attribute overlaps with extracting the next ones.
+		const FStaticMeshVertexBuffer& StaticMeshVertexBuffer = LODResources.VertexBuffers.StaticMeshVertexBuffer;
+		TArray<TFuture<void>> UVTasks;
+		TFuture<void> NormalsTask;
+		TFuture<void> TangentsTask;
+		TFuture<void> BinormalsTask;
+		TFuture<void> ColorsTask;
+
+		// The tasks write to the attribute arrays, make sure they are done before leaving this scope
+		ON_SCOPE_EXIT
+		{
+			for (TFuture<void>& UVTask : UVTasks)
+				WaitForMeshAttributeExtraction(UVTask);
+			WaitForMeshAttributeExtraction(NormalsTask);
+			WaitForMeshAttributeExtraction(TangentsTask);
+			WaitForMeshAttributeExtraction(BinormalsTask);
+			WaitForMeshAttributeExtraction(ColorsTask);
+		};
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// UVS (uvX)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		if (bIsVertexInstanceUVsValid)
+		{
+			UVTasks.Reserve(NumUVLayers);
+			for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
+			{
+				UVTasks.Add(LaunchMeshAttributeExtraction(NumVertexInstances, [&, UVLayerIndex](int32 Start, int32 End)
+				{
+					TArray<float>& LayerUVs = UVs[UVLayerIndex];
+					for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+					{
+						const FVector2D &UV = StaticMeshVertexBuffer.GetVertexUV(HoudiniVertexToUEVertex[VertexIdx], UVLayerIndex);
+						LayerUVs[VertexIdx * 3 + 0] = UV.X;
+						LayerUVs[VertexIdx * 3 + 1] = 1.0f - UV.Y;
+						LayerUVs[VertexIdx * 3 + 2] = 0;
+					}
+				}));
+			}
+		}
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// NORMALS (N)
+		//---------------------------------------------------------------------------------------------------------------------
+		if (bIsVertexInstanceNormalsValid)
+		{
+			NormalsTask = LaunchMeshAttributeExtraction(NumVertexInstances, [&](int32 Start, int32 End)
+			{
+				for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+				{
+					const FVector &Normal = StaticMeshVertexBuffer.VertexTangentZ(HoudiniVertexToUEVertex[VertexIdx]);
+					Normals[VertexIdx * 3 + 0] = Normal.X;
+					Normals[VertexIdx * 3 + 1] = Normal.Z;
+					Normals[VertexIdx * 3 + 2] = Normal.Y;
+				}
+			});
+		}
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// TANGENT (tangentu)
+		//---------------------------------------------------------------------------------------------------------------------
+		if (bIsVertexInstanceTangentsValid)
+		{
+			TangentsTask = LaunchMeshAttributeExtraction(NumVertexInstances, [&](int32 Start, int32 End)
+			{
+				for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+				{
+					const FVector &Tangent = StaticMeshVertexBuffer.VertexTangentX(HoudiniVertexToUEVertex[VertexIdx]);
+					Tangents[VertexIdx * 3 + 0] = Tangent.X;
+					Tangents[VertexIdx * 3 + 1] = Tangent.Z;
+					Tangents[VertexIdx * 3 + 2] = Tangent.Y;
+				}
+			});
+		}
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// BINORMAL (tangentv)
+		//---------------------------------------------------------------------------------------------------------------------
+		if (bIsVertexInstanceBinormalsValid)
+		{
+			BinormalsTask = LaunchMeshAttributeExtraction(NumVertexInstances, [&](int32 Start, int32 End)
+			{
+				for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+				{
+					const FVector Binormal = StaticMeshVertexBuffer.VertexTangentY(HoudiniVertexToUEVertex[VertexIdx]);
+					Binormals[VertexIdx * 3 + 0] = Binormal.X;
+					Binormals[VertexIdx * 3 + 1] = Binormal.Z;
+					Binormals[VertexIdx * 3 + 2] = Binormal.Y;
+				}
+			});
+		}
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// COLORS (Cd)
+		//---------------------------------------------------------------------------------------------------------------------
+		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
+		{
+			const FColorVertexBuffer& ColorVertexBuffer = bUseComponentOverrideColors
+				? *(StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors)
+				: LODResources.VertexBuffers.ColorVertexBuffer;
+
+			ColorsTask = LaunchMeshAttributeExtraction(NumVertexInstances, [&](int32 Start, int32 End)
+			{
+				for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+				{
+					const FLinearColor Color = ColorVertexBuffer.VertexColor(HoudiniVertexToUEVertex[VertexIdx]).ReinterpretAsLinear();
+					RGBColors[VertexIdx * 3 + 0] = Color.R;
+					RGBColors[VertexIdx * 3 + 1] = Color.G;
+					RGBColors[VertexIdx * 3 + 2] = Color.B;
+					Alphas[VertexIdx] = Color.A;
+				}
+			});
+		}
+
 		// Now transfer valid vertex instance attributes to Houdini vertex attributes
 
 		//--------------------------------------------------------------------------------------------------------------------- 
@@ -1840,6 +2288,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 					UVAttributeName += FString::Printf(TEXT("%d"), UVLayerIndex + 1);
 
 				// Create attribute for UVs
+				WaitForMeshAttributeExtraction(UVTasks[UVLayerIndex]);
 				HAPI_AttributeInfo AttributeInfoVertex;
 				FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -1865,6 +2314,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		if (bIsVertexInstanceNormalsValid)
 		{
 			// Create attribute for normals.
+			WaitForMeshAttributeExtraction(NormalsTask);
 			HAPI_AttributeInfo AttributeInfoVertex;
 			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -1889,6 +2339,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		if (bIsVertexInstanceTangentsValid)
 		{
 			// Create attribute for tangentu.
+			WaitForMeshAttributeExtraction(TangentsTask);
 			HAPI_AttributeInfo AttributeInfoVertex;
 			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -1912,7 +2363,8 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		//---------------------------------------------------------------------------------------------------------------------
 		if (bIsVertexInstanceBinormalsValid)
 		{
-			// Create attribute for normals.
+			// Create attribute for binormals.
+			WaitForMeshAttributeExtraction(BinormalsTask);
 			HAPI_AttributeInfo AttributeInfoVertex;
 			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -1937,6 +2389,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
 		{
 			// Create attribute for colors.
+			WaitForMeshAttributeExtraction(ColorsTask);
 			HAPI_AttributeInfo AttributeInfoVertex;
 			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -2584,10 +3037,16 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		TArray<int32> MeshTriangleVertexCounts;
 		MeshTriangleVertexCounts.SetNumUninitialized(NumTriangles);
 
+		// Vertex instances in Houdini vertex order, used by the attribute extraction below
+		TArray<FVertexInstanceID> OrderedVertexInstanceIDs;
+		OrderedVertexInstanceIDs.SetNumUninitialized(NumVertexInstances);
+
 		int32 TriangleIdx = 0;
 		int32 VertexInstanceIdx = 0;
 		for (const FPolygonID &PolygonID : MDPolygons.GetElementIDs())
 		{
+			const FPolygonGroupID &PolygonGroupID = MeshDescription.GetPolygonPolygonGroup(PolygonID);
+			const int32 MaterialIndex = PolygonGroupToMaterialIndex.FindChecked(PolygonGroupID);
 			for (const FTriangleID &TriangleID : MeshDescription.GetPolygonTriangleIDs(PolygonID))
 			{
 				MeshTriangleVertexCounts[TriangleIdx] = 3;
@@ -2596,93 +3055,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 					// Reverse the winding order for Houdini (but still start at 0)
 					const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
 					const FVertexInstanceID &VertexInstanceID = MeshDescription.GetTriangleVertexInstance(TriangleID, WindingIdx);
-
-					// // UE Vertex Instance ID to Houdini Vertex Index look up
-					// VertexInstanceIDToHIndex[VertexInstanceID.GetValue()] = VertexInstanceIdx;
-
-					// Calculate the index of the first component of a vertex instance's value in an inline float array 
-					// representing vectors (3 float) per vertex instance
-					const int32 Float3Index = VertexInstanceIdx * 3;
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// UVS (uvX)
-					//--------------------------------------------------------------------------------------------------------------------- 
-					if (bIsVertexInstanceUVsValid)
-					{
-						for (int32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
-						{
-							const FVector2D &UV = VertexInstanceUVs.Get(VertexInstanceID, UVLayerIndex);
-							UVs[UVLayerIndex][Float3Index + 0] = UV.X;
-							UVs[UVLayerIndex][Float3Index + 1] = 1.0f - UV.Y;
-							UVs[UVLayerIndex][Float3Index + 2] = 0;
-						}
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// NORMALS (N)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceNormalsValid)
-					{
-						const FVector &Normal = VertexInstanceNormals.Get(VertexInstanceID);
-						Normals[Float3Index + 0] = Normal.X;
-						Normals[Float3Index + 1] = Normal.Z;
-						Normals[Float3Index + 2] = Normal.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// TANGENT (tangentu)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceTangentsValid)
-					{
-						const FVector &Tangent = VertexInstanceTangents.Get(VertexInstanceID);
-						Tangents[Float3Index + 0] = Tangent.X;
-						Tangents[Float3Index + 1] = Tangent.Z;
-						Tangents[Float3Index + 2] = Tangent.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// BINORMAL (tangentv)
-					//---------------------------------------------------------------------------------------------------------------------
-					// In order to calculate the binormal we also need the tangent and normal
-					if (bIsVertexInstanceBinormalSignsValid && bIsVertexInstanceTangentsValid && bIsVertexInstanceNormalsValid)
-					{
-						const float &BinormalSign = VertexInstanceBinormalSigns.Get(VertexInstanceID);
-						FVector Binormal = FVector::CrossProduct(
-							FVector(Tangents[Float3Index + 0], Tangents[Float3Index + 1], Tangents[Float3Index + 2]),
-							FVector(Normals[Float3Index + 0], Normals[Float3Index + 1], Normals[Float3Index + 2])
-						) * BinormalSign;
-						Binormals[Float3Index + 0] = (float)Binormal.X;
-						Binormals[Float3Index + 1] = (float)Binormal.Y;
-						Binormals[Float3Index + 2] = (float)Binormal.Z;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// COLORS (Cd)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
-					{
-						FVector4 Color = FLinearColor::White;
-						if (bUseComponentOverrideColors && SMRenderData)
-						{
-							FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
-							FStaticMeshLODResources& RenderModel = SMRenderData->LODResources[InLODIndex];
-							FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
-
-							int32 Index = RenderModel.WedgeMap[VertexInstanceIdx];
-							if (Index != INDEX_NONE)
-							{
-								Color = ColorVertexBuffer.VertexColor(Index).ReinterpretAsLinear();
-							}
-						}
-						else
-						{
-							Color = VertexInstanceColors.Get(VertexInstanceID);
-						}
-						RGBColors[Float3Index + 0] = Color[0];
-						RGBColors[Float3Index + 1] = Color[1];
-						RGBColors[Float3Index + 2] = Color[2];
-						Alphas[VertexInstanceIdx] = Color[3];
-					}
+					OrderedVertexInstanceIDs[VertexInstanceIdx] = VertexInstanceID;
 
 					//--------------------------------------------------------------------------------------------------------------------- 
 					// TRIANGLE/FACE VERTEX INDICES
@@ -2700,14 +3073,147 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 				//--------------------------------------------------------------------------------------------------------------------- 
 				// TRIANGLE MATERIAL ASSIGNMENT
 				//---------------------------------------------------------------------------------------------------------------------
-				const FPolygonGroupID &PolygonGroupID = MeshDescription.GetPolygonPolygonGroup(PolygonID);
-				const int32 MaterialIndex = PolygonGroupToMaterialIndex.FindChecked(PolygonGroupID);
 				TriangleMaterialIndices.Add(MaterialIndex);
 
 				TriangleIdx++;
 			}
 		}
 
+		// Extract the vertex instance attributes: each attribute gets its own extraction task, and is sent
+		// to Houdini below as soon as it is ready, so uploading an attribute overlaps with extracting the next ones.
+		TArray<TFuture<void>> UVTasks;
+		TFuture<void> NormalsTask;
+		TFuture<void> TangentsTask;
+		TFuture<void> BinormalsTask;
+		TFuture<void> ColorsTask;
+
+		// The tasks write to the attribute arrays, make sure they are done before leaving this scope
+		ON_SCOPE_EXIT
+		{
+			for (TFuture<void>& UVTask : UVTasks)
+				WaitForMeshAttributeExtraction(UVTask);
+			WaitForMeshAttributeExtraction(NormalsTask);
+			WaitForMeshAttributeExtraction(TangentsTask);
+			WaitForMeshAttributeExtraction(BinormalsTask);
+			WaitForMeshAttributeExtraction(ColorsTask);
+		};
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// UVS (uvX)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		if (bIsVertexInstanceUVsValid)
+		{
+			UVTasks.Reserve(NumUVLayers);
+			for (int32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
+			{
+				UVTasks.Add(LaunchMeshAttributeExtraction(NumVertexInstances, [&, UVLayerIndex](int32 Start, int32 End)
+				{
+					TArray<float>& LayerUVs = UVs[UVLayerIndex];
+					for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+					{
+						const FVector2D &UV = VertexInstanceUVs.Get(OrderedVertexInstanceIDs[VertexIdx], UVLayerIndex);
+						LayerUVs[VertexIdx * 3 + 0] = UV.X;
+						LayerUVs[VertexIdx * 3 + 1] = 1.0f - UV.Y;
+						LayerUVs[VertexIdx * 3 + 2] = 0;
+					}
+				}));
+			}
+		}
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// NORMALS (N)
+		//---------------------------------------------------------------------------------------------------------------------
+		if (bIsVertexInstanceNormalsValid)
+		{
+			NormalsTask = LaunchMeshAttributeExtraction(NumVertexInstances, [&](int32 Start, int32 End)
+			{
+				for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+				{
+					const FVector &Normal = VertexInstanceNormals.Get(OrderedVertexInstanceIDs[VertexIdx]);
+					Normals[VertexIdx * 3 + 0] = Normal.X;
+					Normals[VertexIdx * 3 + 1] = Normal.Z;
+					Normals[VertexIdx * 3 + 2] = Normal.Y;
+				}
+			});
+		}
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// TANGENT (tangentu)
+		//---------------------------------------------------------------------------------------------------------------------
+		if (bIsVertexInstanceTangentsValid)
+		{
+			TangentsTask = LaunchMeshAttributeExtraction(NumVertexInstances, [&](int32 Start, int32 End)
+			{
+				for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+				{
+					const FVector &Tangent = VertexInstanceTangents.Get(OrderedVertexInstanceIDs[VertexIdx]);
+					Tangents[VertexIdx * 3 + 0] = Tangent.X;
+					Tangents[VertexIdx * 3 + 1] = Tangent.Z;
+					Tangents[VertexIdx * 3 + 2] = Tangent.Y;
+				}
+			});
+		}
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// BINORMAL (tangentv)
+		//---------------------------------------------------------------------------------------------------------------------
+		// In order to calculate the binormal we also need the tangent and normal, read them from the mesh description
+		// (converted to Houdini's axes) so that this task does not depend on the normal and tangent tasks
+		if (bIsVertexInstanceBinormalSignsValid && bIsVertexInstanceTangentsValid && bIsVertexInstanceNormalsValid)
+		{
+			BinormalsTask = LaunchMeshAttributeExtraction(NumVertexInstances, [&](int32 Start, int32 End)
+			{
+				for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+				{
+					const FVertexInstanceID &VertexInstanceID = OrderedVertexInstanceIDs[VertexIdx];
+					const FVector &Tangent = VertexInstanceTangents.Get(VertexInstanceID);
+					const FVector &Normal = VertexInstanceNormals.Get(VertexInstanceID);
+					const float &BinormalSign = VertexInstanceBinormalSigns.Get(VertexInstanceID);
+					FVector Binormal = FVector::CrossProduct(
+						FVector(Tangent.X, Tangent.Z, Tangent.Y),
+						FVector(Normal.X, Normal.Z, Normal.Y)
+					) * BinormalSign;
+					Binormals[VertexIdx * 3 + 0] = (float)Binormal.X;
+					Binormals[VertexIdx * 3 + 1] = (float)Binormal.Y;
+					Binormals[VertexIdx * 3 + 2] = (float)Binormal.Z;
+				}
+			});
+		}
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// COLORS (Cd)
+		//---------------------------------------------------------------------------------------------------------------------
+		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
+		{
+			ColorsTask = LaunchMeshAttributeExtraction(NumVertexInstances, [&](int32 Start, int32 End)
+			{
+				for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+				{
+					FVector4 Color = FLinearColor::White;
+					if (bUseComponentOverrideColors && SMRenderData)
+					{
+						FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
+						FStaticMeshLODResources& RenderModel = SMRenderData->LODResources[InLODIndex];
+						FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
+
+						int32 Index = RenderModel.WedgeMap[VertexIdx];
+						if (Index != INDEX_NONE)
+						{
+							Color = ColorVertexBuffer.VertexColor(Index).ReinterpretAsLinear();
+						}
+					}
+					else
+					{
+						Color = VertexInstanceColors.Get(OrderedVertexInstanceIDs[VertexIdx]);
+					}
+					RGBColors[VertexIdx * 3 + 0] = Color[0];
+					RGBColors[VertexIdx * 3 + 1] = Color[1];
+					RGBColors[VertexIdx * 3 + 2] = Color[2];
+					Alphas[VertexIdx] = Color[3];
+				}
+			});
+		}
+
 		// Now transfer valid vertex instance attributes to Houdini vertex attributes
 
 		//--------------------------------------------------------------------------------------------------------------------- 
@@ -2723,6 +3229,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 					UVAttributeName += FString::Printf(TEXT("%d"), UVLayerIndex + 1);
 
 				// Create attribute for UVs
+				WaitForMeshAttributeExtraction(UVTasks[UVLayerIndex]);
 				HAPI_AttributeInfo AttributeInfoVertex;
 				FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -2748,6 +3255,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		if (bIsVertexInstanceNormalsValid)
 		{
 			// Create attribute for normals.
+			WaitForMeshAttributeExtraction(NormalsTask);
 			HAPI_AttributeInfo AttributeInfoVertex;
 			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -2772,6 +3280,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		if (bIsVertexInstanceTangentsValid)
 		{
 			// Create attribute for tangentu.
+			WaitForMeshAttributeExtraction(TangentsTask);
 			HAPI_AttributeInfo AttributeInfoVertex;
 			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -2795,7 +3304,8 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		//---------------------------------------------------------------------------------------------------------------------
 		if (bIsVertexInstanceBinormalSignsValid)
 		{
-			// Create attribute for normals.
+			// Create attribute for binormals.
+			WaitForMeshAttributeExtraction(BinormalsTask);
 			HAPI_AttributeInfo AttributeInfoVertex;
 			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
@@ -2820,6 +3330,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
 		{
 			// Create attribute for colors.
+			WaitForMeshAttributeExtraction(ColorsTask);
 			HAPI_AttributeInfo AttributeInfoVertex;
 			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
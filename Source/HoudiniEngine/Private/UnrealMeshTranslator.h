@@ -46,6 +46,7 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 	public:
 
 		// HAPI : Marshaling, extract geometry and create input asset for it - return true on success
+		// Without a component, the returned node may object merge a shared node and must not be edited.
 		static bool HapiCreateInputNodeForStaticMesh(
 			UStaticMesh * Mesh,
 			HAPI_NodeId& InputObjectNodeId,
@@ -55,6 +56,67 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			const bool& ExportSockets = false,
 			const bool& ExportColliders = false);
 
+		// HAPI : Creates the input node for a static mesh without any component overrides.
+		// The mesh data is uploaded once per session to a shared node, keyed on the mesh's content hash 
+		// and the export options, and the returned input node simply object merges that shared node.
+		static bool HapiCreateInputNodeForStaticMesh_Shared(
+			UStaticMesh * Mesh,
+			HAPI_NodeId& InputObjectNodeId,
+			const FString& InputNodeName,
+			const bool& ExportAllLODs,
+			const bool& ExportSockets,
+			const bool& ExportColliders);
+
+		// HAPI : Marshal the static mesh to a new input node, without using the shared node cache.
+		// The returned node is owned by the caller and can be edited (ie. to add attributes).
+		static bool HapiCreateInputNodeForStaticMesh_Direct(
+			UStaticMesh * Mesh,
+			HAPI_NodeId& InputObjectNodeId,
+			const FString& InputNodeName,
+			class UStaticMeshComponent* StaticMeshComponent,
+			const bool& ExportAllLODs,
+			const bool& ExportSockets,
+			const bool& ExportColliders);
+
+		// Returns a hash of the static mesh's content that is sent to Houdini for the given export options
+		static uint32 GetStaticMeshContentHash(
+			UStaticMesh* StaticMesh,
+			const bool& ExportAllLODs,
+			const bool& ExportSockets,
+			const bool& ExportColliders);
+
+		// Returns the key of the shared node for the given mesh and export options
+		static FString GetSharedStaticMeshInputNodeKey(
+			UStaticMesh* StaticMesh,
+			const bool& ExportAllLODs,
+			const bool& ExportSockets,
+			const bool& ExportColliders);
+
+		// Returns the valid shared node for the given key, or creates it with InCreateSharedNode
+		static bool FindOrCreateSharedStaticMeshNode(
+			const FString& InSharedKey,
+			const TFunctionRef<bool(HAPI_NodeId&)>& InCreateSharedNode,
+			HAPI_NodeId& OutSharedNodeId);
+
+		// Registers an input node as a user of the shared node for the given key
+		static void AddSharedStaticMeshInputNodeUser(const FString& InSharedKey, const HAPI_NodeId& InInputNodeId);
+
+		// Returns the shared node used by an input node, or -1 if it doesn't use one
+		static HAPI_NodeId GetSharedStaticMeshNodeForInputNode(const HAPI_NodeId& InInputNodeId);
+
+		// Returns the number of shared static mesh nodes currently in the cache
+		static int32 GetNumSharedStaticMeshNodes();
+
+		// Releases the reference an input node had on a shared static mesh node (if any).
+		// Should be called before deleting a static mesh input node.
+		static void ReleaseSharedStaticMeshInputNode(const HAPI_NodeId& InInputNodeId);
+
+		// Forgets all the shared static mesh nodes. Used when the session is stopped or lost.
+		static void ClearSharedStaticMeshInputNodes();
+
+		// Deletes the unreferenced shared static mesh nodes exceeding the cache budget
+		static void EvictUnusedSharedStaticMeshInputNodes();
+
 		// Convert the Mesh using FStaticMeshLODResources
 		static bool CreateInputNodeForStaticMeshLODResources(
 			const HAPI_NodeId& NodeId,
@@ -83,11 +83,15 @@ FUnrealSplineTranslator::CreateInputNodeForSplineComponent(USplineComponent* Spl
 		}
 	}
 
+	// Large splines are sent as float data even when using legacy curves, as the curve::1.0 coords string gets very slow to create
+	const bool bUseLegacyCurve = bInUseLegacyInputCurves
+		&& !FHoudiniSplineTranslator::ShouldUploadLegacyCurveAsFloatData(RefinedSplinePositions.Num());
+
 	if (!FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 		CreatedInputNodeId, NodeName,
 		&RefinedSplinePositions, &RefinedSplineRotations, &RefinedSplineScales,
 		EHoudiniCurveType::Polygon, EHoudiniCurveMethod::Breakpoints, SplineComponent->IsClosedLoop(), false,
-		false, FTransform::Identity, bInUseLegacyInputCurves))
+		false, FTransform::Identity, bUseLegacyCurve))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to create the input curve data!"));
 		return false;
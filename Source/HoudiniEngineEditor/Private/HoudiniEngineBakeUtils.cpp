@@ -102,6 +102,7 @@
 #include "UObject/UnrealType.h"
 #include "Math/Box.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Misc/PackageName.h"
 #include "Kismet2/ComponentEditorUtils.h"
 
 #include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionComponent.h"
@@ -153,6 +154,249 @@ FHoudiniEngineBakedActor::FHoudiniEngineBakedActor(
 {
 }
 
+FHoudiniEngineBakePlanner* FHoudiniEngineBakePlanner::ActivePlanner = nullptr;
+
+FHoudiniEngineBakePlanner::FHoudiniEngineBakePlanner(const FString& InBakeName)
+	: BakeName(InBakeName)
+	, Outer(ActivePlanner)
+	, NumObjectsToBake(0)
+	, NumPackagesLoaded(0)
+	, bSaveCurrentWorld(false)
+	, NumPackagesSaved(0)
+	, CurrentPhase(0)
+	, PhaseStartTime(FPlatformTime::Seconds())
+{
+	for (double& PhaseTime : PhaseTimes)
+		PhaseTime = 0.0;
+
+	if (IsOutermost())
+		ActivePlanner = this;
+}
+
+FHoudiniEngineBakePlanner::~FHoudiniEngineBakePlanner()
+{
+	if (!IsOutermost())
+		return;
+
+	EndPhase();
+
+	if (ActivePlanner == this)
+		ActivePlanner = nullptr;
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Baked %s: planned %d output objects in %.3fs, loaded %d previous bake packages in %.3fs, baked in %.3fs, saved %d packages in %.3fs."),
+		*BakeName, NumObjectsToBake, PhaseTimes[0], NumPackagesLoaded, PhaseTimes[1], PhaseTimes[2], NumPackagesSaved, PhaseTimes[3]);
+}
+
+void
+FHoudiniEngineBakePlanner::EndPhase()
+{
+	if (CurrentPhase > 3)
+		return;
+
+	const double Now = FPlatformTime::Seconds();
+	PhaseTimes[CurrentPhase] += Now - PhaseStartTime;
+	PhaseStartTime = Now;
+	CurrentPhase++;
+}
+
+void
+FHoudiniEngineBakePlanner::PlanHoudiniAssetComponent(const UHoudiniAssetComponent* InHAC)
+{
+	if (!IsOutermost() || !IsValid(InHAC))
+		return;
+
+	TArray<UHoudiniOutput*> Outputs;
+	InHAC->GetOutputs(Outputs);
+	PlanOutputs(Outputs, InHAC->GetBakedOutputs());
+}
+
+void
+FHoudiniEngineBakePlanner::PlanPDGNode(UTOPNode* InNode)
+{
+	if (!IsOutermost() || !IsValid(InNode))
+		return;
+
+	for (int32 WorkResultArrayIdx = 0; WorkResultArrayIdx < InNode->WorkResult.Num(); ++WorkResultArrayIdx)
+	{
+		FTOPWorkResult& WorkResult = InNode->WorkResult[WorkResultArrayIdx];
+		for (int32 WorkResultObjectArrayIdx = 0; WorkResultObjectArrayIdx < WorkResult.ResultObjects.Num(); ++WorkResultObjectArrayIdx)
+		{
+			FTOPWorkResultObject& WorkResultObject = WorkResult.ResultObjects[WorkResultObjectArrayIdx];
+			if (WorkResultObject.State != EPDGWorkResultState::Loaded)
+				continue;
+
+			FHoudiniPDGWorkResultObjectBakedOutput const* BakedOutputContainer = nullptr;
+			if (InNode->GetBakedWorkResultObjectOutputs(WorkResultArrayIdx, WorkResultObjectArrayIdx, BakedOutputContainer) && BakedOutputContainer)
+				PlanOutputs(WorkResultObject.GetResultOutputs(), BakedOutputContainer->BakedOutputs);
+			else
+				PlanOutputs(WorkResultObject.GetResultOutputs(), TArray<FHoudiniBakedOutput>());
+		}
+	}
+}
+
+void
+FHoudiniEngineBakePlanner::PlanPDGAssetLink(UHoudiniPDGAssetLink* InPDGAssetLink, const EPDGBakeSelectionOption& InBakeSelectionOption)
+{
+	if (!IsOutermost() || !IsValid(InPDGAssetLink))
+		return;
+
+	switch (InBakeSelectionOption)
+	{
+		case EPDGBakeSelectionOption::All:
+			for (UTOPNetwork* Network : InPDGAssetLink->AllTOPNetworks)
+			{
+				if (!IsValid(Network))
+					continue;
+
+				for (UTOPNode* Node : Network->AllTOPNodes)
+					PlanPDGNode(Node);
+			}
+			break;
+
+		case EPDGBakeSelectionOption::SelectedNetwork:
+		{
+			UTOPNetwork* Network = InPDGAssetLink->GetSelectedTOPNetwork();
+			if (IsValid(Network))
+			{
+				for (UTOPNode* Node : Network->AllTOPNodes)
+					PlanPDGNode(Node);
+			}
+			break;
+		}
+
+		case EPDGBakeSelectionOption::SelectedNode:
+			PlanPDGNode(InPDGAssetLink->GetSelectedTOPNode());
+			break;
+	}
+}
+
+void
+FHoudiniEngineBakePlanner::PlanOutputs(const TArray<UHoudiniOutput*>& InOutputs, const TArray<FHoudiniBakedOutput>& InBakedOutputs)
+{
+	if (!IsOutermost())
+		return;
+
+	for (const UHoudiniOutput* Output : InOutputs)
+	{
+		if (IsValid(Output))
+			NumObjectsToBake += Output->GetOutputObjects().Num();
+	}
+
+	// The previously baked assets are loaded when replacing them, or to get their bake counter
+	auto AddPreviousBakePackage = [this](const FString& InObjectPath)
+	{
+		if (InObjectPath.IsEmpty())
+			return;
+
+		const FString PackageName = FSoftObjectPath(InObjectPath).GetLongPackageName();
+		if (!PackageName.IsEmpty())
+			PreviousBakePackageNames.Add(PackageName);
+	};
+
+	for (const FHoudiniBakedOutput& BakedOutput : InBakedOutputs)
+	{
+		for (const auto& Entry : BakedOutput.BakedOutputObjects)
+		{
+			AddPreviousBakePackage(Entry.Value.BakedObject);
+			AddPreviousBakePackage(Entry.Value.Blueprint);
+			for (const auto& LayerEntry : Entry.Value.LandscapeLayers)
+				AddPreviousBakePackage(LayerEntry.Value);
+		}
+	}
+}
+
+void
+FHoudiniEngineBakePlanner::BeginBake()
+{
+	if (!IsOutermost() || CurrentPhase != 0)
+		return;
+
+	EndPhase();
+
+	// Load, bake and save steps
+	Progress = MakeUnique<FScopedSlowTask>(2.0f + FMath::Max(NumObjectsToBake, 1),
+		FText::FromString(FString::Printf(TEXT("Baking %s ..."), *BakeName)));
+	Progress->MakeDialog();
+
+	// Request all the previously baked packages that are on disk but not loaded yet, and wait for them once.
+	// The packages are then already loaded when the bake needs them.
+	Progress->EnterProgressFrame(1.0f, FText::FromString(FString::Printf(
+		TEXT("Loading %d previously baked packages ..."), PreviousBakePackageNames.Num())));
+	for (const FString& PackageName : PreviousBakePackageNames)
+	{
+		UPackage* const Package = FindPackage(nullptr, *PackageName);
+		if (Package && Package->IsFullyLoaded())
+			continue;
+
+		if (!FPackageName::DoesPackageExist(PackageName))
+			continue;
+
+		LoadPackageAsync(PackageName);
+		NumPackagesLoaded++;
+	}
+
+	if (NumPackagesLoaded > 0)
+		FlushAsyncLoading();
+
+	EndPhase();
+
+	Progress->EnterProgressFrame(FMath::Max(NumObjectsToBake, 1), FText::FromString(FString::Printf(
+		TEXT("Baking %d output objects ..."), NumObjectsToBake)));
+}
+
+void
+FHoudiniEngineBakePlanner::AddPackagesToSave(const TArray<UPackage*>& InPackagesToSave, bool bInSaveCurrentWorld)
+{
+	FHoudiniEngineBakePlanner* const Outermost = IsOutermost() ? this : Outer;
+	for (UPackage* Package : InPackagesToSave)
+	{
+		if (!IsValid(Package))
+			continue;
+
+		bool bAlreadyAdded = false;
+		Outermost->PackagesToSaveSet.Add(Package, &bAlreadyAdded);
+		if (!bAlreadyAdded)
+			Outermost->PackagesToSave.Add(Package);
+	}
+
+	Outermost->bSaveCurrentWorld |= bInSaveCurrentWorld;
+}
+
+void
+FHoudiniEngineBakePlanner::SavePackages(const TArray<UPackage*>& InPackagesToSave, bool bInSaveCurrentWorld)
+{
+	AddPackagesToSave(InPackagesToSave, bInSaveCurrentWorld);
+	if (!IsOutermost() || CurrentPhase > 2)
+		return;
+
+	// The bake is done, skip the load phase if BeginBake wasn't called
+	while (CurrentPhase < 3)
+		EndPhase();
+
+	if (Progress.IsValid())
+	{
+		Progress->EnterProgressFrame(1.0f, FText::FromString(FString::Printf(
+			TEXT("Saving %d packages ..."), PackagesToSave.Num())));
+	}
+
+	for (UPackage* Package : PackagesToSave)
+	{
+		if (IsValid(Package) && Package->IsDirty())
+			NumPackagesSaved++;
+	}
+
+	// Packages saved after this point (post bake) are saved directly
+	if (ActivePlanner == this)
+		ActivePlanner = nullptr;
+
+	FHoudiniEngineBakeUtils::SaveBakedPackages(PackagesToSave, bSaveCurrentWorld);
+	PackagesToSave.Empty();
+	PackagesToSaveSet.Empty();
+
+	EndPhase();
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 	UHoudiniAssetComponent* InHACToBake,
@@ -222,6 +466,10 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors(
 	TArray<UPackage*> PackagesToSave;
 	FHoudiniEngineOutputStats BakeStats;
 
+	FHoudiniEngineBakePlanner BakePlanner(HoudiniAssetComponent->GetDisplayName());
+	BakePlanner.PlanHoudiniAssetComponent(HoudiniAssetComponent);
+	BakePlanner.BeginBake();
+
 	const bool bBakedWithErrors = !FHoudiniEngineBakeUtils::BakeHoudiniActorToActors(
 		HoudiniAssetComponent, bInReplaceActors, bInReplaceAssets, NewActors, PackagesToSave, BakeStats);
 	if (bBakedWithErrors)
@@ -231,7 +479,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors(
 	}
 
 	// Save the created packages
-	FHoudiniEngineBakeUtils::SaveBakedPackages(PackagesToSave);
+	BakePlanner.SavePackages(PackagesToSave);
 
 	// Recenter and select the baked actors
 	if (GEditor && NewActors.Num() > 0)
@@ -3370,6 +3618,11 @@ FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniAssetComponent* HoudiniAssetComp
 	FHoudiniEngineOutputStats BakeStats;
 	TArray<UPackage*> PackagesToSave;
 	TArray<UBlueprint*> Blueprints;
+
+	FHoudiniEngineBakePlanner BakePlanner(IsValid(HoudiniAssetComponent) ? HoudiniAssetComponent->GetDisplayName() : FString());
+	BakePlanner.PlanHoudiniAssetComponent(HoudiniAssetComponent);
+	BakePlanner.BeginBake();
+
 	const bool bSuccess = BakeBlueprints(HoudiniAssetComponent, bInReplaceAssets, bInRecenterBakedActors, BakeStats, Blueprints, PackagesToSave);
 	if (!bSuccess)
 	{
@@ -3385,7 +3638,7 @@ FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniAssetComponent* HoudiniAssetComp
 		
 		FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	}
-	FHoudiniEngineBakeUtils::SaveBakedPackages(PackagesToSave);
+	BakePlanner.SavePackages(PackagesToSave);
 
 	// Sync the CB to the baked objects
 	if(GEditor && Blueprints.Num() > 0)
@@ -5210,6 +5463,14 @@ FHoudiniEngineBakeUtils::DeleteBakedHoudiniAssetActor(UHoudiniAssetComponent* Ho
 void 
 FHoudiniEngineBakeUtils::SaveBakedPackages(TArray<UPackage*> & PackagesToSave, bool bSaveCurrentWorld) 
 {
+	// When a bake planner is active, the packages are saved with the others at the end of the bake
+	FHoudiniEngineBakePlanner* const BakePlanner = FHoudiniEngineBakePlanner::GetActive();
+	if (BakePlanner)
+	{
+		BakePlanner->AddPackagesToSave(PackagesToSave, bSaveCurrentWorld);
+		return;
+	}
+
 	UWorld * CurrentWorld = nullptr;
 	if (bSaveCurrentWorld && GEditor)
 		CurrentWorld = GEditor->GetEditorWorldContext().World();
@@ -6166,10 +6427,14 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors(UHoudiniPDGAssetLink* I
 
 	const bool bBakeBlueprints = false;
 
+	FHoudiniEngineBakePlanner BakePlanner(IsValid(InTOPNode) ? InTOPNode->GetName() : FString());
+	BakePlanner.PlanPDGNode(InTOPNode);
+	BakePlanner.BeginBake();
+
 	bool bSuccess = BakePDGTOPNodeOutputsKeepActors(
 		InPDGAssetLink, InTOPNode, bBakeBlueprints, bInIsAutoBake, InPDGBakePackageReplaceMode, BakedActors, PackagesToSave, BakeStats);
 
-	SaveBakedPackages(PackagesToSave);
+	BakePlanner.SavePackages(PackagesToSave);
 
 	// Recenter and select the baked actors
 	if (GEditor && BakedActors.Num() > 0)
@@ -6241,6 +6506,10 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkOutputsKeepActors(UHoudiniPDGAssetLink*
 	const bool bBakeBlueprints = false;
 	const bool bIsAutoBake = false;
 
+	FHoudiniEngineBakePlanner BakePlanner(InPDGAssetLink->GetName());
+	BakePlanner.PlanPDGAssetLink(InPDGAssetLink, InBakeSelectionOption);
+	BakePlanner.BeginBake();
+
 	bool bSuccess = true;
 	switch(InBakeSelectionOption)
 	{
@@ -6265,7 +6534,7 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkOutputsKeepActors(UHoudiniPDGAssetLink*
 			bSuccess = BakePDGTOPNodeOutputsKeepActors(InPDGAssetLink, InPDGAssetLink->GetSelectedTOPNode(), bBakeBlueprints, bIsAutoBake, InPDGBakePackageReplaceMode, BakedActors, PackagesToSave, BakeStats);
 	}
 
-	SaveBakedPackages(PackagesToSave);
+	BakePlanner.SavePackages(PackagesToSave);
 
 	// Recenter and select the baked actors
 	if (GEditor && BakedActors.Num() > 0)
@@ -6647,6 +6916,10 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(UHoudiniPDGAssetLink* InPDGAss
 	if (!IsValid(InPDGAssetLink))
 		return false;
 
+	FHoudiniEngineBakePlanner BakePlanner(IsValid(InTOPNode) ? InTOPNode->GetName() : FString());
+	BakePlanner.PlanPDGNode(InTOPNode);
+	BakePlanner.BeginBake();
+
 	const bool bSuccess = BakePDGTOPNodeBlueprints(
 		InPDGAssetLink,
 		InTOPNode,
@@ -6665,7 +6938,7 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(UHoudiniPDGAssetLink* InPDGAss
 		
 		FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	}
-	FHoudiniEngineBakeUtils::SaveBakedPackages(PackagesToSave);
+	BakePlanner.SavePackages(PackagesToSave);
 
 	// Sync the CB to the baked objects
 	if(GEditor && Blueprints.Num() > 0)
@@ -6730,6 +7003,11 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkBlueprints(UHoudiniPDGAssetLink* InPDGA
 		return false;
 
 	const bool bIsAutoBake = false;
+
+	FHoudiniEngineBakePlanner BakePlanner(InPDGAssetLink->GetName());
+	BakePlanner.PlanPDGAssetLink(InPDGAssetLink, InBakeSelectionOption);
+	BakePlanner.BeginBake();
+
 	bool bSuccess = true;
 	switch(InBakeSelectionOption)
 	{
@@ -6777,7 +7055,7 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkBlueprints(UHoudiniPDGAssetLink* InPDGA
 		
 		FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	}
-	FHoudiniEngineBakeUtils::SaveBakedPackages(PackagesToSave);
+	BakePlanner.SavePackages(PackagesToSave);
 
 	// Sync the CB to the baked objects
 	if(GEditor && Blueprints.Num() > 0)
@@ -47,6 +47,8 @@ class UGeometryCollection;
 class UGeometryCollectionComponent;
 class AGeometryCollectionActor;
 
+struct FScopedSlowTask;
+
 struct FHoudiniPackageParams;
 struct FHoudiniGeoPartObject;
 struct FHoudiniOutputObject;
@@ -145,6 +147,67 @@ struct HOUDINIENGINEEDITOR_API FHoudiniEngineBakedActor
 
 };
 
+// Runs a bake in phases:
+// - Plan: collect the output objects to bake and the previously baked packages they could replace,
+// - Load: load all these packages asynchronously in a single batch, instead of one blocking load per asset,
+// - Bake: duplicate the assets and create the actors (on the game thread),
+// - Save: save all the dirty packages in one batch.
+// Progress is reported in a slow task dialog, and the time spent in each phase is logged at the end.
+// Planners created while another one is active (ie, baking a PDG network node by node) join the outermost one,
+// so that its packages are only saved once.
+struct HOUDINIENGINEEDITOR_API FHoudiniEngineBakePlanner
+{
+public:
+	FHoudiniEngineBakePlanner(const FString& InBakeName);
+	~FHoudiniEngineBakePlanner();
+
+	// Add the outputs of a HAC / PDG node / PDG asset link to the plan
+	void PlanHoudiniAssetComponent(const UHoudiniAssetComponent* InHAC);
+	void PlanPDGNode(UTOPNode* InNode);
+	void PlanPDGAssetLink(UHoudiniPDGAssetLink* InPDGAssetLink, const EPDGBakeSelectionOption& InBakeSelectionOption);
+	void PlanOutputs(const TArray<UHoudiniOutput*>& InOutputs, const TArray<FHoudiniBakedOutput>& InBakedOutputs);
+
+	// Loads the previously baked packages found by the plan, and starts the bake phase
+	void BeginBake();
+
+	// Adds packages to the final save
+	void AddPackagesToSave(const TArray<UPackage*>& InPackagesToSave, bool bInSaveCurrentWorld = false);
+
+	// Ends the bake: the outermost planner saves the packages of all the planners that joined it.
+	// Nested planners only add their packages to the outermost's.
+	void SavePackages(const TArray<UPackage*>& InPackagesToSave, bool bInSaveCurrentWorld = false);
+
+	bool IsOutermost() const { return Outer == nullptr; };
+
+	// The outermost planner, if a bake is in progress
+	static FHoudiniEngineBakePlanner* GetActive() { return ActivePlanner; };
+
+protected:
+	void EndPhase();
+
+	FString BakeName;
+	FHoudiniEngineBakePlanner* Outer;
+
+	int32 NumObjectsToBake;
+	TSet<FString> PreviousBakePackageNames;
+	int32 NumPackagesLoaded;
+
+	// Packages to save in the order they were added, deduplicated with PackagesToSaveSet
+	TArray<UPackage*> PackagesToSave;
+	TSet<UPackage*> PackagesToSaveSet;
+	bool bSaveCurrentWorld;
+	int32 NumPackagesSaved;
+
+	// Phases: 0 plan, 1 load, 2 bake, 3 save
+	int32 CurrentPhase;
+	double PhaseStartTime;
+	double PhaseTimes[4];
+
+	TUniquePtr<FScopedSlowTask> Progress;
+
+	static FHoudiniEngineBakePlanner* ActivePlanner;
+};
+
 struct HOUDINIENGINEEDITOR_API FHoudiniEngineBakeUtils
 {
 public:
@@ -1203,6 +1203,15 @@ FHoudiniEngineCommands::RestartSession()
 	MarkAllHACsAsNeedInstantiation();
 }
 
+void
+FHoudiniEngineCommands::RestartSessionAsync()
+{
+	if (!FHoudiniEngine::IsAsyncSessionStartEnabled())
+		return RestartSession();
+
+	FHoudiniEngine::Get().RestartSessionAsync(true);
+}
+
 void 
 FHoudiniEngineCommands::CreateSession()
 {
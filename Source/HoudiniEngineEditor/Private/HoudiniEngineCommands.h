@@ -70,6 +70,10 @@ public:
 	// Helper function for restarting the current Houdini Engine session.
 	static void RestartSession();
 
+	// Restarts the current session in the background if HoudiniEngine.AsyncSessionStart is enabled,
+	// the assets are re-instantiated once the new session is ready.
+	static void RestartSessionAsync();
+
 	// Menu action to pause cooking for all Houdini Assets 
 	static void PauseAssetCooking();
 
@@ -42,6 +42,7 @@
 #include "HoudiniOutput.h"
 #include "HoudiniParameter.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniAssetLibraryRegistry.h"
 #include "HoudiniEngineCommands.h"
 #include "HoudiniRuntimeSettingsDetails.h"
 #include "HoudiniSplineComponentVisualizer.h"
@@ -353,7 +354,7 @@ FHoudiniEngineEditor::BindMenuCommands()
 
 	HEngineCommands->MapAction(
 		Commands._RestartSession,
-		FExecuteAction::CreateLambda([]() { return FHoudiniEngineCommands::RestartSession(); }),
+		FExecuteAction::CreateLambda([]() { return FHoudiniEngineCommands::RestartSessionAsync(); }),
 		FCanExecuteAction::CreateLambda([]() { return true; }));
 	
 	HEngineCommands->MapAction(
@@ -1225,7 +1226,7 @@ FHoudiniEngineEditor::RegisterConsoleCommands()
 	static FAutoConsoleCommand CCmdRestartSession = FAutoConsoleCommand(
 		TEXT("Houdini.RestartSession"),
 		TEXT("Restart the current Houdini Session."),
-		FConsoleCommandDelegate::CreateStatic(&FHoudiniEngineCommands::RestartSession));
+		FConsoleCommandDelegate::CreateStatic(&FHoudiniEngineCommands::RestartSessionAsync));
 
 	/*
 	IConsoleManager &ConsoleManager = IConsoleManager::Get();
@@ -1337,7 +1338,7 @@ FHoudiniEngineEditor::RegisterEditorDelegates()
 					// We need to restart the current Houdini Engine Session
 					// This will reuse the previous session if it didnt shutdown, or start a new one if needed.
 					// (HARS shuts down when stopping the session, so we cant just reconnect when not using Session Sync)
-					FHoudiniEngineCommands::RestartSession();
+					FHoudiniEngineCommands::RestartSessionAsync();
 				}
 				FEditorDelegates::EndPIE.Remove(EndPIEEditorDelegateHandle);
 			});
@@ -1348,6 +1349,13 @@ FHoudiniEngineEditor::RegisterEditorDelegates()
 
 	OnDeleteActorsBegin = FEditorDelegates::OnDeleteActorsBegin.AddLambda([this](){ this->HandleOnDeleteActorsBegin(); });
 	OnDeleteActorsEnd = FEditorDelegates::OnDeleteActorsEnd.AddLambda([this](){ this-> HandleOnDeleteActorsEnd(); });
+
+	// Prewarm the asset libraries used by the level while the session starts / before its components get instantiated
+	OnMapOpenedEditorDelegateHandle = FEditorDelegates::OnMapOpened.AddLambda([](const FString& Filename, bool bAsTemplate)
+	{
+		if (GEditor)
+			FHoudiniAssetLibraryRegistry::PrewarmWorld(GEditor->GetEditorWorldContext().World());
+	});
 }
 
 void
@@ -1367,6 +1375,9 @@ FHoudiniEngineEditor::UnregisterEditorDelegates()
 
 	if (OnDeleteActorsEnd.IsValid())
 		FEditorDelegates::OnDeleteActorsEnd.Remove(OnDeleteActorsEnd);
+
+	if (OnMapOpenedEditorDelegateHandle.IsValid())
+		FEditorDelegates::OnMapOpened.Remove(OnMapOpenedEditorDelegateHandle);
 }
 
 FString 
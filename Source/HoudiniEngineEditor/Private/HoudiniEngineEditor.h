@@ -348,6 +348,9 @@ class HOUDINIENGINEEDITOR_API FHoudiniEngineEditor : public IHoudiniEngineEditor
 		// Delegate handle for OnDeleteActorsEnd
 		FDelegateHandle OnDeleteActorsEnd;
 
+		// Delegate handle for the OnMapOpened editor delegate
+		FDelegateHandle OnMapOpenedEditorDelegateHandle;
+
 		// List of actors that HandleOnDeleteActorsBegin marked to _not_ be deleted. This
 		// is used to re-select these actors in HandleOnDeleteActorsEnd.
 		TArray<AActor*> ActorsToReselectOnDeleteActorsEnd;
@@ -1948,6 +1948,22 @@ bool FHoudiniEditorEquivalenceUtils::IsEquivalent(const UHoudiniStaticMesh* A, c
 	{
 		Result &= TestExpressionError(IsEquivalent(A->VertexInstanceUVs[i], B->VertexInstanceUVs[i]), Header, "VertexInstanceUVs");
 	}
+	Result &= TestExpressionError(A->bHasPackedVertexData == B->bHasPackedVertexData, Header, "bHasPackedVertexData");
+	Result &= TestExpressionError(A->VertexInstancePackedTangentX.Num() == B->VertexInstancePackedTangentX.Num(), Header, "VertexInstancePackedTangentX.Num");
+	for (int i = 0; i < FMath::Min(A->VertexInstancePackedTangentX.Num(), B->VertexInstancePackedTangentX.Num()); i++)
+	{
+		Result &= TestExpressionError(A->VertexInstancePackedTangentX[i] == B->VertexInstancePackedTangentX[i], Header, "VertexInstancePackedTangentX");
+	}
+	Result &= TestExpressionError(A->VertexInstancePackedTangentZ.Num() == B->VertexInstancePackedTangentZ.Num(), Header, "VertexInstancePackedTangentZ.Num");
+	for (int i = 0; i < FMath::Min(A->VertexInstancePackedTangentZ.Num(), B->VertexInstancePackedTangentZ.Num()); i++)
+	{
+		Result &= TestExpressionError(A->VertexInstancePackedTangentZ[i] == B->VertexInstancePackedTangentZ[i], Header, "VertexInstancePackedTangentZ");
+	}
+	Result &= TestExpressionError(A->VertexInstancePackedUVs.Num() == B->VertexInstancePackedUVs.Num(), Header, "VertexInstancePackedUVs.Num");
+	for (int i = 0; i < FMath::Min(A->VertexInstancePackedUVs.Num(), B->VertexInstancePackedUVs.Num()); i++)
+	{
+		Result &= TestExpressionError(IsEquivalent(FVector2D(A->VertexInstancePackedUVs[i]), FVector2D(B->VertexInstancePackedUVs[i])), Header, "VertexInstancePackedUVs");
+	}
 	Result &= TestExpressionError(A->MaterialIDsPerTriangle.Num() == B->MaterialIDsPerTriangle.Num(), Header, "MaterialIDsPerTriangle.Num");
 	for (int i = 0; i < FMath::Min(A->MaterialIDsPerTriangle.Num(), B->MaterialIDsPerTriangle.Num()); i++)
 	{
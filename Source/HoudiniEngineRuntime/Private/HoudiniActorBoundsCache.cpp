@@ -0,0 +1,148 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniActorBoundsCache.h"
+
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_EDITOR
+namespace
+{
+	// Content versions of the actors whose bounds have been cached, only accessed on the game thread
+	TMap<TWeakObjectPtr<const AActor>, uint32> ActorContentVersions;
+
+	bool bEventsBound = false;
+	FDelegateHandle OnObjectModifiedHandle;
+	FDelegateHandle OnObjectPropertyChangedHandle;
+
+	void BumpContentVersion(UObject* InObject)
+	{
+		if (!InObject || ActorContentVersions.Num() <= 0)
+			return;
+
+		// Landscape sculpting modifies the landscape's components, not the actor itself
+		const AActor* Actor = Cast<AActor>(InObject);
+		if (!Actor)
+			Actor = InObject->GetTypedOuter<AActor>();
+
+		if (uint32* FoundVersion = ActorContentVersions.Find(Actor))
+			++(*FoundVersion);
+	}
+
+	void OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent)
+	{
+		BumpContentVersion(InObject);
+	}
+
+	void BindEvents()
+	{
+		if (bEventsBound)
+			return;
+
+		// Modify() is called before the change and PostEditChangeProperty() after it, bump on both
+		// so bounds queried in between aren't kept once the change is applied
+		OnObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&BumpContentVersion);
+		OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&OnObjectPropertyChanged);
+
+		bEventsBound = true;
+	}
+}
+#endif
+
+FBox
+FHoudiniActorBoundsCache::GetActorBounds(const AActor* InActor)
+{
+	if (!IsValid(InActor))
+		return FBox(ForceInitToZero);
+
+	const FTransform& ActorTransform = InActor->GetActorTransform();
+	const uint32 ContentVersion = GetActorContentVersion(InActor);
+	FEntry* FoundEntry = Entries.Find(InActor);
+	if (FoundEntry && FoundEntry->ContentVersion == ContentVersion && FoundEntry->Transform.Equals(ActorTransform, 0.0f))
+		return FoundEntry->Bounds;
+
+	FEntry& Entry = FoundEntry ? *FoundEntry : Entries.Add(InActor);
+	Entry.Transform = ActorTransform;
+	Entry.ContentVersion = ContentVersion;
+	Entry.Bounds = ComputeActorBounds(InActor);
+
+	return Entry.Bounds;
+}
+
+FBox
+FHoudiniActorBoundsCache::ComputeActorBounds(const AActor* InActor)
+{
+	if (!IsValid(InActor))
+		return FBox(ForceInitToZero);
+
+	FVector Origin, Extent;
+	InActor->GetActorBounds(false, Origin, Extent);
+
+	return FBox::BuildAABB(Origin, Extent);
+}
+
+uint32
+FHoudiniActorBoundsCache::GetActorContentVersion(const AActor* InActor)
+{
+#if WITH_EDITOR
+	check(IsInGameThread());
+
+	if (!IsValid(InActor))
+		return 0;
+
+	BindEvents();
+
+	if (const uint32* FoundVersion = ActorContentVersions.Find(InActor))
+		return *FoundVersion;
+
+	// Drop the versions of the actors that have been destroyed before tracking a new one
+	for (auto It = ActorContentVersions.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	ActorContentVersions.Add(InActor, 0);
+#endif
+	return 0;
+}
+
+void
+FHoudiniActorBoundsCache::Shutdown()
+{
+#if WITH_EDITOR
+	ActorContentVersions.Empty();
+
+	if (!bEventsBound)
+		return;
+
+	FCoreUObjectDelegates::OnObjectModified.Remove(OnObjectModifiedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+
+	bEventsBound = false;
+#endif
+}
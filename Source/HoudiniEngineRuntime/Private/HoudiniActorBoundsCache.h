@@ -0,0 +1,72 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+
+/**
+ * Caches the bounds of the actors used by an output or an input.
+ * AActor::GetActorBounds() iterates over all the actor's components, which is expensive for
+ * landscapes and large world inputs, while the asset component's bounds are queried whenever it moves.
+ * An actor's bounds are recomputed when its transform changed since they were cached, or when
+ * the actor or one of its subobjects was modified in the editor (ie, a landscape sculpt).
+ */
+struct HOUDINIENGINERUNTIME_API FHoudiniActorBoundsCache
+{
+	public:
+
+		// Returns the actor's bounds, from the cache if its transform and content haven't changed
+		FBox GetActorBounds(const AActor* InActor);
+
+		// Returns the actor's bounds, ignoring the cache
+		static FBox ComputeActorBounds(const AActor* InActor);
+
+		// Returns a counter that is incremented whenever the actor or one of its subobjects is modified
+		static uint32 GetActorContentVersion(const AActor* InActor);
+
+		// Unbinds the modification events and clears the content versions
+		static void Shutdown();
+
+		// Removes all the cached bounds
+		void Invalidate() { Entries.Empty(); };
+
+		int32 Num() const { return Entries.Num(); };
+
+	private:
+
+		struct FEntry
+		{
+			FTransform Transform;
+			uint32 ContentVersion = 0;
+			FBox Bounds;
+		};
+
+		TMap<TWeakObjectPtr<const AActor>, FEntry> Entries;
+};
@@ -2494,6 +2494,41 @@ UHoudiniAssetComponent::CalcBounds(const FTransform & LocalToWorld) const
 
 FBox
 UHoudiniAssetComponent::GetAssetBounds(UHoudiniInput* IgnoreInput, const bool& bIgnoreGeneratedLandscape) const
+{
+	return GetAssetBounds_Internal(true);
+}
+
+FBox
+UHoudiniAssetComponent::ComputeAssetBounds(UHoudiniInput* IgnoreInput, const bool& bIgnoreGeneratedLandscape) const
+{
+	return GetAssetBounds_Internal(false);
+}
+
+void
+UHoudiniAssetComponent::InvalidateBoundsCaches()
+{
+	for (auto & CurOutput : Outputs)
+	{
+		if (IsValid(CurOutput))
+			CurOutput->InvalidateBoundsCache();
+	}
+
+	for (auto & CurInput : Inputs)
+	{
+		if (IsValid(CurInput))
+			CurInput->InvalidateBoundsCache();
+	}
+
+	for (auto & CurParam : Parameters)
+	{
+		UHoudiniParameterOperatorPath* InputParam = Cast<UHoudiniParameterOperatorPath>(CurParam);
+		if (IsValid(InputParam) && InputParam->HoudiniInput.IsValid())
+			InputParam->HoudiniInput.Get()->InvalidateBoundsCache();
+	}
+}
+
+FBox
+UHoudiniAssetComponent::GetAssetBounds_Internal(const bool& bUseCache) const
 {
 	FBox BoxBounds(ForceInitToZero);
 
@@ -2503,7 +2538,7 @@ UHoudiniAssetComponent::GetAssetBounds(UHoudiniInput* IgnoreInput, const bool& b
 		if (!IsValid(CurOutput))
 			continue;
 
-		BoxBounds += CurOutput->GetBounds();
+		BoxBounds += bUseCache ? CurOutput->GetBounds() : CurOutput->ComputeBounds();
 	}
 
 	// Query the bounds for all our inputs
@@ -2512,7 +2547,7 @@ UHoudiniAssetComponent::GetAssetBounds(UHoudiniInput* IgnoreInput, const bool& b
 		if (!IsValid(CurInput))
 			continue;
 
-		BoxBounds += CurInput->GetBounds();
+		BoxBounds += bUseCache ? CurInput->GetBounds() : CurInput->ComputeBounds();
 	}
 
 	// Query the bounds for all input parameters
@@ -2531,7 +2566,8 @@ UHoudiniAssetComponent::GetAssetBounds(UHoudiniInput* IgnoreInput, const bool& b
 		if (!InputParam->HoudiniInput.IsValid())
 			continue;
 
-		BoxBounds += InputParam->HoudiniInput.Get()->GetBounds();
+		UHoudiniInput* ParamInput = InputParam->HoudiniInput.Get();
+		BoxBounds += bUseCache ? ParamInput->GetBounds() : ParamInput->ComputeBounds();
 	}
 
 	// Query the bounds for all our Houdini handles
@@ -2545,6 +2581,8 @@ UHoudiniAssetComponent::GetAssetBounds(UHoudiniInput* IgnoreInput, const bool& b
 
 	// Also scan all our decendants for SMC bounds not just top-level children
 	// ( split mesh instances' mesh bounds were not gathered proiperly )
+	// This isn't cached: components attached deeper in the hierarchy don't notify us, and checking that
+	// a cached list is still valid costs as much as gathering it again.
 	TArray<USceneComponent*> LocalAttachedChildren;
 	LocalAttachedChildren.Reserve(16);
 	GetChildrenComponents(true, LocalAttachedChildren);
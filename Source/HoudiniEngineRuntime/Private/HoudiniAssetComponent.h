@@ -364,8 +364,15 @@ public:
 	virtual FBoxSphereBounds CalcBounds(const FTransform & LocalToWorld) const override;
 	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
 
+	// Combines the cached bounds of the outputs and inputs with the bounds of the descendant static mesh components
 	FBox GetAssetBounds(UHoudiniInput* IgnoreInput, const bool& bIgnoreGeneratedLandscape) const;
 
+	// Same as GetAssetBounds, but recomputes every contribution instead of using the cached bounds
+	FBox ComputeAssetBounds(UHoudiniInput* IgnoreInput, const bool& bIgnoreGeneratedLandscape) const;
+
+	// Invalidates the cached bounds of the outputs and inputs
+	void InvalidateBoundsCaches();
+
 	// Set this component's input presets
 	void SetInputPresets(const TMap<UObject*, int32>& InPresets);
 	// Apply the preset input for HoudiniTools
@@ -457,6 +464,8 @@ protected:
 
 	virtual void OnChildAttached(USceneComponent* ChildComponent) override;
 
+	FBox GetAssetBounds_Internal(const bool& bUseCache) const;
+
 	virtual void BeginDestroy() override;
 
 	// 
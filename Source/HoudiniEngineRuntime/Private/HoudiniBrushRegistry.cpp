@@ -0,0 +1,353 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniBrushRegistry.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "Engine/Brush.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Math/GenericOctree.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_EDITOR
+
+namespace
+{
+	struct FHoudiniRegisteredBrush
+	{
+		TWeakObjectPtr<ABrush> Brush;
+		FBox Bounds = FBox(ForceInit);
+		// Level index in the world in the high bits, actor index in the level in the low bits
+		uint64 SortKey = 0;
+		FOctreeElementId2 OctreeId;
+	};
+
+	struct FHoudiniBrushOctreeElement
+	{
+		TSharedRef<FHoudiniRegisteredBrush> Entry;
+		FBoxCenterAndExtent Bounds;
+
+		FHoudiniBrushOctreeElement(const TSharedRef<FHoudiniRegisteredBrush>& InEntry)
+			: Entry(InEntry)
+			, Bounds(InEntry->Bounds)
+		{}
+	};
+
+	struct FHoudiniBrushOctreeSemantics
+	{
+		enum { MaxElementsPerLeaf = 16 };
+		enum { MinInclusiveElementsPerNode = 7 };
+		enum { MaxNodeDepth = 12 };
+
+		typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+		FORCEINLINE static const FBoxCenterAndExtent& GetBoundingBox(const FHoudiniBrushOctreeElement& Element)
+		{
+			return Element.Bounds;
+		}
+
+		FORCEINLINE static bool AreElementsEqual(const FHoudiniBrushOctreeElement& A, const FHoudiniBrushOctreeElement& B)
+		{
+			return A.Entry == B.Entry;
+		}
+
+		FORCEINLINE static void SetElementId(const FHoudiniBrushOctreeElement& Element, FOctreeElementId2 Id)
+		{
+			Element.Entry->OctreeId = Id;
+		}
+	};
+
+	typedef TOctree2<FHoudiniBrushOctreeElement, FHoudiniBrushOctreeSemantics> FHoudiniBrushOctree;
+
+	struct FHoudiniWorldBrushes
+	{
+		FHoudiniBrushOctree Octree;
+		TMap<TWeakObjectPtr<ABrush>, TSharedRef<FHoudiniRegisteredBrush>> Brushes;
+
+		FHoudiniWorldBrushes()
+			: Octree(FVector::ZeroVector, HALF_WORLD_MAX)
+		{}
+
+		void AddOrUpdate(ABrush* InBrush, const uint64* InSortKey)
+		{
+			TSharedRef<FHoudiniRegisteredBrush>* Found = Brushes.Find(InBrush);
+			const bool bNewBrush = Found == nullptr;
+			if (bNewBrush)
+			{
+				TSharedRef<FHoudiniRegisteredBrush> NewEntry = MakeShared<FHoudiniRegisteredBrush>();
+				NewEntry->Brush = InBrush;
+				Found = &Brushes.Add(InBrush, NewEntry);
+			}
+			else
+			{
+				RemoveFromOctree(*Found);
+			}
+
+			// Moving a brush doesn't change its order in the level
+			TSharedRef<FHoudiniRegisteredBrush>& Entry = *Found;
+			if (InSortKey)
+				Entry->SortKey = *InSortKey;
+			else if (bNewBrush)
+				Entry->SortKey = ComputeSortKey(InBrush);
+
+			// Same bounds as FHoudiniEngineRuntimeUtils::FindActorsOfClassInBounds
+			Entry->Bounds = InBrush->GetComponentsBoundingBox(true);
+			if (Entry->Bounds.IsValid)
+				Octree.AddElement(FHoudiniBrushOctreeElement(Entry));
+		}
+
+		void Remove(ABrush* InBrush)
+		{
+			TSharedRef<FHoudiniRegisteredBrush>* Found = Brushes.Find(InBrush);
+			if (!Found)
+				return;
+
+			RemoveFromOctree(*Found);
+			Brushes.Remove(InBrush);
+		}
+
+		void RemoveFromOctree(const TSharedRef<FHoudiniRegisteredBrush>& InEntry)
+		{
+			if (InEntry->OctreeId.IsValidId())
+				Octree.RemoveElement(InEntry->OctreeId);
+
+			InEntry->OctreeId = FOctreeElementId2();
+		}
+
+		static uint64 MakeSortKey(const int32& InLevelIndex, const int32& InActorIndex)
+		{
+			return ((uint64)(uint32)InLevelIndex << 32) | (uint64)(uint32)InActorIndex;
+		}
+
+		static uint64 ComputeSortKey(ABrush* InBrush)
+		{
+			ULevel* Level = InBrush->GetLevel();
+			UWorld* World = InBrush->GetWorld();
+			if (!Level || !World)
+				return MAX_uint64;
+
+			const int32 LevelIndex = World->GetLevels().IndexOfByKey(Level);
+			const int32 ActorIndex = Level->Actors.Find(InBrush);
+			return MakeSortKey(LevelIndex, ActorIndex);
+		}
+	};
+
+	TMap<TWeakObjectPtr<UWorld>, TUniquePtr<FHoudiniWorldBrushes>> WorldBrushes;
+
+	bool bEventsBound = false;
+	FDelegateHandle OnLevelActorAddedHandle;
+	FDelegateHandle OnLevelActorDeletedHandle;
+	FDelegateHandle OnActorMovedHandle;
+	FDelegateHandle OnObjectPropertyChangedHandle;
+	FDelegateHandle OnLevelAddedToWorldHandle;
+	FDelegateHandle OnLevelRemovedFromWorldHandle;
+	FDelegateHandle OnWorldCleanupHandle;
+
+	FHoudiniWorldBrushes* FindWorldBrushes(UWorld* InWorld)
+	{
+		TUniquePtr<FHoudiniWorldBrushes>* Found = WorldBrushes.Find(InWorld);
+		return Found ? Found->Get() : nullptr;
+	}
+
+	FHoudiniWorldBrushes& GetOrBuildWorldBrushes(UWorld* InWorld)
+	{
+		TUniquePtr<FHoudiniWorldBrushes>& Registry = WorldBrushes.FindOrAdd(InWorld);
+		if (Registry.IsValid())
+			return *Registry;
+
+		Registry = MakeUnique<FHoudiniWorldBrushes>();
+
+		// Register all the brushes in the same order as TActorIterator
+		const TArray<ULevel*>& Levels = InWorld->GetLevels();
+		for (int32 LevelIdx = 0; LevelIdx < Levels.Num(); LevelIdx++)
+		{
+			ULevel* Level = Levels[LevelIdx];
+			if (!Level)
+				continue;
+
+			for (int32 ActorIdx = 0; ActorIdx < Level->Actors.Num(); ActorIdx++)
+			{
+				ABrush* Brush = Cast<ABrush>(Level->Actors[ActorIdx]);
+				if (!IsValid(Brush))
+					continue;
+
+				const uint64 SortKey = FHoudiniWorldBrushes::MakeSortKey(LevelIdx, ActorIdx);
+				Registry->AddOrUpdate(Brush, &SortKey);
+			}
+		}
+
+		return *Registry;
+	}
+
+	void OnBrushChanged(AActor* InActor)
+	{
+		ABrush* Brush = Cast<ABrush>(InActor);
+		if (!IsValid(Brush))
+			return;
+
+		// Registries are built on demand, only update the existing ones
+		FHoudiniWorldBrushes* Registry = FindWorldBrushes(Brush->GetWorld());
+		if (Registry)
+			Registry->AddOrUpdate(Brush, nullptr);
+	}
+
+	void OnBrushDeleted(AActor* InActor)
+	{
+		ABrush* Brush = Cast<ABrush>(InActor);
+		if (!Brush)
+			return;
+
+		FHoudiniWorldBrushes* Registry = FindWorldBrushes(Brush->GetWorld());
+		if (Registry)
+			Registry->Remove(Brush);
+	}
+
+	void OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent)
+	{
+		if (!InObject || WorldBrushes.Num() <= 0)
+			return;
+
+		// Changes to the brush's model, component or builder also change its bounds
+		ABrush* Brush = Cast<ABrush>(InObject);
+		if (!Brush)
+			Brush = InObject->GetTypedOuter<ABrush>();
+
+		if (Brush)
+			OnBrushChanged(Brush);
+	}
+
+	void OnWorldLevelsChanged(ULevel* InLevel, UWorld* InWorld)
+	{
+		// The level indices have changed, the registry will be rebuilt on demand
+		WorldBrushes.Remove(InWorld);
+	}
+
+	void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+	{
+		WorldBrushes.Remove(InWorld);
+	}
+
+	void BindEvents()
+	{
+		if (bEventsBound || !GEngine)
+			return;
+
+		OnLevelActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&OnBrushChanged);
+		OnLevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&OnBrushDeleted);
+		OnActorMovedHandle = GEngine->OnActorMoved().AddStatic(&OnBrushChanged);
+		OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&OnObjectPropertyChanged);
+		OnLevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&OnWorldLevelsChanged);
+		OnLevelRemovedFromWorldHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&OnWorldLevelsChanged);
+		OnWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+
+		bEventsBound = true;
+	}
+}
+
+#endif
+
+bool
+FHoudiniBrushRegistry::FindBrushesInBounds(UWorld* InWorld, const FBox& InBounds, TArray<AActor*>& OutBrushes)
+{
+#if WITH_EDITOR
+	if (!IsValid(InWorld) || !GEngine)
+		return false;
+
+	BindEvents();
+
+	OutBrushes.Empty();
+	if (!InBounds.IsValid)
+		return true;
+
+	FHoudiniWorldBrushes& Registry = GetOrBuildWorldBrushes(InWorld);
+
+	TArray<TPair<uint64, ABrush*>> Found;
+	Registry.Octree.FindElementsWithBoundsTest(FBoxCenterAndExtent(InBounds), [&Found, &InBounds](const FHoudiniBrushOctreeElement& Element)
+	{
+		ABrush* Brush = Element.Entry->Brush.Get();
+		if (!IsValid(Brush))
+			return;
+
+		// TActorIterator skips the levels that aren't visible
+		ULevel* Level = Brush->GetLevel();
+		if (Level && !Level->bIsVisible)
+			return;
+
+		if (!Element.Entry->Bounds.Intersect(InBounds))
+			return;
+
+		Found.Add(TPair<uint64, ABrush*>(Element.Entry->SortKey, Brush));
+	});
+
+	Found.Sort([](const TPair<uint64, ABrush*>& A, const TPair<uint64, ABrush*>& B) { return A.Key < B.Key; });
+
+	OutBrushes.Reserve(Found.Num());
+	for (const TPair<uint64, ABrush*>& Pair : Found)
+		OutBrushes.Add(Pair.Value);
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void
+FHoudiniBrushRegistry::UpdateBrush(ABrush* InBrush)
+{
+#if WITH_EDITOR
+	OnBrushChanged(InBrush);
+#endif
+}
+
+void
+FHoudiniBrushRegistry::Shutdown()
+{
+#if WITH_EDITOR
+	WorldBrushes.Empty();
+
+	if (!bEventsBound)
+		return;
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(OnLevelActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(OnLevelActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(OnActorMovedHandle);
+	}
+
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(OnLevelAddedToWorldHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(OnLevelRemovedFromWorldHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(OnWorldCleanupHandle);
+
+	bEventsBound = false;
+#endif
+}
@@ -0,0 +1,56 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class ABrush;
+class UWorld;
+
+/**
+ * Per-world registry of the brush actors, indexed by their bounds in an octree.
+ * Brush inputs use it to find the brushes intersecting them without iterating over all the actors of the world.
+ * In the editor, the registry is kept up to date by the actor added/deleted/moved and property changed events,
+ * and is rebuilt when levels are added to or removed from the world.
+ * The brushes are returned in level order, as it is needed to rebuild the same CSG as the level's BSP.
+ */
+struct HOUDINIENGINERUNTIME_API FHoudiniBrushRegistry
+{
+	public:
+
+		// Finds the brushes whose bounds intersect InBounds, in level order.
+		// Returns false if the registry is not available (outside of the editor), the world's actors have to be iterated instead.
+		static bool FindBrushesInBounds(UWorld* InWorld, const FBox& InBounds, TArray<AActor*>& OutBrushes);
+
+		// Refreshes the bounds of a brush in its world's registry
+		static void UpdateBrush(ABrush* InBrush);
+
+		// Destroys the registries and unbinds the events, called when the module shuts down
+		static void Shutdown();
+};
@@ -29,6 +29,9 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniGenericAttribute.h"
+#include "HoudiniBrushRegistry.h"
+#include "HoudiniActorBoundsCache.h"
 
 #include "Modules/ModuleManager.h"
 
@@ -65,6 +68,9 @@ void FHoudiniEngineRuntime::StartupModule()
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 	// Store the instance.
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = this;
+
+	// The generic attribute property cache holds raw FProperty pointers, flush it before they can be collected
+	PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddStatic(&FHoudiniGenericAttribute::ClearPropertyCache);
 }
 
 
@@ -72,6 +78,11 @@ void FHoudiniEngineRuntime::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+	FHoudiniGenericAttribute::ClearPropertyCache();
+	FHoudiniBrushRegistry::Shutdown();
+	FHoudiniActorBoundsCache::Shutdown();
+
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 }
 
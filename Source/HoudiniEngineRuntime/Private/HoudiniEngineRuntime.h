@@ -104,4 +104,7 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		TArray<int32> NodeIdsPendingDelete;
 
 		TArray<int32> NodeIdsParentPendingDelete;
+
+		// Handle for the delegate used to flush the generic attribute property cache before GC
+		FDelegateHandle PreGarbageCollectHandle;
 };
\ No newline at end of file
@@ -39,6 +39,122 @@
 #include "EditorFramework/AssetImportData.h"
 #include "AI/Navigation/NavCollisionBase.h"
 
+TMap<UClass*, TMap<FString, FHoudiniGenericAttributeCachedProperty>> FHoudiniGenericAttribute::PropertyCache;
+
+// Sets one value of a scalar property, returns true if the value was changed.
+// InPreChange is called right before the value is modified.
+typedef TFunction<bool(void* InValuePtr, const int32& InValueIndex, const TFunctionRef<void()>& InPreChange)> FHoudiniPropertyValueSetter;
+
+// Properties that UpdatePropertyAttributeOnObject sets via dedicated functions instead of reflection
+static bool
+HoudiniIsManuallyHandledProperty(const FString& InPropertyName)
+{
+	return InPropertyName.Equals(TEXT("CollisionProfileName"), ESearchCase::IgnoreCase)
+		|| InPropertyName.Equals(TEXT("CollisionEnabled"), ESearchCase::IgnoreCase)
+		|| InPropertyName.Equals(TEXT("CastShadow"), ESearchCase::IgnoreCase)
+		|| InPropertyName.Contains(TEXT("Tags"))
+		|| InPropertyName.Equals(TEXT("EnableEditLayers"), ESearchCase::IgnoreCase)
+		|| InPropertyName.Equals(TEXT("bCanHaveLayersContent"), ESearchCase::IgnoreCase);
+}
+
+// Picks the setter matching a scalar property and the attribute's storage, same conversions as ModifyPropertyValueOnObject.
+// Returns an unbound function for the properties that need ModifyPropertyValueOnObject (arrays, structs, objects...)
+static FHoudiniPropertyValueSetter
+HoudiniMakePropertyValueSetter(FProperty* InProperty, const FHoudiniGenericAttribute& InAttribute)
+{
+	if (!InProperty || CastField<FArrayProperty>(InProperty))
+		return nullptr;
+
+	if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(InProperty))
+	{
+		if (InAttribute.AttributeType == EAttribStorageType::STRING)
+		{
+			return [NumericProperty, &InAttribute](void* InValuePtr, const int32& InValueIndex, const TFunctionRef<void()>& InPreChange)
+			{
+				const FString NewValue = InAttribute.GetStringValue(InValueIndex);
+				if (NewValue == NumericProperty->GetNumericPropertyValueToString(InValuePtr))
+					return false;
+
+				InPreChange();
+				NumericProperty->SetNumericPropertyValueFromString(InValuePtr, *NewValue);
+				return true;
+			};
+		}
+		else if (NumericProperty->IsFloatingPoint())
+		{
+			return [NumericProperty, &InAttribute](void* InValuePtr, const int32& InValueIndex, const TFunctionRef<void()>& InPreChange)
+			{
+				const double NewValue = InAttribute.GetDoubleValue(InValueIndex);
+				if (NewValue == NumericProperty->GetFloatingPointPropertyValue(InValuePtr))
+					return false;
+
+				InPreChange();
+				NumericProperty->SetFloatingPointPropertyValue(InValuePtr, NewValue);
+				return true;
+			};
+		}
+		else if (NumericProperty->IsInteger())
+		{
+			return [NumericProperty, &InAttribute](void* InValuePtr, const int32& InValueIndex, const TFunctionRef<void()>& InPreChange)
+			{
+				const int64 NewValue = InAttribute.GetIntValue(InValueIndex);
+				if (NewValue == NumericProperty->GetSignedIntPropertyValue(InValuePtr))
+					return false;
+
+				InPreChange();
+				NumericProperty->SetIntPropertyValue(InValuePtr, NewValue);
+				return true;
+			};
+		}
+
+		return nullptr;
+	}
+
+	if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(InProperty))
+	{
+		return [BoolProperty, &InAttribute](void* InValuePtr, const int32& InValueIndex, const TFunctionRef<void()>& InPreChange)
+		{
+			const bool NewValue = InAttribute.GetBoolValue(InValueIndex);
+			if (NewValue == BoolProperty->GetPropertyValue(InValuePtr))
+				return false;
+
+			InPreChange();
+			BoolProperty->SetPropertyValue(InValuePtr, NewValue);
+			return true;
+		};
+	}
+
+	if (FStrProperty* StrProperty = CastField<FStrProperty>(InProperty))
+	{
+		return [StrProperty, &InAttribute](void* InValuePtr, const int32& InValueIndex, const TFunctionRef<void()>& InPreChange)
+		{
+			const FString NewValue = InAttribute.GetStringValue(InValueIndex);
+			if (NewValue == StrProperty->GetPropertyValue(InValuePtr))
+				return false;
+
+			InPreChange();
+			StrProperty->SetPropertyValue(InValuePtr, NewValue);
+			return true;
+		};
+	}
+
+	if (FNameProperty* NameProperty = CastField<FNameProperty>(InProperty))
+	{
+		return [NameProperty, &InAttribute](void* InValuePtr, const int32& InValueIndex, const TFunctionRef<void()>& InPreChange)
+		{
+			const FName NewValue = FName(*InAttribute.GetStringValue(InValueIndex));
+			if (NewValue == NameProperty->GetPropertyValue(InValuePtr))
+				return false;
+
+			InPreChange();
+			NameProperty->SetPropertyValue(InValuePtr, NewValue);
+			return true;
+		};
+	}
+
+	return nullptr;
+}
+
 FHoudiniGenericAttributeChangedProperty::FHoudiniGenericAttributeChangedProperty()
 	: Object()
 	, Property(nullptr)
@@ -587,6 +703,133 @@ FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(
 }
 
 
+int32
+FHoudiniGenericAttribute::UpdatePropertyAttributeOnObjects(
+	const TArray<UObject*>& InObjects, const FHoudiniGenericAttribute& InPropertyAttribute, const TArray<int32>& InAtIndices)
+{
+	if (InObjects.Num() != InAtIndices.Num())
+		return 0;
+
+	const FString& PropertyName = InPropertyAttribute.AttributeName;
+	if (PropertyName.IsEmpty())
+		return 0;
+
+	int32 NumUpdated = 0;
+
+#if WITH_EDITOR
+	if (!HoudiniIsManuallyHandledProperty(PropertyName))
+	{
+		// Resolution of the property for the class of the previous object
+		UClass* ResolvedClass = nullptr;
+		const FHoudiniGenericAttributeCachedProperty* ResolvedProperty = nullptr;
+		FEditPropertyChain ResolvedPropertyChain;
+		FHoudiniPropertyValueSetter Setter;
+
+		for (int32 ObjIdx = 0; ObjIdx < InObjects.Num(); ObjIdx++)
+		{
+			UObject* CurObject = InObjects[ObjIdx];
+			if (!IsValid(CurObject))
+				continue;
+
+			UClass* ObjectClass = CurObject->GetClass();
+			if (ObjectClass != ResolvedClass)
+			{
+				ResolvedClass = ObjectClass;
+				ResolvedProperty = nullptr;
+				ResolvedPropertyChain.Empty();
+				Setter = nullptr;
+
+				// Finding the property on the first object of this class resolves and caches it for the class
+				void* FoundContainer = nullptr;
+				FProperty* FoundProperty = nullptr;
+				UObject* FoundPropertyObject = nullptr;
+				FEditPropertyChain FoundPropertyChain;
+				if (FindPropertyOnObject(CurObject, PropertyName, FoundPropertyChain, FoundProperty, FoundPropertyObject, FoundContainer)
+					&& FoundPropertyObject == CurObject)
+				{
+					const TMap<FString, FHoudiniGenericAttributeCachedProperty>* ClassCache = PropertyCache.Find(ObjectClass);
+					ResolvedProperty = ClassCache ? ClassCache->Find(PropertyName) : nullptr;
+					if (ResolvedProperty && !ResolvedProperty->Property)
+						ResolvedProperty = nullptr;
+				}
+
+				if (ResolvedProperty)
+				{
+					if (ResolvedProperty->bAddToPropertyChain)
+					{
+						for (FStructProperty* StructProperty : ResolvedProperty->StructPath)
+							ResolvedPropertyChain.AddTail(StructProperty);
+						ResolvedPropertyChain.AddTail(ResolvedProperty->Property);
+						ResolvedPropertyChain.SetActivePropertyNode(ResolvedProperty->Property);
+						ResolvedPropertyChain.SetActiveMemberPropertyNode(ResolvedPropertyChain.GetHead()->GetValue());
+					}
+
+					Setter = HoudiniMakePropertyValueSetter(ResolvedProperty->Property, InPropertyAttribute);
+				}
+			}
+
+			const int32 AtIndex = InAtIndices[ObjIdx];
+			if (!ResolvedProperty)
+			{
+				// Properties on nested objects (body setups, actor components...) are looked up per object
+				if (UpdatePropertyAttributeOnObject(CurObject, InPropertyAttribute, AtIndex))
+					NumUpdated++;
+				continue;
+			}
+
+			// Follow the cached struct path to get the container for this object
+			void* Container = CurObject;
+			for (FStructProperty* StructProperty : ResolvedProperty->StructPath)
+				Container = StructProperty->ContainerPtrToValuePtr<void>(Container, 0);
+
+			FProperty* Property = ResolvedProperty->Property;
+			if (!Setter)
+			{
+				if (ModifyPropertyValueOnObject(
+					CurObject, InPropertyAttribute, ResolvedPropertyChain, Property, ResolvedProperty->bHasContainer ? Container : nullptr, AtIndex))
+				{
+					NumUpdated++;
+				}
+				continue;
+			}
+
+			bool bValueChanged = false;
+			auto OnPreChange = [CurObject, Property, &ResolvedPropertyChain, &bValueChanged]()
+			{
+				if (bValueChanged)
+					return;
+
+				if (ResolvedPropertyChain.Num() == 0)
+					CurObject->PreEditChange(Property);
+				else
+					CurObject->PreEditChange(ResolvedPropertyChain);
+				bValueChanged = true;
+			};
+
+			// Tuple values are set on fixed size arrays, like ModifyPropertyValueOnObject does
+			const int32 TupleSize = InPropertyAttribute.AttributeTupleSize;
+			for (int32 TupleIndex = 0; TupleIndex < TupleSize && TupleIndex < Property->ArrayDim; TupleIndex++)
+				Setter(Property->ContainerPtrToValuePtr<void>(Container, TupleIndex), AtIndex * TupleSize + TupleIndex, OnPreChange);
+
+			if (bValueChanged)
+				HandlePostEditChangeProperty(CurObject, ResolvedPropertyChain, Property);
+
+			NumUpdated++;
+		}
+
+		return NumUpdated;
+	}
+#endif
+
+	for (int32 ObjIdx = 0; ObjIdx < InObjects.Num(); ObjIdx++)
+	{
+		if (UpdatePropertyAttributeOnObject(InObjects[ObjIdx], InPropertyAttribute, InAtIndices[ObjIdx]))
+			NumUpdated++;
+	}
+
+	return NumUpdated;
+}
+
 bool
 FHoudiniGenericAttribute::FindPropertyOnObject(
 	UObject* InObject,
@@ -612,16 +855,6 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 	OutFoundProperty = nullptr;
 	OutFoundPropertyObject = InObject;
 
-	bool bPropertyHasBeenFound = false;
-	FHoudiniGenericAttribute::TryToFindProperty(
-		InObject,
-		ObjectClass,
-		InPropertyName,
-		InPropertyChain,
-		OutFoundProperty,
-		bPropertyHasBeenFound,
-		OutContainer);
-
 	/*
 	// TODO: Parsing needs to be made recursively!
 	// Iterate manually on the properties, in order to handle StructProperties correctly
@@ -697,17 +930,90 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 		return true;
 	*/
 
-	// Try with FindField??
-	if (!OutFoundProperty)
-		OutFoundProperty = FindFProperty<FProperty>(ObjectClass, *InPropertyName);
+	// See if we've already resolved this property name for this class
+	TMap<FString, FHoudiniGenericAttributeCachedProperty>& ClassCache = PropertyCache.FindOrAdd(ObjectClass);
+	const FHoudiniGenericAttributeCachedProperty* CachedProperty = ClassCache.Find(InPropertyName);
+	if (CachedProperty)
+	{
+		if (CachedProperty->Property)
+		{
+			// Follow the cached struct path to get the container for this object
+			void* Container = InObject;
+			for (FStructProperty* StructProperty : CachedProperty->StructPath)
+			{
+				if (CachedProperty->bAddToPropertyChain)
+					InPropertyChain.AddTail(StructProperty);
+				Container = StructProperty->ContainerPtrToValuePtr<void>(Container, 0);
+			}
 
-	// Try with FindPropertyByName ??
-	if (!OutFoundProperty)
-		OutFoundProperty = ObjectClass->FindPropertyByName(*InPropertyName);
+			if (CachedProperty->bAddToPropertyChain)
+				InPropertyChain.AddTail(CachedProperty->Property);
 
-	// We found the Property we were looking for
-	if (OutFoundProperty)
-		return true;
+			OutContainer = CachedProperty->bHasContainer ? Container : nullptr;
+			OutFoundProperty = CachedProperty->Property;
+			return true;
+		}
+	}
+	else
+	{
+		const int32 PropertyChainNumBefore = InPropertyChain.Num();
+
+		bool bPropertyHasBeenFound = false;
+		FHoudiniGenericAttribute::TryToFindProperty(
+			InObject,
+			ObjectClass,
+			InPropertyName,
+			InPropertyChain,
+			OutFoundProperty,
+			bPropertyHasBeenFound,
+			OutContainer);
+
+		// Try with FindField??
+		if (!OutFoundProperty)
+			OutFoundProperty = FindFProperty<FProperty>(ObjectClass, *InPropertyName);
+
+		// Try with FindPropertyByName ??
+		if (!OutFoundProperty)
+			OutFoundProperty = ObjectClass->FindPropertyByName(*InPropertyName);
+
+		// Cache the result for this class.
+		// Partial matches nested in structs leave no trace of their path in the chain, so they are not cached.
+		FHoudiniGenericAttributeCachedProperty NewCachedProperty;
+		NewCachedProperty.Property = OutFoundProperty;
+		NewCachedProperty.bHasContainer = OutContainer != nullptr;
+		NewCachedProperty.bAddToPropertyChain = bPropertyHasBeenFound;
+
+		bool bCanCache = true;
+		if (bPropertyHasBeenFound)
+		{
+			// The chain contains the struct properties we went through, followed by the property itself
+			int32 NodeIdx = 0;
+			for (auto* Node = InPropertyChain.GetHead(); Node; Node = Node->GetNextNode(), NodeIdx++)
+			{
+				if (NodeIdx < PropertyChainNumBefore || Node->GetValue() == OutFoundProperty)
+					continue;
+
+				FStructProperty* StructProperty = CastField<FStructProperty>(Node->GetValue());
+				if (!StructProperty)
+				{
+					bCanCache = false;
+					break;
+				}
+				NewCachedProperty.StructPath.Add(StructProperty);
+			}
+		}
+		else if (OutContainer && OutContainer != InObject)
+		{
+			bCanCache = false;
+		}
+
+		if (bCanCache)
+			ClassCache.Add(InPropertyName, NewCachedProperty);
+
+		// We found the Property we were looking for
+		if (OutFoundProperty)
+			return true;
+	}
 
 	// Handle common properties nested in classes
 	// Static Meshes
@@ -846,6 +1152,13 @@ FHoudiniGenericAttribute::TryToFindProperty(
 }
 
 
+void
+FHoudiniGenericAttribute::ClearPropertyCache()
+{
+	PropertyCache.Empty();
+}
+
+
 bool
 FHoudiniGenericAttribute::HandlePostEditChangeProperty(UObject* InObject, FEditPropertyChain& InPropertyChain, FProperty* InProperty)
 {
@@ -75,6 +75,24 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttributeChangedProperty
 	FProperty* Property;
 };
 
+// Class-level resolution of a generic attribute property name, cached per (UClass, property name)
+// so the reflection data doesn't have to be walked again for every object/instance.
+struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttributeCachedProperty
+{
+	// The resolved property, null if the property could not be found on the class
+	FProperty* Property = nullptr;
+
+	// Struct properties to follow from the object to reach the property's container
+	TArray<FStructProperty*> StructPath;
+
+	// Indicates if the property's container is the object (or one of its nested structs).
+	// Properties found via FindFProperty/FindPropertyByName have no container.
+	bool bHasContainer = false;
+
+	// Indicates if the struct path and the property should be added to the property chain
+	bool bAddToPropertyChain = false;
+};
+
 USTRUCT()
 struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 {
@@ -139,6 +157,14 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 		TArray<FHoudiniGenericAttributeChangedProperty>* OutChangedProperties=nullptr,
 		const FFindPropertyFunctionType& InFindPropertyFunction=nullptr);
 
+	// Updates the property on many objects, ie. every instance of an instancer.
+	// The property is resolved once per class and, for scalar properties, the value is set with a setter
+	// picked once for the property type. Properties that need special handling, or that are found on
+	// nested objects, fall back to UpdatePropertyAttributeOnObject for each object.
+	// InAtIndices contains the attribute index to use for each object. Returns the number of updated objects.
+	static int32 UpdatePropertyAttributeOnObjects(
+		const TArray<UObject*>& InObjects, const FHoudiniGenericAttribute& InPropertyAttribute, const TArray<int32>& InAtIndices);
+
 	// Tries to find a Uproperty by name/label on an object
 	// FoundPropertyObject will be the object that actually contains the property
 	// and can be different from InObject if the property is nested.
@@ -191,4 +217,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 	// Helper to call PostEditChangePropertyChain on InObject for the InPropertyChain. 
 	static bool HandlePostEditChangeProperty(UObject* InObject, FEditPropertyChain& InPropertyChain, FProperty* InProperty);
 
+	// Empties the per-class property cache used by FindPropertyOnObject.
+	// Must be called whenever cached FProperty pointers could become stale (GC, class reloads).
+	static void ClearPropertyCache();
+
+protected:
+
+	// Per-class cache of resolved properties, keyed by class then by (case insensitive) property name
+	static TMap<UClass*, TMap<FString, FHoudiniGenericAttributeCachedProperty>> PropertyCache;
+
 };
\ No newline at end of file
@@ -336,7 +336,7 @@ void UHoudiniInput::PostEditUndo()
 
 
 FBox 
-UHoudiniInput::GetBounds() const 
+UHoudiniInput::GetBounds_Internal(const bool& bUseCache) const 
 {
 	FBox BoxBounds(ForceInitToZero);
 
@@ -354,11 +354,9 @@ UHoudiniInput::GetBounds() const
 			if (!IsValid(CurCurve))
 				continue;
 
-			FBox CurCurveBound(ForceInitToZero);
-			for (auto & Trans : CurCurve->CurvePoints)
-			{
-				CurCurveBound += Trans.GetLocation();
-			}
+			FBox CurCurveBound = bUseCache
+				? CurCurve->GetCurvePointsBounds()
+				: CurCurve->ComputeCurvePointsBounds();
 
 			UHoudiniAssetComponent* OuterHAC = Cast<UHoudiniAssetComponent>(GetOuter());
 
@@ -380,7 +378,9 @@ UHoudiniInput::GetBounds() const
 			if (!IsValid(CurInHAC))
 				continue;
 
-			BoxBounds += CurInHAC->GetAssetBounds(nullptr, false);
+			BoxBounds += bUseCache
+				? CurInHAC->GetAssetBounds(nullptr, false)
+				: CurInHAC->ComputeAssetBounds(nullptr, false);
 		}
 	}
 	break;
@@ -396,10 +396,9 @@ UHoudiniInput::GetBounds() const
 				if (!IsValid(Actor))
 					continue;
 
-				FVector Origin, Extent;
-				Actor->GetActorBounds(false, Origin, Extent);
-
-				BoxBounds += FBox::BuildAABB(Origin, Extent);
+				BoxBounds += bUseCache
+					? ActorBoundsCache.GetActorBounds(Actor)
+					: FHoudiniActorBoundsCache::ComputeActorBounds(Actor);
 			}
 			else
 			{
@@ -411,7 +410,9 @@ UHoudiniInput::GetBounds() const
 					if (!IsValid(CurInHAC))
 						continue;
 
-					BoxBounds += CurInHAC->GetAssetBounds(nullptr, false);
+					BoxBounds += bUseCache
+						? CurInHAC->GetAssetBounds(nullptr, false)
+						: CurInHAC->ComputeAssetBounds(nullptr, false);
 					continue;
 				}
 			}
@@ -431,10 +432,9 @@ UHoudiniInput::GetBounds() const
 			if (!IsValid(CurLandscape))
 				continue;
 
-			FVector Origin, Extent;
-			CurLandscape->GetActorBounds(false, Origin, Extent);
-
-			BoxBounds += FBox::BuildAABB(Origin, Extent);
+			BoxBounds += bUseCache
+				? ActorBoundsCache.GetActorBounds(CurLandscape)
+				: FHoudiniActorBoundsCache::ComputeActorBounds(CurLandscape);
 		}
 	}
 	break;
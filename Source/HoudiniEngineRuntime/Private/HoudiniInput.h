@@ -33,6 +33,7 @@
 
 #include "HoudiniInputTypes.h"
 #include "HoudiniInputObject.h"
+#include "HoudiniActorBoundsCache.h"
 
 #include "GameFramework/Actor.h"
 #include "LandscapeProxy.h"
@@ -232,6 +233,8 @@ public:
 	{
 		bHasChanged = bInChanged;
 		SetNeedsToTriggerUpdate(bInChanged);
+		if (bInChanged)
+			InvalidateBoundsCache();
 	};
 	void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	void MarkDataUploadNeeded(const bool& bInDataUploadNeeded) { bDataUploadNeeded = bInDataUploadNeeded; };
@@ -361,7 +364,13 @@ public:
 	virtual void PostEditUndo() override;
 #endif
 
-	FBox GetBounds() const;
+	// Returns the bounds of the input objects, world and landscape actor bounds are cached until they move or the input changes
+	FBox GetBounds() const { return GetBounds_Internal(true); };
+
+	// Returns the bounds of the input objects, ignoring the cached bounds
+	FBox ComputeBounds() const { return GetBounds_Internal(false); };
+
+	void InvalidateBoundsCache() { ActorBoundsCache.Invalidate(); };
 
 	void UpdateLandscapeInputSelection();
 
@@ -383,6 +392,11 @@ public:
 
 protected:
 
+	FBox GetBounds_Internal(const bool& bUseCache) const;
+
+	// Bounds of the world and landscape input actors
+	mutable FHoudiniActorBoundsCache ActorBoundsCache;
+
 	// Name of the input / Object path parameter
 	UPROPERTY()
 	FString Name;
@@ -51,6 +51,7 @@
 #include "Engine/Brush.h"
 
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniBrushRegistry.h"
 #include "Kismet/KismetSystemLibrary.h"
 
 #include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionActor.h"
@@ -125,6 +126,8 @@ UHoudiniInputMeshComponent::UHoudiniInputMeshComponent(const FObjectInitializer&
 //
 UHoudiniInputInstancedMeshComponent::UHoudiniInputInstancedMeshComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, InstanceCount(0)
+	, InstancesHash(0)
 {
 
 }
@@ -1152,19 +1155,38 @@ UHoudiniInputInstancedMeshComponent::Update(UObject * InObject)
 
 	ensure(ISMC);
 
-	if (ISMC)
-	{
-		uint32 InstanceCount = ISMC->GetInstanceCount();
-		InstanceTransforms.SetNum(InstanceCount);
+	// The instances are not copied here, as Update() is called every time world inputs are polled.
+	// The instances hash is only snapshotted via UpdateInstancesHash() when the instances are uploaded.
+}
 
-		// Copy the instances' transforms		
-		for (uint32 InstIdx = 0; InstIdx < InstanceCount; InstIdx++)
-		{
-			FTransform CurTransform = FTransform::Identity;
-			ISMC->GetInstanceTransform(InstIdx, CurTransform);
-			InstanceTransforms[InstIdx] = CurTransform;			
-		}
+void
+UHoudiniInputInstancedMeshComponent::UpdateInstancesHash(UInstancedStaticMeshComponent* InISMC)
+{
+	if (!IsValid(InISMC))
+	{
+		InstanceCount = 0;
+		InstancesHash = 0;
+		return;
 	}
+
+	InstanceCount = InISMC->GetInstanceCount();
+	InstancesHash = ComputeInstancesHash(InISMC);
+}
+
+uint32
+UHoudiniInputInstancedMeshComponent::ComputeInstancesHash(UInstancedStaticMeshComponent* InISMC)
+{
+	if (!IsValid(InISMC))
+		return 0;
+
+	// Hash the raw per-instance data in one pass, instead of extracting and comparing
+	// each instance's FTransform individually
+	const TArray<FInstancedStaticMeshInstanceData>& InstanceData = InISMC->PerInstanceSMData;
+	const uint32 Seed = (uint32)InstanceData.Num();
+	if (InstanceData.Num() <= 0)
+		return Seed;
+
+	return FCrc::MemCrc32(InstanceData.GetData(), InstanceData.Num() * InstanceData.GetTypeSize(), Seed);
 }
 
 bool
@@ -1174,21 +1196,10 @@ UHoudiniInputInstancedMeshComponent::HasInstancesChanged() const
 	if (!ISMC)
 		return false;
 
-	uint32 InstanceCount = ISMC->GetInstanceCount();
-	if (InstanceTransforms.Num() != InstanceCount)
+	if (InstanceCount != ISMC->GetInstanceCount())
 		return true;
 
-	// Copy the instances' transforms		
-	for (uint32 InstIdx = 0; InstIdx < InstanceCount; InstIdx++)
-	{
-		FTransform CurTransform = FTransform::Identity;
-		ISMC->GetInstanceTransform(InstIdx, CurTransform);
-
-		if(!InstanceTransforms[InstIdx].Equals(CurTransform))
-			return true;
-	}
-
-	return false;
+	return InstancesHash != ComputeInstancesHash(ISMC);
 }
 
 bool
@@ -2064,6 +2075,20 @@ bool FHoudiniBrushInfo::HasChanged() const
 	return false;
 }
 
+uint64 FHoudiniBrushInfo::GetHash() const
+{
+	uint64 Hash = 0;
+	HashCombine(Hash, (uint64)(UPTRINT)BrushActor.Get());
+	HashCombine(Hash, CachedTransform.GetLocation());
+	HashCombine(Hash, CachedTransform.GetRotation().Euler());
+	HashCombine(Hash, CachedTransform.GetScale3D());
+	HashCombine(Hash, CachedOrigin);
+	HashCombine(Hash, CachedExtent);
+	HashCombine(Hash, (uint8)CachedBrushType);
+	HashCombine(Hash, CachedSurfaceHash);
+	return Hash;
+}
+
 int32 FHoudiniBrushInfo::GetNumVertexIndicesFromModel(const UModel* Model)
 {
 	const TArray<FBspNode>& Nodes = Model->Nodes;		
@@ -2223,7 +2248,10 @@ bool UHoudiniInputBrush::FindIntersectingSubtractiveBrushes(const UHoudiniInputB
 
 	Bounds.Add( BrushActor->GetComponentsBoundingBox(true, true) );
 
-	FHoudiniEngineRuntimeUtils::FindActorsOfClassInBounds(BrushActor->GetWorld(), ABrush::StaticClass(), Bounds, nullptr, IntersectingActors);
+	// Use the world's brush registry if possible, make sure it has the input brush's latest bounds
+	FHoudiniBrushRegistry::UpdateBrush(BrushActor);
+	if (!FHoudiniBrushRegistry::FindBrushesInBounds(BrushActor->GetWorld(), Bounds[0], IntersectingActors))
+		FHoudiniEngineRuntimeUtils::FindActorsOfClassInBounds(BrushActor->GetWorld(), ABrush::StaticClass(), Bounds, nullptr, IntersectingActors);
 
 	//--------------------------------------------------------------------------------------------------
 	// Filter the actors to only keep intersecting subtractive brushes.
@@ -428,12 +428,23 @@ public:
 
 	// Returns true if the attached component's transform has been modified
 	virtual bool HasComponentTransformChanged() const override;
+
+	// Snapshot the ISMC's instance count and content hash.
+	// Only needs to be called when the instances are actually uploaded to Houdini.
+	void UpdateInstancesHash(UInstancedStaticMeshComponent* InISMC);
+
+	// Hash the per-instance data of an ISMC, used to detect instance changes cheaply
+	static uint32 ComputeInstancesHash(UInstancedStaticMeshComponent* InISMC);
 	
 public:
 
-	// Array of transform for this ISMC's instances
+	// Number of instances on the ISMC when the instances were last uploaded
 	UPROPERTY()
-	TArray<FTransform> InstanceTransforms;	
+	int32 InstanceCount;
+
+	// Hash of the ISMC's per-instance data when the instances were last uploaded
+	UPROPERTY()
+	uint32 InstancesHash;
 };
 
 
@@ -784,6 +795,9 @@ struct FHoudiniBrushInfo
 
 	bool HasChanged() const;
 
+	// Hash of the brush actor and its cached state, used to identify a set of brushes
+	uint64 GetHash() const;
+
 	static int32 GetNumVertexIndicesFromModel(const UModel* Model);
 
 	FHoudiniBrushInfo();
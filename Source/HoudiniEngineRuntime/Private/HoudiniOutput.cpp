@@ -459,7 +459,7 @@ UHoudiniOutput::BeginDestroy()
 }
 
 FBox 
-UHoudiniOutput::GetBounds() const 
+UHoudiniOutput::GetBounds_Internal(const bool& bUseCache) const 
 {
 	FBox BoxBounds(ForceInitToZero);
 
@@ -502,11 +502,9 @@ UHoudiniOutput::GetBounds() const
 			if (!IsValid(Landscape))
 				continue;
 
-			FVector Origin, Extent;
-			Landscape->GetActorBounds(false, Origin, Extent);
-
-			FBox LandscapeBounds = FBox::BuildAABB(Origin, Extent);
-			BoxBounds += LandscapeBounds;
+			BoxBounds += bUseCache
+				? ActorBoundsCache.GetActorBounds(Landscape)
+				: FHoudiniActorBoundsCache::ComputeActorBounds(Landscape);
 		}
 	}
 	break;
@@ -534,11 +532,9 @@ UHoudiniOutput::GetBounds() const
 			if (!IsValid(CurHoudiniSplineComp))
 				continue;
 
-			FBox CurCurveBound(ForceInitToZero);
-			for (auto & Trans : CurHoudiniSplineComp->CurvePoints)
-			{
-				CurCurveBound += Trans.GetLocation();
-			}
+			FBox CurCurveBound = bUseCache
+				? CurHoudiniSplineComp->GetCurvePointsBounds()
+				: CurHoudiniSplineComp->ComputeCurvePointsBounds();
 
 			UHoudiniAssetComponent* OuterHAC = Cast<UHoudiniAssetComponent>(GetOuter());
 			if (IsValid(OuterHAC))
@@ -564,6 +560,8 @@ UHoudiniOutput::Clear()
 {
 	StaleCount = 0;
 
+	InvalidateBoundsCache();
+
 	HoudiniGeoPartObjects.Empty();
 
 	for (auto& CurrentOutputObject : OutputObjects)
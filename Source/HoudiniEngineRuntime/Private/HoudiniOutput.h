@@ -35,6 +35,7 @@
 #include "UObject/SoftObjectPtr.h"
 
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniActorBoundsCache.h"
 #include "HoudiniOutput.generated.h"
 
 class UMaterialInterface;
@@ -485,6 +486,9 @@ public:
 	// Returns the instanced outputs maps
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutput>& GetInstancedOutputs() { return InstancedOutputs; };
 
+	// Returns the instanced outputs maps
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutput>& GetInstancedOutputs() const { return InstancedOutputs; };
+
 	const bool HasGeoChanged() const;
 	const bool HasTransformChanged() const;
 	const bool HasMaterialsChanged() const;
@@ -515,7 +519,7 @@ public:
 	// Delete all the HGPO that were marked as stale
 	void DeleteAllStaleHGPOs();
 
-	void SetOutputObjects(const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOutputObjects) { OutputObjects = InOutputObjects; };
+	void SetOutputObjects(const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOutputObjects) { OutputObjects = InOutputObjects; InvalidateBoundsCache(); };
 
 	void SetInstancedOutputs(const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutput>& InInstancedOuput) { InstancedOutputs = InInstancedOuput; };
 
@@ -568,7 +572,14 @@ public:
 	//------------------------------------------------------------------------------------------------
 	static FString OutputTypeToString(const EHoudiniOutputType& InOutputType);
 
-	FBox GetBounds() const;
+	// Returns the bounds of the output objects, landscape bounds are cached until they move or the output is cleared
+	FBox GetBounds() const { return GetBounds_Internal(true); };
+
+	// Returns the bounds of the output objects, ignoring the cached bounds
+	FBox ComputeBounds() const { return GetBounds_Internal(false); };
+
+	// Must be called when the output objects are modified without moving
+	void InvalidateBoundsCache() { ActorBoundsCache.Invalidate(); };
 
 	void Clear();
 
@@ -578,6 +589,8 @@ protected:
 
 	virtual void BeginDestroy() override;
 
+	FBox GetBounds_Internal(const bool& bUseCache) const;
+
 protected:
 
 	// Indicates the type of output we're dealing with
@@ -619,6 +632,9 @@ protected:
 	UPROPERTY()
 	TArray<AActor*> HoudiniAttachedSocketActors;
 
+	// Bounds of the landscape outputs
+	mutable FHoudiniActorBoundsCache ActorBoundsCache;
+
 private:
 	// Use HoudiniOutput to represent an editable curve.
 	// This flag tells whether this output is an editable curve.
@@ -367,6 +367,9 @@ UTOPNode::UTOPNode()
 
 	bHasReceivedCookCompleteEvent = false;
 
+	NumIndexedWorkResults = 0;
+	bWorkResultIndexDirty = true;
+
 	InvalidateLandscapeCache();
 }
 
@@ -631,17 +634,25 @@ UTOPNode::GetBakedWorkResultObjectOutputs(int32 InWorkResultArrayIndex, int32 In
 int32
 UTOPNode::ArrayIndexOfWorkResultByID(const int32& InWorkItemID) const
 {
-	const int32 NumEntries = WorkResult.Num();
-	for (int32 Index = 0; Index < NumEntries; ++Index)
+	if (InWorkItemID == INDEX_NONE)
+		return ArrayIndexOfFirstInvalidWorkResult();
+
+	UpdateWorkResultIndex();
+
+	const int32* IndexPtr = WorkResultIndexByID.Find(InWorkItemID);
+	if (!IndexPtr)
+		return INDEX_NONE;
+
+	// The entry's ID could have been modified directly, rebuild the index if so
+	if (!WorkResult.IsValidIndex(*IndexPtr) || WorkResult[*IndexPtr].WorkItemID != InWorkItemID)
 	{
-		const FTOPWorkResult& CurResult = WorkResult[Index];
-		if (CurResult.WorkItemID == InWorkItemID)
-		{
-			return Index;
-		}
+		RebuildWorkResultIndex();
+		IndexPtr = WorkResultIndexByID.Find(InWorkItemID);
+		if (!IndexPtr)
+			return INDEX_NONE;
 	}
 
-	return INDEX_NONE;
+	return *IndexPtr;
 }
 
 FTOPWorkResult*
@@ -656,18 +667,107 @@ UTOPNode::GetWorkResultByID(const int32& InWorkItemID)
 
 int32
 UTOPNode::ArrayIndexOfFirstInvalidWorkResult() const
+{
+	UpdateWorkResultIndex();
+
+	if (FreeWorkResultIndices.Num() <= 0)
+		return INDEX_NONE;
+
+	const int32 Index = FreeWorkResultIndices.HeapTop();
+	if (!WorkResult.IsValidIndex(Index) || WorkResult[Index].WorkItemID != INDEX_NONE)
+	{
+		RebuildWorkResultIndex();
+		return FreeWorkResultIndices.Num() > 0 ? FreeWorkResultIndices.HeapTop() : INDEX_NONE;
+	}
+
+	return Index;
+}
+
+int32
+UTOPNode::AddOrReuseWorkResult(const int32& InWorkItemID, const int32& InWorkItemIndex)
+{
+	int32 Index = ArrayIndexOfFirstInvalidWorkResult();
+	if (Index == INDEX_NONE)
+	{
+		FTOPWorkResult LocalWorkResult;
+		LocalWorkResult.WorkItemID = InWorkItemID;
+		LocalWorkResult.WorkItemIndex = InWorkItemIndex;
+		Index = WorkResult.Add(LocalWorkResult);
+		NumIndexedWorkResults = WorkResult.Num();
+	}
+	else
+	{
+		FreeWorkResultIndices.HeapPopDiscard(false);
+
+		FTOPWorkResult& ReUsedWorkResult = WorkResult[Index];
+		ReUsedWorkResult.WorkItemID = InWorkItemID;
+		ReUsedWorkResult.WorkItemIndex = InWorkItemIndex;
+	}
+
+	if (InWorkItemID == INDEX_NONE)
+		FreeWorkResultIndices.HeapPush(Index);
+	else if (!WorkResultIndexByID.Contains(InWorkItemID))
+		WorkResultIndexByID.Add(InWorkItemID, Index);
+
+	return Index;
+}
+
+bool
+UTOPNode::RemoveWorkResultAt(const int32& InArrayIndex)
+{
+	if (!WorkResult.IsValidIndex(InArrayIndex))
+		return false;
+
+	// The indices of the following entries shift, the index is rebuilt on the next lookup.
+	// This keeps removing many entries in a row linear.
+	WorkResult.RemoveAt(InArrayIndex);
+	bWorkResultIndexDirty = true;
+
+	return true;
+}
+
+void
+UTOPNode::EmptyWorkResults()
+{
+	WorkResult.Empty();
+	WorkResultIndexByID.Empty();
+	FreeWorkResultIndices.Empty();
+	NumIndexedWorkResults = 0;
+	bWorkResultIndexDirty = false;
+}
+
+void
+UTOPNode::RebuildWorkResultIndex() const
 {
 	const int32 NumEntries = WorkResult.Num();
+	WorkResultIndexByID.Reset();
+	WorkResultIndexByID.Reserve(NumEntries);
+	FreeWorkResultIndices.Reset();
 	for (int32 Index = 0; Index < NumEntries; ++Index)
 	{
-		const FTOPWorkResult& CurResult = WorkResult[Index];
-		if (CurResult.WorkItemID == INDEX_NONE)
+		const int32 WorkItemID = WorkResult[Index].WorkItemID;
+		if (WorkItemID == INDEX_NONE)
 		{
-			return Index;
+			// Indices are added in ascending order, so the array is already a valid heap
+			FreeWorkResultIndices.Add(Index);
+		}
+		else if (!WorkResultIndexByID.Contains(WorkItemID))
+		{
+			// Keep the first entry for an ID, as the linear search did
+			WorkResultIndexByID.Add(WorkItemID, Index);
 		}
 	}
 
-	return INDEX_NONE;
+	NumIndexedWorkResults = NumEntries;
+	bWorkResultIndexDirty = false;
+}
+
+void
+UTOPNode::UpdateWorkResultIndex() const
+{
+	// Entries can still be added to / removed from the WorkResult array directly
+	if (bWorkResultIndexDirty || NumIndexedWorkResults != WorkResult.Num())
+		RebuildWorkResultIndex();
 }
 
 FTOPWorkResult*
@@ -731,6 +831,15 @@ UTOPNode::CanStillBeAutoBaked() const
 	return false;
 }
 
+void
+UTOPNode::PostLoad()
+{
+	Super::PostLoad();
+
+	// The work item IDs are transient, so all the loaded entries are available for re-use
+	RebuildWorkResultIndex();
+}
+
 #if WITH_EDITOR
 void
 UTOPNode::PostEditChangeChainProperty(FPropertyChangedChainEvent& InPropertyChangedEvent)
@@ -1143,7 +1252,7 @@ UHoudiniPDGAssetLink::ClearTOPNodeWorkItemResults(UTOPNode* TOPNode)
 	{
 		CurrentWorkResult.ClearAndDestroyResultObjects(HoudiniComponentGuid);
 	}
-	TOPNode->WorkResult.Empty();
+	TOPNode->EmptyWorkResults();
 
 	FOutputActorOwner& OutputActorOwner = TOPNode->GetOutputActorOwner();
 	AActor* OutputActor = OutputActorOwner.GetOutputActor();
@@ -1198,10 +1307,9 @@ UHoudiniPDGAssetLink::DestroyWorkItemByID(const int32& InWorkItemID, UTOPNode* I
 	// so that we don't have to find its index again to remove it from the array
 	ClearWorkItemResultByID(InWorkItemID, InTOPNode);
 	// Find the index of the FTOPWorkResult for InWorkItemID in InTOPNode.WorkResult and remove it
-	const int32 Index = InTOPNode->WorkResult.IndexOfByPredicate(
-		[InWorkItemID](const FTOPWorkResult& InWorkItem) { return InWorkItem.WorkItemID == InWorkItemID; });
+	const int32 Index = InTOPNode->ArrayIndexOfWorkResultByID(InWorkItemID);
 	if (Index != INDEX_NONE && Index >= 0)
-		InTOPNode->WorkResult.RemoveAt(Index);
+		InTOPNode->RemoveWorkResultAt(Index);
 }
 
 FTOPWorkResult*
@@ -489,6 +489,16 @@ public:
 	int32 ArrayIndexOfFirstInvalidWorkResult() const;
 	// Return the FTOPWorkResult at InArrayIndex in the WorkResult array, or nullptr if InArrayIndex is not a valid index.
 	FTOPWorkResult* GetWorkResultByArrayIndex(const int32& InArrayIndex);
+	// Add a FTOPWorkResult entry for InWorkItemID, re-using the first entry with an invalid (INDEX_NONE) work item id if
+	// there is one. Returns the array index of the entry.
+	int32 AddOrReuseWorkResult(const int32& InWorkItemID, const int32& InWorkItemIndex);
+	// Remove the FTOPWorkResult entry at InArrayIndex, the entries after it are shifted down.
+	bool RemoveWorkResultAt(const int32& InArrayIndex);
+	// Remove all FTOPWorkResult entries.
+	void EmptyWorkResults();
+	// Rebuild the work item ID to array index map and the list of entries with invalid work item ids. This must be
+	// called if the WorkItemIDs of the WorkResult entries are modified directly.
+	void RebuildWorkResultIndex() const;
 
 	// Returns true if InNetwork is the parent TOP Net of this node.
 	bool IsParentTOPNetwork(UTOPNetwork const * const InNetwork) const;
@@ -496,6 +506,8 @@ public:
 	// Returns true if this node can still be auto-baked
 	bool CanStillBeAutoBaked() const;
 
+	virtual void PostLoad() override;
+
 #if WITH_EDITOR
 	void PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent) override;
 #endif
@@ -591,6 +603,19 @@ protected:
 	UPROPERTY(Transient, NonTransactional)
 	bool bHasReceivedCookCompleteEvent;
 
+	// Refreshes the work result index if it is out of date with the WorkResult array
+	void UpdateWorkResultIndex() const;
+
+	// Work item ID to WorkResult array index, rebuilt on load
+	mutable TMap<int32, int32> WorkResultIndexByID;
+	// Array indices of the WorkResult entries with an invalid work item id.
+	// Kept as a min-heap so that stale entries are re-used in array order.
+	mutable TArray<int32> FreeWorkResultIndices;
+	// Number of WorkResult entries when the index was last updated
+	mutable int32 NumIndexedWorkResults;
+	// Set when entries are removed, as the array indices after them have shifted
+	mutable bool bWorkResultIndexDirty;
+
 private:
 	UPROPERTY()
 	FOutputActorOwner OutputActorOwner;
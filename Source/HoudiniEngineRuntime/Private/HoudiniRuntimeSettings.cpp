@@ -108,6 +108,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	ProxyMeshAutoRefineTimeoutSeconds = 10.0f;
 	bEnableProxyStaticMeshRefinementOnPreSaveWorld = true;
 	bEnableProxyStaticMeshRefinementOnPreBeginPIE = true;
+	bPackProxyStaticMeshVertexData = true;
 
 	// Generated StaticMesh settings.
 	bDoubleSidedGeometry = false;
@@ -141,6 +142,8 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	DistanceFieldResolutionScale = 2.0f; // ue default is 1.0
 
 	bPDGAsyncCommandletImportEnabled = false;
+	PDGAsyncCommandletImportProcesses = 1;
+	PDGAsyncCommandletImportTimeout = 300.0f;
 
 	// Legacy settings
 	bEnableBackwardCompatibility = true;
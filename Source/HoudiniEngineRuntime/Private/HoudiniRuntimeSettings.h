@@ -330,6 +330,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Refine Proxy Static Meshes On PIE", EditCondition = "bEnableProxyStaticMesh"))
 		bool bEnableProxyStaticMeshRefinementOnPreBeginPIE;
 
+		// Store the proxy meshes' normals, tangents and UVs in the packed formats used for rendering (8-bit normals
+		// and half-float UVs), this reduces their memory and package size.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Pack Proxy Static Mesh Vertex Data", EditCondition = "bEnableProxyStaticMesh"))
+		bool bPackProxyStaticMeshVertexData;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Generated StaticMesh settings.
 		//-------------------------------------------------------------------------------------------------------------
@@ -463,6 +468,16 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Enabled"))
 		bool bPDGAsyncCommandletImportEnabled;
 
+		// Number of async importer processes. Work item results are dispatched to the least busy one.
+		// Each process starts its own Houdini Engine session.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Processes", ClampMin = "1", UIMin = "1", UIMax = "16", EditCondition = "bPDGAsyncCommandletImportEnabled"))
+		int32 PDGAsyncCommandletImportProcesses;
+
+		// Seconds an async importer process can go without replying while it has pending imports. The process is then
+		// stopped and its work item results are imported again. 0 disables the timeout.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Timeout", ClampMin = "0", UIMin = "0", EditCondition = "bPDGAsyncCommandletImportEnabled"))
+		float PDGAsyncCommandletImportTimeout;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Legacy
 		//-------------------------------------------------------------------------------------------------------------
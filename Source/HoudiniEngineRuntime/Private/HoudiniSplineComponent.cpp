@@ -97,6 +97,9 @@ UHoudiniSplineComponent::Serialize(FArchive& Ar)
 		// Normal v2 serialization
 		Super::Serialize(Ar);
 	}
+
+	if (Ar.IsLoading())
+		MarkCurvePointsChanged();
 }
 
 UHoudiniSplineComponent::UHoudiniSplineComponent(const FObjectInitializer & ObjectInitializer)
@@ -113,6 +116,10 @@ UHoudiniSplineComponent::UHoudiniSplineComponent(const FObjectInitializer & Obje
 	, bIsInputCurve(false)
 	, bIsEditableOutputCurve(false)
 	, NodeId(-1)
+	, CachedCurvePointsBounds(ForceInitToZero)
+	, CachedCurvePointsData(nullptr)
+	, CachedCurvePointsNum(0)
+	, bCurvePointsBoundsDirty(true)
 {
 
 	// Add two default points to the curve
@@ -272,6 +279,7 @@ UHoudiniSplineComponent::CopyHoudiniData(const UHoudiniSplineComponent* OtherHou
 		return;
 
 	CurvePoints = OtherHoudiniSplineComponent->CurvePoints;
+	MarkCurvePointsChanged();
 	DisplayPoints = OtherHoudiniSplineComponent->DisplayPoints;
 	DisplayPointIndexDivider = OtherHoudiniSplineComponent->DisplayPointIndexDivider;
 	CurveType = OtherHoudiniSplineComponent->CurveType;
@@ -296,6 +304,7 @@ void
 UHoudiniSplineComponent::AppendPoint(const FTransform& NewPoint)
 {
 	CurvePoints.Add(NewPoint);
+	MarkCurvePointsChanged();
 }
 
 void
@@ -303,6 +312,7 @@ UHoudiniSplineComponent::InsertPointAtIndex(const FTransform& NewPoint, const in
 {
 	check(Index >= 0 && Index < CurvePoints.Num());
 	CurvePoints.Insert(NewPoint, Index);
+	MarkCurvePointsChanged();
 	bHasChanged = true;
 }
 
@@ -312,6 +322,7 @@ UHoudiniSplineComponent::RemovePointAtIndex(const int32& Index)
 {
 	check(Index >= 0 && Index < CurvePoints.Num());
 	CurvePoints.RemoveAt(Index);
+	MarkCurvePointsChanged();
 	bHasChanged = true;
 }
 
@@ -334,6 +345,7 @@ UHoudiniSplineComponent::ReverseCurvePoints()
 		return;
 
 	Algo::Reverse(CurvePoints);
+	MarkCurvePointsChanged();
 }
 
 void 
@@ -343,6 +355,7 @@ UHoudiniSplineComponent::EditPointAtindex(const FTransform& NewPoint, const int3
 		return;
 
 	CurvePoints[Index] = NewPoint;
+	MarkCurvePointsChanged();
 	bHasChanged = true;
 }
 
@@ -354,6 +367,9 @@ UHoudiniSplineComponent::PostEditChangeProperty(FPropertyChangedEvent& PeopertyC
 
 	FName PropertyName = (PeopertyChangedEvent.Property != nullptr) ? PeopertyChangedEvent.Property->GetFName() : NAME_None;
 
+	// The curve points can be edited from the details panel
+	MarkCurvePointsChanged();
+
 	// Responses to the uproperty changes
 	if (PropertyName == GET_MEMBER_NAME_CHECKED(UHoudiniSplineComponent, bClosed)) 
 	{
@@ -429,6 +445,7 @@ UHoudiniSplineComponent::CopyPropertiesFrom(UObject* FromObject)
 	if (FromSplineComponent)
 	{
 		CurvePoints = FromSplineComponent->CurvePoints;
+		MarkCurvePointsChanged();
 		DisplayPoints = FromSplineComponent->DisplayPoints;
 		DisplayPointIndexDivider = FromSplineComponent->DisplayPointIndexDivider;
 #if WITH_EDITORONLY_DATA
@@ -508,7 +525,8 @@ UHoudiniSplineComponent::SetOffset(const float& Offset)
 {
 	for (int n = 0; n < CurvePoints.Num(); ++n)
 		CurvePoints[n].AddToTranslation(FVector(0.f, Offset, 0.f));
-	
+	MarkCurvePointsChanged();
+
 	for (int n = 0; n < DisplayPoints.Num(); ++n)
 		DisplayPoints[n] += FVector(0.f, Offset, 0.f);
 }
@@ -517,6 +535,7 @@ void
 UHoudiniSplineComponent::ResetCurvePoints() 
 {
 	CurvePoints.Empty();
+	MarkCurvePointsChanged();
 }
 
 void
@@ -529,6 +548,7 @@ void
 UHoudiniSplineComponent::AddCurvePoints(const TArray<FTransform>& Points) 
 {
 	CurvePoints.Append(Points);
+	MarkCurvePointsChanged();
 }
 
 void 
@@ -562,6 +582,35 @@ void UHoudiniSplineComponent::MarkChanged(const bool& Changed)
 {
 	bHasChanged = Changed;
 	bNeedsToTriggerUpdate = Changed;
+
+	if (Changed)
+		MarkCurvePointsChanged();
+}
+
+FBox
+UHoudiniSplineComponent::GetCurvePointsBounds() const
+{
+	if (bCurvePointsBoundsDirty
+		|| CachedCurvePointsData != CurvePoints.GetData()
+		|| CachedCurvePointsNum != CurvePoints.Num())
+	{
+		CachedCurvePointsBounds = ComputeCurvePointsBounds();
+		CachedCurvePointsData = CurvePoints.GetData();
+		CachedCurvePointsNum = CurvePoints.Num();
+		bCurvePointsBoundsDirty = false;
+	}
+
+	return CachedCurvePointsBounds;
+}
+
+FBox
+UHoudiniSplineComponent::ComputeCurvePointsBounds() const
+{
+	FBox PointsBounds(ForceInitToZero);
+	for (const FTransform& CurPoint : CurvePoints)
+		PointsBounds += CurPoint.GetLocation();
+
+	return PointsBounds;
 }
 
 void UHoudiniSplineComponent::MarkInputNodesAsPendingKill()
@@ -120,6 +120,16 @@ class HOUDINIENGINERUNTIME_API UHoudiniSplineComponent : public USceneComponent,
 		FORCEINLINE
 		int32 GetCurvePointCount() const { return CurvePoints.Num(); }
 
+		// Bounds of the curve points' locations, cached until the points are modified.
+		FBox GetCurvePointsBounds() const;
+
+		// Recomputes the bounds of the curve points' locations.
+		FBox ComputeCurvePointsBounds() const;
+
+		// Must be called after modifying CurvePoints directly.
+		FORCEINLINE
+		void MarkCurvePointsChanged() { bCurvePointsBoundsDirty = true; }
+
 		FORCEINLINE
 		bool IsClosedCurve() const { return bClosed; }
 
@@ -272,6 +282,16 @@ class HOUDINIENGINERUNTIME_API UHoudiniSplineComponent : public USceneComponent,
 
 		UPROPERTY()
 		FString PartName;
+
+		// Cached bounds of the curve points, see GetCurvePointsBounds()
+		mutable FBox CachedCurvePointsBounds;
+
+		// CurvePoints' allocation and size when the bounds were cached,
+		// catches direct modifications that were not followed by MarkCurvePointsChanged()
+		mutable const FTransform* CachedCurvePointsData;
+		mutable int32 CachedCurvePointsNum;
+
+		mutable bool bCurvePointsBoundsDirty;
 };
 
 // Used to store HoudiniAssetComponent data during BP reconstruction
@@ -38,11 +38,18 @@ UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializ
 	bHasColors = false;
 	NumUVLayers = 0;
 	bHasPerFaceMaterials = false;
+	bHasPackedVertexData = false;
 }
 
 void 
 UHoudiniStaticMesh::Initialize(uint32 InNumVertices, uint32 InNumTriangles, uint32 InNumUVLayers, uint32 InInitialNumStaticMaterials, bool bInHasNormals, bool bInHasTangents, bool bInHasColors, bool bInHasPerFaceMaterials)
 {
+	// Back to full precision vertex data
+	bHasPackedVertexData = false;
+	VertexInstancePackedTangentX.Empty();
+	VertexInstancePackedTangentZ.Empty();
+	VertexInstancePackedUVs.Empty();
+
 	// Initialize the vertex positions and triangle indices arrays
 	VertexPositions.SetNumUninitialized(InNumVertices);
 	for(int32 n = 0; n < VertexPositions.Num(); n++)
@@ -385,10 +392,59 @@ void UHoudiniStaticMesh::Optimize()
 	VertexInstanceUTangents.Shrink();
 	VertexInstanceVTangents.Shrink();
 	VertexInstanceUVs.Shrink();
+	VertexInstancePackedTangentX.Shrink();
+	VertexInstancePackedTangentZ.Shrink();
+	VertexInstancePackedUVs.Shrink();
 	MaterialIDsPerTriangle.Shrink();
 	StaticMaterials.Shrink();
 }
 
+void UHoudiniStaticMesh::PackVertexData()
+{
+	if (bHasPackedVertexData)
+		return;
+
+	const int32 NumVertexInstances = GetNumVertexInstances();
+
+	// Always store the tangent basis, as the render buffers need one even if the mesh has no normals
+	VertexInstancePackedTangentX.SetNumUninitialized(NumVertexInstances);
+	VertexInstancePackedTangentZ.SetNumUninitialized(NumVertexInstances);
+	ParallelFor(NumVertexInstances, [this](int32 VertexInstanceIndex)
+	{
+		const FVector Normal = bHasNormals ? VertexInstanceNormals[VertexInstanceIndex] : FVector(0, 0, 1);
+		FVector TangentU;
+		FVector TangentV;
+		if (bHasTangents)
+		{
+			TangentU = VertexInstanceUTangents[VertexInstanceIndex];
+			TangentV = VertexInstanceVTangents[VertexInstanceIndex];
+		}
+		else
+		{
+			Normal.FindBestAxisVectors(TangentU, TangentV);
+		}
+
+		// Same as FStaticMeshVertexBuffer::SetVertexTangents(): W is the sign of the basis determinant
+		const float BasisSign = FVector::DotProduct(TangentU, FVector::CrossProduct(TangentV, Normal)) < 0.0f ? -1.0f : 1.0f;
+		VertexInstancePackedTangentX[VertexInstanceIndex] = FPackedNormal(TangentU);
+		VertexInstancePackedTangentZ[VertexInstanceIndex] = FPackedNormal(FVector4(Normal, BasisSign));
+	});
+
+	const int32 NumUVs = VertexInstanceUVs.Num();
+	VertexInstancePackedUVs.SetNumUninitialized(NumUVs);
+	ParallelFor(NumUVs, [this](int32 UVIndex)
+	{
+		VertexInstancePackedUVs[UVIndex] = FVector2DHalf(VertexInstanceUVs[UVIndex]);
+	});
+
+	VertexInstanceNormals.Empty();
+	VertexInstanceUTangents.Empty();
+	VertexInstanceVTangents.Empty();
+	VertexInstanceUVs.Empty();
+
+	bHasPackedVertexData = true;
+}
+
 FBox UHoudiniStaticMesh::CalcBounds() const
 {
 	const uint32 NumVertices = VertexPositions.Num();
@@ -452,8 +508,10 @@ bool UHoudiniStaticMesh::IsValid(bool bInSkipVertexIndicesCheck) const
 		&& ValidateAttributeArraySize(VertexInstanceUTangents.Num(), NumVertexInstances)
 		&& ValidateAttributeArraySize(VertexInstanceVTangents.Num(), NumVertexInstances)
 		&& ValidateAttributeArraySize(VertexInstanceColors.Num(), NumVertexInstances)
+		&& ValidateAttributeArraySize(VertexInstancePackedTangentX.Num(), NumVertexInstances)
+		&& ValidateAttributeArraySize(VertexInstancePackedTangentZ.Num(), NumVertexInstances)
 		&& NumUVLayers >= 0
-		&& VertexInstanceUVs.Num() == NumUVLayers * NumVertexInstances; 
+		&& (bHasPackedVertexData ? VertexInstancePackedUVs.Num() : VertexInstanceUVs.Num()) == NumUVLayers * NumVertexInstances; 
 
 	if (!bInSkipVertexIndicesCheck)
 	{
@@ -470,6 +528,20 @@ bool UHoudiniStaticMesh::IsValid(bool bInSkipVertexIndicesCheck) const
 	return bValid;
 }
 
+// Serializes an array of trivially copyable elements, compressed.
+template<typename ElementType>
+static void
+SerializeCompressedArray(FArchive& InArchive, TArray<ElementType>& InOutArray)
+{
+	int32 NumElements = InOutArray.Num();
+	InArchive << NumElements;
+	if (InArchive.IsLoading())
+		InOutArray.SetNumUninitialized(NumElements);
+
+	if (NumElements > 0)
+		InArchive.SerializeCompressed(InOutArray.GetData(), static_cast<int64>(NumElements) * sizeof(ElementType), NAME_Zlib);
+}
+
 void UHoudiniStaticMesh::Serialize(FArchive &InArchive)
 {
 	Super::Serialize(InArchive);
@@ -497,5 +569,39 @@ void UHoudiniStaticMesh::Serialize(FArchive &InArchive)
 
 	MaterialIDsPerTriangle.Shrink();
 	MaterialIDsPerTriangle.BulkSerialize(InArchive);
+
+	// bHasPackedVertexData is a tagged property, so it is already loaded at this point.
+	// Meshes saved without packed data don't have this section.
+	if (bHasPackedVertexData)
+	{
+		SerializeCompressedArray(InArchive, VertexInstancePackedTangentX);
+		SerializeCompressedArray(InArchive, VertexInstancePackedTangentZ);
+		SerializeCompressedArray(InArchive, VertexInstancePackedUVs);
+	}
+	else if (InArchive.IsLoading())
+	{
+		VertexInstancePackedTangentX.Empty();
+		VertexInstancePackedTangentZ.Empty();
+		VertexInstancePackedUVs.Empty();
+	}
+}
+
+void UHoudiniStaticMesh::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(
+		VertexPositions.GetAllocatedSize()
+		+ TriangleIndices.GetAllocatedSize()
+		+ VertexInstanceColors.GetAllocatedSize()
+		+ VertexInstanceNormals.GetAllocatedSize()
+		+ VertexInstanceUTangents.GetAllocatedSize()
+		+ VertexInstanceVTangents.GetAllocatedSize()
+		+ VertexInstanceUVs.GetAllocatedSize()
+		+ VertexInstancePackedTangentX.GetAllocatedSize()
+		+ VertexInstancePackedTangentZ.GetAllocatedSize()
+		+ VertexInstancePackedUVs.GetAllocatedSize()
+		+ MaterialIDsPerTriangle.GetAllocatedSize()
+		+ StaticMaterials.GetAllocatedSize());
 }
 
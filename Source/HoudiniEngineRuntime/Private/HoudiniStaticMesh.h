@@ -28,6 +28,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/StaticMesh.h"
+#include "PackedNormal.h"
 
 #include "HoudiniStaticMesh.generated.h"
 
@@ -154,6 +155,18 @@ public:
 	UFUNCTION()
 	void Optimize();
 
+	/**
+	 * Replaces the full precision normals, tangents and UVs with the packed formats used by the render buffers:
+	 * 8-bit normals and U tangents (with the sign of the V tangent in the normal's W) and half-float UVs.
+	 * The packed arrays are compressed when serialized. Meant to be called once the mesh data arrays are populated,
+	 * the normals, tangents and UVs can't be modified afterwards.
+	 */
+	UFUNCTION()
+	void PackVertexData();
+
+	UFUNCTION()
+	bool HasPackedVertexData() const { return bHasPackedVertexData; }
+
 	UFUNCTION()
 	FBox CalcBounds() const;
 
@@ -178,6 +191,12 @@ public:
 	UFUNCTION()
 	const TArray<FVector2D>& GetVertexInstanceUVs() const { return VertexInstanceUVs; }
 
+	const TArray<FPackedNormal>& GetVertexInstancePackedTangentX() const { return VertexInstancePackedTangentX; }
+
+	const TArray<FPackedNormal>& GetVertexInstancePackedTangentZ() const { return VertexInstancePackedTangentZ; }
+
+	const TArray<FVector2DHalf>& GetVertexInstancePackedUVs() const { return VertexInstancePackedUVs; }
+
 	UFUNCTION()
 	const TArray<int32>& GetMaterialIDsPerTriangle() const { return MaterialIDsPerTriangle; }
 
@@ -201,6 +220,8 @@ public:
 	// Custom serialization: we use TArray::BulkSerialize to speed up array serialization
 	virtual void Serialize(FArchive &InArchive) override;
 
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
 protected:
 
 	UPROPERTY()
@@ -219,6 +240,10 @@ protected:
 	UPROPERTY()
 	bool bHasPerFaceMaterials;
 
+	/** True if the normals, tangents and UVs are stored in the packed arrays, see PackVertexData(). */
+	UPROPERTY()
+	bool bHasPackedVertexData;
+
 	/** Vertex positions. The vertex id == vertex index => indexes into this array. */
 	UPROPERTY(SkipSerialization)
 	TArray<FVector> VertexPositions;
@@ -249,6 +274,15 @@ protected:
 	UPROPERTY(SkipSerialization)
 	TArray<FVector2D> VertexInstanceUVs;
 
+	/** Packed U tangents per vertex instance, only used if bHasPackedVertexData is true. */
+	TArray<FPackedNormal> VertexInstancePackedTangentX;
+
+	/** Packed normals per vertex instance, W is the sign of the V tangent. Only used if bHasPackedVertexData is true. */
+	TArray<FPackedNormal> VertexInstancePackedTangentZ;
+
+	/** Half precision UVs, same layout as VertexInstanceUVs. Only used if bHasPackedVertexData is true. */
+	TArray<FVector2DHalf> VertexInstancePackedUVs;
+
 	/** Array of material ID per triangle. Indexed by Triangle ID/Index. */
 	UPROPERTY(SkipSerialization)
 	TArray<int32> MaterialIDsPerTriangle;
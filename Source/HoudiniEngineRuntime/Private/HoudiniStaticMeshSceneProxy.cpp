@@ -29,6 +29,7 @@
 #include "Async/ParallelFor.h"
 #include "Materials/Material.h"
 #include "PrimitiveViewRelevance.h"
+#include "SceneManagement.h"
 #include "Engine/Engine.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
@@ -225,6 +226,48 @@ void FHoudiniStaticMeshSceneProxy::Build()
 	}
 }
 
+void FHoudiniStaticMeshSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PDI)
+{
+	// The buffers are not rebuilt while the proxy is alive: when the mesh changes, the component's render state is
+	// dirtied and a new proxy is created, so the mesh draw commands built from these batches can be cached.
+	const ESceneDepthPriorityGroup DepthPriority = SDPG_World;
+
+	const int32 NumBufferSets = BufferSets.Num();
+	for (int32 BufferSetIdx = 0; BufferSetIdx < NumBufferSets; ++BufferSetIdx)
+	{
+		const FHoudiniStaticMeshRenderBufferSet *BufferSet = BufferSets[BufferSetIdx];
+		if (BufferSet->NumTriangles == 0 || BufferSet->TriangleIndexBuffer.Indices.Num() <= 0)
+			continue;
+
+		FMeshBatch Mesh;
+		PopulateMeshBatch(Mesh, *BufferSet, BufferSet->Material->GetRenderProxy(), false, DepthPriority);
+
+		// Use the primitive's uniform buffer
+		Mesh.Elements[0].PrimitiveUniformBuffer = nullptr;
+		Mesh.Elements[0].PrimitiveUniformBufferResource = nullptr;
+
+		Mesh.LODIndex = 0;
+		Mesh.SegmentIndex = BufferSetIdx;
+		Mesh.CastShadow = true;
+		Mesh.bUseForMaterial = true;
+		Mesh.bUseForDepthPass = true;
+		Mesh.bUseAsOccluder = ShouldUseAsOccluder();
+
+		PDI->DrawMesh(Mesh, FLT_MAX);
+	}
+}
+
+bool FHoudiniStaticMeshSceneProxy::RequiresDynamicPath(const FSceneView* View) const
+{
+	const FEngineShowFlags& EngineShowFlags = View->Family->EngineShowFlags;
+	return (AllowDebugViewmodes() && EngineShowFlags.Wireframe)
+		|| IsRichView(*View->Family)
+		|| EngineShowFlags.Bounds
+		|| EngineShowFlags.Collision
+		|| (IsSelected() && EngineShowFlags.VertexColors)
+		|| HasViewDependentDPG();
+}
+
 void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const
 {
 	const FEngineShowFlags EngineShowFlags = ViewFamily.EngineShowFlags;
@@ -309,6 +352,19 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	ESceneDepthPriorityGroup DepthPriority,
 	int ViewIndex,
 	FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer) const
+{
+	PopulateMeshBatch(InMeshBatch, Buffers, Material, bRenderAsWireframe, DepthPriority);
+	InMeshBatch.Elements[0].PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
+
+	return true;
+}
+
+void FHoudiniStaticMeshSceneProxy::PopulateMeshBatch(
+	FMeshBatch &InMeshBatch,
+	const FHoudiniStaticMeshRenderBufferSet& Buffers,
+	FMaterialRenderProxy* Material,
+	bool bRenderAsWireframe,
+	ESceneDepthPriorityGroup DepthPriority) const
 {
 	FMeshBatchElement& BatchElement = InMeshBatch.Elements[0];
 	BatchElement.IndexBuffer = &Buffers.TriangleIndexBuffer;
@@ -316,8 +372,6 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	InMeshBatch.VertexFactory = &Buffers.LocalVertexFactory;
 	InMeshBatch.MaterialRenderProxy = Material;
 
-	BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
-
 	BatchElement.FirstIndex = 0;
 	BatchElement.NumPrimitives = Buffers.NumTriangles;
 	BatchElement.MinVertexIndex = 0;
@@ -326,8 +380,6 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	InMeshBatch.Type = PT_TriangleList;
 	InMeshBatch.DepthPriorityGroup = DepthPriority;
 	InMeshBatch.bCanApplyViewModeOverrides = false;
-	
-	return true;
 }
 
 
@@ -336,7 +388,14 @@ FPrimitiveViewRelevance FHoudiniStaticMeshSceneProxy::GetViewRelevance(const FSc
 	FPrimitiveViewRelevance Result;
 
 	Result.bDrawRelevance = IsShown(View);
-	Result.bDynamicRelevance = true;
+	if (RequiresDynamicPath(View))
+	{
+		Result.bDynamicRelevance = true;
+	}
+	else
+	{
+		Result.bStaticRelevance = true;
+	}
 	Result.bRenderCustomDepth = ShouldRenderCustomDepth();
 	Result.bRenderInMainPass = ShouldRenderInMainPass();
 	Result.bShadowRelevance = IsShadowCast(View);
@@ -387,6 +446,19 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 	const bool bHasColors = InMesh->HasColors();
 	const bool bHasNormals = InMesh->HasNormals();
 	const bool bHasTangents = InMesh->HasTangents();
+	const uint32 NumMeshVertexInstances = InMesh->GetNumVertexInstances();
+
+	// Packed vertex data is already in the buffers' default formats: copy it as is when the formats match
+	const bool bHasPackedVertexData = InMesh->HasPackedVertexData();
+	const TArray<FPackedNormal>& PackedTangentX = InMesh->GetVertexInstancePackedTangentX();
+	const TArray<FPackedNormal>& PackedTangentZ = InMesh->GetVertexInstancePackedTangentZ();
+	const TArray<FVector2DHalf>& PackedUVs = InMesh->GetVertexInstancePackedUVs();
+	FStaticMeshVertexBuffer& StaticMeshVertexBuffer = InBuffers->StaticMeshVertexBuffer;
+	FPackedNormal* const TangentData = bHasPackedVertexData && !StaticMeshVertexBuffer.GetUseHighPrecisionTangentBasis()
+		? static_cast<FPackedNormal*>(StaticMeshVertexBuffer.GetTangentData()) : nullptr;
+	FVector2DHalf* const TexCoordData = bHasPackedVertexData && !StaticMeshVertexBuffer.GetUseFullPrecisionUVs()
+		? static_cast<FVector2DHalf*>(StaticMeshVertexBuffer.GetTexCoordData()) : nullptr;
+	const uint32 NumTexCoords = StaticMeshVertexBuffer.GetNumTexCoords();
 
 	FThreadSafeCounter VertCounter(0);
 	//for (uint32 TriangleIDIdx = 0; TriangleIDIdx < NumTriangles; ++TriangleIDIdx)
@@ -405,6 +477,39 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 
 			InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = VertexPositions[TriIndices[TriVertIdx]];
 
+			if (bHasPackedVertexData)
+			{
+				// The tangent data is stored as TangentX, TangentZ pairs
+				if (TangentData)
+				{
+					TangentData[VertIdx * 2] = PackedTangentX[MeshVtxInstanceIdx];
+					TangentData[VertIdx * 2 + 1] = PackedTangentZ[MeshVtxInstanceIdx];
+				}
+				else
+				{
+					const FVector PackedX = PackedTangentX[MeshVtxInstanceIdx].ToFVector();
+					const FVector4 PackedZ = PackedTangentZ[MeshVtxInstanceIdx].ToFVector4();
+					const FVector PackedY = (FVector(PackedZ) ^ PackedX) * PackedZ.W;
+					StaticMeshVertexBuffer.SetVertexTangents(VertIdx, PackedX, PackedY, FVector(PackedZ));
+				}
+
+				for (uint32 UVLayerIdx = 0; UVLayerIdx < NumTexCoords; ++UVLayerIdx)
+				{
+					const FVector2DHalf UV = UVLayerIdx < NumUVLayers
+						? PackedUVs[UVLayerIdx * NumMeshVertexInstances + MeshVtxInstanceIdx] : FVector2DHalf(FVector2D::ZeroVector);
+					if (TexCoordData)
+						TexCoordData[VertIdx * NumTexCoords + UVLayerIdx] = UV;
+					else
+						StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, UV);
+				}
+
+				InBuffers->ColorVertexBuffer.VertexColor(VertIdx) = bHasColors ? VertexInstanceColors[MeshVtxInstanceIdx] : DefaultVertexColor;
+
+				InBuffers->TriangleIndexBuffer.Indices[VertIdx] = VertIdx;
+				VertIdx++;
+				continue;
+			}
+
 			FVector Normal = bHasNormals ? VertexInstanceNormals[MeshVtxInstanceIdx] : FVector(0, 0, 1);
 			if (bHasTangents)
 			{
@@ -110,6 +110,8 @@ public:
 	virtual void Build();
 
 	// FPrimitiveSceneProxy
+	virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override;
+
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override;
 
 	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override;
@@ -147,6 +149,18 @@ protected:
 	// Get the number of materials from the parent mesh/component
 	uint32 GetNumMaterials() const { return Component ? Component->GetNumMaterials() : 0; }
 
+	// Returns true if the mesh has to be drawn by GetDynamicMeshElements in this view (wireframe and debug view modes),
+	// otherwise the mesh batches from DrawStaticElements are used and their mesh draw commands are cached by the renderer.
+	bool RequiresDynamicPath(const FSceneView* View) const;
+
+	// Sets up the parts of a mesh batch that are shared by the static and dynamic paths.
+	void PopulateMeshBatch(
+		FMeshBatch &InMeshBatch,
+		const FHoudiniStaticMeshRenderBufferSet& Buffers,
+		FMaterialRenderProxy* Material,
+		bool bRenderAsWireframe,
+		ESceneDepthPriorityGroup DepthPriority) const;
+
 	virtual bool PopulateMeshElement(
 		FMeshBatch &InMeshBatch,
 		const FHoudiniStaticMeshRenderBufferSet& Buffers,